@@ -0,0 +1,141 @@
+﻿using Melanchall.DryWetMidi.Common;
+using NUnit.Framework;
+using NUnit.Framework.Legacy;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace Melanchall.DryWetMidi.Tests.Common
+{
+    [TestFixture]
+    public sealed class TimerWheelTests
+    {
+        #region Test methods
+
+        [Test]
+        public void GetNextAdvanceTime_Empty()
+        {
+            var wheel = new TimerWheel<int>(1, 0);
+            ClassicAssert.AreEqual(0, wheel.Count, "Invalid initial count.");
+            ClassicAssert.IsNull(wheel.GetNextAdvanceTime(), "Next advance time is not null.");
+        }
+
+        [Test]
+        public void Advance_Expire([Values(1, 4)] long resolution, [Values(0, 1000)] long startTime, [Values(10, 1000, 1000000)] int maxDeadlineDelta)
+        {
+            var random = new System.Random(maxDeadlineDelta);
+            var deadlines = Enumerable.Range(0, 1000).Select(_ => startTime + random.Next(-10, maxDeadlineDelta)).ToArray();
+
+            var wheel = new TimerWheel<int>(resolution, startTime);
+            var nodes = deadlines.Select((d, i) => new TimerWheelNode<int>(i)).ToArray();
+
+            for (var i = 0; i < nodes.Length; i++)
+            {
+                wheel.Add(nodes[i], deadlines[i]);
+            }
+
+            ClassicAssert.AreEqual(nodes.Length, wheel.Count, "Invalid count after adding.");
+
+            var expirationTimes = AdvanceToEnd(wheel);
+            ClassicAssert.AreEqual(0, wheel.Count, "Wheel is not empty.");
+
+            var firstTick = startTime / resolution + 1;
+
+            for (var i = 0; i < nodes.Length; i++)
+            {
+                var expectedTick = (deadlines[i] + resolution - 1) / resolution;
+                if (expectedTick < firstTick)
+                    expectedTick = firstTick;
+
+                ClassicAssert.AreEqual(
+                    expectedTick * resolution,
+                    expirationTimes[i],
+                    $"Node with deadline {deadlines[i]} expired at invalid time.");
+                ClassicAssert.IsFalse(nodes[i].IsInWheel, $"Node {i} is still in wheel.");
+            }
+        }
+
+        [Test]
+        public void Advance_Expire_DistantDeadline()
+        {
+            const long deadline = 1L << 25;
+
+            var wheel = new TimerWheel<int>(1, 0);
+            var node = new TimerWheelNode<int>(0);
+            wheel.Add(node, deadline);
+
+            var expirationTimes = AdvanceToEnd(wheel);
+            ClassicAssert.AreEqual(deadline, expirationTimes[0], "Node expired at invalid time.");
+        }
+
+        [Test]
+        public void Remove([Values(1, 4)] long resolution)
+        {
+            var random = new System.Random(0);
+            var deadlines = Enumerable.Range(0, 1000).Select(_ => (long)random.Next(0, 100000)).ToArray();
+
+            var wheel = new TimerWheel<int>(resolution, 0);
+            var nodes = deadlines.Select((d, i) => new TimerWheelNode<int>(i)).ToArray();
+
+            for (var i = 0; i < nodes.Length; i++)
+            {
+                wheel.Add(nodes[i], deadlines[i]);
+            }
+
+            for (var i = 0; i < nodes.Length; i += 2)
+            {
+                ClassicAssert.IsTrue(wheel.Remove(nodes[i]), $"Node {i} is not removed.");
+                ClassicAssert.IsFalse(wheel.Remove(nodes[i]), $"Node {i} is removed twice.");
+            }
+
+            ClassicAssert.AreEqual(nodes.Length / 2, wheel.Count, "Invalid count after removing.");
+
+            var expirationTimes = AdvanceToEnd(wheel);
+            CollectionAssert.AreEquivalent(
+                Enumerable.Range(0, nodes.Length).Where(i => i % 2 != 0).ToArray(),
+                expirationTimes.Keys,
+                "Invalid expired nodes.");
+        }
+
+        [Test]
+        public void Add_Reschedule()
+        {
+            var wheel = new TimerWheel<int>(1, 0);
+            var node = new TimerWheelNode<int>(0);
+
+            wheel.Add(node, 100000);
+            wheel.Add(node, 50);
+            ClassicAssert.AreEqual(1, wheel.Count, "Invalid count after rescheduling.");
+
+            var expirationTimes = AdvanceToEnd(wheel);
+            ClassicAssert.AreEqual(50, expirationTimes[0], "Node expired at invalid time.");
+        }
+
+        #endregion
+
+        #region Private methods
+
+        private static Dictionary<int, long> AdvanceToEnd(TimerWheel<int> wheel)
+        {
+            var result = new Dictionary<int, long>();
+            var expiredNodes = new List<TimerWheelNode<int>>();
+
+            long? time;
+            while ((time = wheel.GetNextAdvanceTime()) != null)
+            {
+                wheel.Advance(time.Value, expiredNodes);
+
+                foreach (var node in expiredNodes)
+                {
+                    ClassicAssert.IsFalse(result.ContainsKey(node.Value), $"Node {node.Value} expired twice.");
+                    result.Add(node.Value, time.Value);
+                }
+
+                expiredNodes.Clear();
+            }
+
+            return result;
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,139 @@
+﻿using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
+using Melanchall.DryWetMidi.Tests.Utilities;
+using NUnit.Framework;
+using NUnit.Framework.Legacy;
+using System;
+using System.Linq;
+using System.Threading.Tasks;
+
+namespace Melanchall.DryWetMidi.Tests.Core
+{
+    [TestFixture]
+    public sealed class CompactTrackTests
+    {
+        #region Constants
+
+        private static readonly MidiEvent[] Events = new MidiEvent[]
+        {
+            new SetTempoEvent(100000),
+            new NoteOnEvent((SevenBitNumber)70, (SevenBitNumber)50) { Channel = (FourBitNumber)2, DeltaTime = 10 },
+            new TextEvent("A") { DeltaTime = 5 },
+            new ProgramChangeEvent((SevenBitNumber)40) { Channel = (FourBitNumber)9 },
+            new PitchBendEvent(1000) { DeltaTime = 3 },
+            new NormalSysExEvent(new byte[] { 1, 2, 0xF7 }) { DeltaTime = 7 },
+            new NoteOffEvent((SevenBitNumber)70, (SevenBitNumber)30) { Channel = (FourBitNumber)2, DeltaTime = 100 },
+        };
+
+        #endregion
+
+        #region Test methods
+
+        [Test]
+        public void Create_FromEvents()
+        {
+            var compactTrack = new CompactTrack(Events.Concat(new MidiEvent[] { null }));
+
+            ClassicAssert.AreEqual(Events.Length, compactTrack.Count, "Count is invalid.");
+            MidiAsserts.AreEqual(Events, compactTrack.ToArray(), true, "Events are invalid.");
+
+            for (var i = 0; i < Events.Length; i++)
+            {
+                var midiEvent = Events[i];
+                var channelEvent = midiEvent as ChannelEvent;
+
+                ClassicAssert.AreEqual(midiEvent.DeltaTime, compactTrack.GetDeltaTime(i), $"Delta-time of event {i} is invalid.");
+                ClassicAssert.AreEqual(midiEvent.EventType, compactTrack.GetEventType(i), $"Type of event {i} is invalid.");
+                ClassicAssert.AreEqual(channelEvent?.Channel, compactTrack.GetChannel(i), $"Channel of event {i} is invalid.");
+                MidiAsserts.AreEqual(midiEvent, compactTrack.GetEvent(i), true, $"Event {i} is invalid.");
+            }
+        }
+
+        [Test]
+        public void Create_EventsChangedAfterCreation()
+        {
+            var events = Events.Select(e => e.Clone()).ToArray();
+            var compactTrack = new CompactTrack(events);
+
+            ((NoteOnEvent)events[1]).Velocity = (SevenBitNumber)1;
+            ((TextEvent)events[2]).Text = "B";
+
+            MidiAsserts.AreEqual(Events, compactTrack.ToArray(), true, "Events are changed.");
+        }
+
+        [Test]
+        public void GetEvent_ReturnsNewObject()
+        {
+            var compactTrack = new CompactTrack(Events);
+
+            var textEvent = (TextEvent)compactTrack.GetEvent(2);
+            textEvent.Text = "B";
+
+            MidiAsserts.AreEqual(Events[2], compactTrack.GetEvent(2), true, "Event is changed.");
+        }
+
+        [Test]
+        public void GetEventsCount()
+        {
+            var compactTrack = new CompactTrack(Events.Concat(new[] { new NoteOnEvent() }));
+
+            ClassicAssert.AreEqual(2, compactTrack.GetEventsCount(MidiEventType.NoteOn), "Note On events count is invalid.");
+            ClassicAssert.AreEqual(1, compactTrack.GetEventsCount(MidiEventType.Text), "Text events count is invalid.");
+            ClassicAssert.AreEqual(0, compactTrack.GetEventsCount(MidiEventType.ControlChange), "Control Change events count is invalid.");
+        }
+
+        [Test]
+        public void GetChannels()
+        {
+            var compactTrack = new CompactTrack(Events);
+
+            CollectionAssert.AreEqual(
+                new[] { (FourBitNumber)0, (FourBitNumber)2, (FourBitNumber)9 },
+                compactTrack.GetChannels(),
+                "Channels are invalid.");
+        }
+
+        [Test]
+        public void GetTotalDeltaTime()
+        {
+            var compactTrack = new CompactTrack(Events);
+
+            ClassicAssert.AreEqual(Events.Sum(e => e.DeltaTime), compactTrack.GetTotalDeltaTime(), "Total delta-time is invalid.");
+        }
+
+        [Test]
+        public void TrackChunk_FromCompactTrack()
+        {
+            var compactTrack = new CompactTrack(Events);
+            var trackChunk = new TrackChunk(compactTrack);
+
+            ClassicAssert.AreSame(compactTrack, trackChunk.ToCompactTrack(), "Compact track is not the same.");
+            MidiAsserts.AreEqual(new TrackChunk(Events), trackChunk.Clone(), true, "Clone is invalid.");
+            MidiAsserts.AreEqual(Events, trackChunk.Events, true, "Events are invalid.");
+
+            trackChunk.Events.Add(new TextEvent("B"));
+
+            var newCompactTrack = trackChunk.ToCompactTrack();
+            ClassicAssert.AreNotSame(compactTrack, newCompactTrack, "Compact track is the same after events changed.");
+            MidiAsserts.AreEqual(trackChunk.Events, newCompactTrack.ToArray(), true, "Events of new compact track are invalid.");
+            MidiAsserts.AreEqual(Events, compactTrack.ToArray(), true, "Original compact track is changed.");
+        }
+
+        [Test]
+        public void TrackChunk_FromCompactTrack_GetEventsConcurrently()
+        {
+            for (var i = 0; i < 100; i++)
+            {
+                var trackChunk = new TrackChunk(new CompactTrack(Events));
+                var events = new EventsCollection[Environment.ProcessorCount * 2];
+
+                Parallel.For(0, events.Length, j => events[j] = trackChunk.Events);
+
+                ClassicAssert.IsTrue(events.All(e => ReferenceEquals(e, events[0])), $"Different events collections obtained on iteration {i}.");
+                MidiAsserts.AreEqual(Events, events[0], true, $"Events are invalid on iteration {i}.");
+            }
+        }
+
+        #endregion
+    }
+}
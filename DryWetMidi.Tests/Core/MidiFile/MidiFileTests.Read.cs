@@ -1783,6 +1783,145 @@ namespace Melanchall.DryWetMidi.Tests.Core
             }
         }
 
+        [TestCase(4096)]
+        [TestCase(1)]
+        [TestCase(10000)]
+        [TestCase(123)]
+        public void Read_UseMemoryMappedFile(int bufferSize)
+        {
+            var noBufferingSettings = new ReadingSettings
+            {
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = BufferingPolicy.DontUseBuffering
+                }
+            };
+
+            var memoryMappedFileSettings = new ReadingSettings
+            {
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = BufferingPolicy.UseMemoryMappedFile,
+                    BufferSize = bufferSize
+                }
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var expectedMidiFile = MidiFile.Read(filePath, noBufferingSettings);
+                var midiFile = MidiFile.Read(filePath, memoryMappedFileSettings);
+                MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, $"File '{filePath}' is invalid.");
+            }
+        }
+
+        [Test]
+        public void Read_UseMemoryMappedFile_NotFileStream()
+        {
+            var memoryMappedFileSettings = new ReadingSettings
+            {
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = BufferingPolicy.UseMemoryMappedFile
+                }
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var expectedMidiFile = MidiFile.Read(filePath);
+
+                using (var stream = new NonSeekableStream(filePath))
+                {
+                    var midiFile = MidiFile.Read(stream, memoryMappedFileSettings);
+                    MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, $"File '{filePath}' is invalid.");
+                }
+            }
+        }
+
+        [TestCase(2, BufferingPolicy.DontUseBuffering)]
+        [TestCase(4, BufferingPolicy.UseFixedSizeBuffer)]
+        [TestCase(4, BufferingPolicy.BufferAllData)]
+        [TestCase(100, BufferingPolicy.UseMemoryMappedFile)]
+        public void Read_MaxDegreeOfParallelism(int maxDegreeOfParallelism, BufferingPolicy bufferingPolicy)
+        {
+            var parallelReadingSettings = new ReadingSettings
+            {
+                MaxDegreeOfParallelism = maxDegreeOfParallelism,
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = bufferingPolicy
+                }
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var expectedMidiFile = MidiFile.Read(filePath);
+                var midiFile = MidiFile.Read(filePath, parallelReadingSettings);
+                MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, $"File '{filePath}' is invalid.");
+
+                var midiFileFromBytes = MidiFile.Read(File.ReadAllBytes(filePath), parallelReadingSettings);
+                MidiAsserts.AreEqual(expectedMidiFile, midiFileFromBytes, true, $"File '{filePath}' read from bytes is invalid.");
+            }
+        }
+
+        [TestCase(SilentNoteOnPolicy.NoteOff, EndOfTrackStoringPolicy.Omit)]
+        [TestCase(SilentNoteOnPolicy.NoteOn, EndOfTrackStoringPolicy.Store)]
+        public void Read_UseCompactEventsStorage(SilentNoteOnPolicy silentNoteOnPolicy, EndOfTrackStoringPolicy endOfTrackStoringPolicy)
+        {
+            var readingSettings = new ReadingSettings
+            {
+                SilentNoteOnPolicy = silentNoteOnPolicy,
+                EndOfTrackStoringPolicy = endOfTrackStoringPolicy
+            };
+
+            var compactReadingSettings = new ReadingSettings
+            {
+                SilentNoteOnPolicy = silentNoteOnPolicy,
+                EndOfTrackStoringPolicy = endOfTrackStoringPolicy,
+                UseCompactEventsStorage = true
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var expectedMidiFile = MidiFile.Read(filePath, readingSettings);
+                var midiFile = MidiFile.Read(filePath, compactReadingSettings);
+
+                CollectionAssert.AreEqual(
+                    expectedMidiFile.GetTrackChunks().Select(c => c.Events.Count),
+                    midiFile.GetTrackChunks().Select(c => c.ToCompactTrack().Count),
+                    $"Events counts are invalid for file '{filePath}'.");
+
+                MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, $"File '{filePath}' is invalid.");
+            }
+        }
+
+        [Test]
+        public void Read_MaxDegreeOfParallelism_EventBeyondChunk()
+        {
+            // SysEx event of the first track chunk declares more data than the chunk has, so
+            // sequential reading takes bytes of the second chunk
+            var bytes = new byte[]
+            {
+                0x4D, 0x54, 0x68, 0x64, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x02, 0x00, 0x60,
+                0x4D, 0x54, 0x72, 0x6B, 0x00, 0x00, 0x00, 0x04, 0x00, 0xF0, 0x0A, 0x01,
+                0x4D, 0x54, 0x72, 0x6B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x90, 0x40, 0x7F, 0x00, 0xFF, 0x2F, 0x00,
+                0x4D, 0x54, 0x72, 0x6B, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFF, 0x2F, 0x00,
+            };
+
+            var readingSettings = new ReadingSettings
+            {
+                InvalidChunkSizePolicy = InvalidChunkSizePolicy.Ignore,
+                UnknownChunkIdPolicy = UnknownChunkIdPolicy.Skip,
+                NotEnoughBytesPolicy = NotEnoughBytesPolicy.Ignore
+            };
+
+            var expectedMidiFile = MidiFile.Read(bytes, readingSettings);
+
+            readingSettings.MaxDegreeOfParallelism = 4;
+            var midiFile = MidiFile.Read(bytes, readingSettings);
+
+            MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, "File read in parallel is invalid.");
+        }
+
         [TestCase(4096, true)]
         [TestCase(1, false)]
         [TestCase(10000, true)]
@@ -1824,6 +1963,79 @@ namespace Melanchall.DryWetMidi.Tests.Core
             }
         }
 
+        [Test]
+        public void Read_ByteArray()
+        {
+            var noBufferingSettings = new ReadingSettings
+            {
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = BufferingPolicy.DontUseBuffering
+                }
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var expectedMidiFile = MidiFile.Read(filePath, noBufferingSettings);
+                var midiFile = MidiFile.Read(File.ReadAllBytes(filePath));
+                MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, $"File '{filePath}' is invalid.");
+            }
+        }
+
+        [TestCase(0, 0)]
+        [TestCase(1, 0)]
+        [TestCase(0, 10)]
+        [TestCase(100, 1000)]
+        public void Read_ByteArray_Region(int leadingBytesCount, int trailingBytesCount)
+        {
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var bytes = File.ReadAllBytes(filePath);
+                var data = Enumerable
+                    .Repeat((byte)0xFF, leadingBytesCount)
+                    .Concat(bytes)
+                    .Concat(Enumerable.Repeat((byte)0xFF, trailingBytesCount))
+                    .ToArray();
+
+                var expectedMidiFile = MidiFile.Read(filePath);
+                var midiFile = MidiFile.Read(data, leadingBytesCount, bytes.Length);
+                MidiAsserts.AreEqual(expectedMidiFile, midiFile, true, $"File '{filePath}' is invalid.");
+            }
+        }
+
+        [Test]
+        public void Read_ByteArray_NotEnoughBytes()
+        {
+            var midiFile = new MidiFile(new TrackChunk(new TextEvent("Text"), new NoteOnEvent(), new NoteOffEvent()));
+
+            byte[] bytes;
+            using (var stream = new MemoryStream())
+            {
+                midiFile.Write(stream);
+                bytes = stream.ToArray();
+            }
+
+            var settings = new ReadingSettings
+            {
+                NotEnoughBytesPolicy = NotEnoughBytesPolicy.Abort,
+                InvalidChunkSizePolicy = InvalidChunkSizePolicy.Ignore
+            };
+
+            for (var count = 1; count < bytes.Length; count++)
+            {
+                ClassicAssert.Throws<NotEnoughBytesException>(
+                    () => MidiFile.Read(bytes, 0, count, settings),
+                    $"Exception not thrown for {count} bytes.");
+            }
+        }
+
+        [Test]
+        public void Read_ByteArray_Empty()
+        {
+            ClassicAssert.Throws<ArgumentException>(() => MidiFile.Read(new byte[0]), "Exception not thrown for empty array.");
+            ClassicAssert.Throws<ArgumentOutOfRangeException>(() => MidiFile.Read(new byte[10], 5, 6), "Exception not thrown for invalid count.");
+        }
+
         [Test]
         public void Read_EmptyTrackChunks([Values(1, 2, 3)] int count)
         {
@@ -2019,7 +2231,20 @@ namespace Melanchall.DryWetMidi.Tests.Core
                 readingSettings.ReaderSettings.BufferingPolicy = BufferingPolicy.UseFixedSizeBuffer;
                 ClassicAssert.Throws<TException>(() => MidiFile.Read(filePath, readingSettings), $"Exception not thrown for the file read with fixed size buffer.");
 
+                readingSettings.ReaderSettings.BufferingPolicy = BufferingPolicy.UseMemoryMappedFile;
+                ClassicAssert.Throws<TException>(() => MidiFile.Read(filePath, readingSettings), $"Exception not thrown for the file read with memory-mapped file.");
+
                 readingSettings.ReaderSettings.BufferingPolicy = BufferingPolicy.DontUseBuffering;
+
+                readingSettings.MaxDegreeOfParallelism = 4;
+                var parallelReadingException = ClassicAssert.Throws<TException>(() => MidiFile.Read(filePath, readingSettings), $"Exception not thrown for the file read in parallel.");
+                checkException(parallelReadingException);
+                readingSettings.MaxDegreeOfParallelism = 1;
+
+                readingSettings.UseCompactEventsStorage = true;
+                var compactReadingException = ClassicAssert.Throws<TException>(() => MidiFile.Read(filePath, readingSettings), $"Exception not thrown for the file read with compact events storage.");
+                checkException(compactReadingException);
+                readingSettings.UseCompactEventsStorage = false;
             }
             finally
             {
@@ -2071,7 +2296,21 @@ namespace Melanchall.DryWetMidi.Tests.Core
                 var newMidiFileWithFixedSizeBuffer = MidiFile.Read(filePath, readingSettings);
                 MidiAsserts.AreEqual(newMidiFile, newMidiFileWithFixedSizeBuffer, true, "The file with fixed-size buffer is invalid.");
 
+                readingSettings.ReaderSettings.BufferingPolicy = BufferingPolicy.UseMemoryMappedFile;
+                var newMidiFileWithMemoryMappedFile = MidiFile.Read(filePath, readingSettings);
+                MidiAsserts.AreEqual(newMidiFile, newMidiFileWithMemoryMappedFile, true, "The file with memory-mapped file is invalid.");
+
                 readingSettings.ReaderSettings.BufferingPolicy = BufferingPolicy.DontUseBuffering;
+
+                readingSettings.MaxDegreeOfParallelism = 4;
+                var newMidiFileReadInParallel = MidiFile.Read(filePath, readingSettings);
+                MidiAsserts.AreEqual(newMidiFile, newMidiFileReadInParallel, true, "The file read in parallel is invalid.");
+                readingSettings.MaxDegreeOfParallelism = 1;
+
+                readingSettings.UseCompactEventsStorage = true;
+                var newMidiFileWithCompactEventsStorage = MidiFile.Read(filePath, readingSettings);
+                MidiAsserts.AreEqual(newMidiFile, newMidiFileWithCompactEventsStorage, true, "The file read with compact events storage is invalid.");
+                readingSettings.UseCompactEventsStorage = false;
             }
             finally
             {
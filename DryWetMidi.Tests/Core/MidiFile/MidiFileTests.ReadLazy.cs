@@ -122,6 +122,39 @@ namespace Melanchall.DryWetMidi.Tests.Core
                 new MidiEventToken(new EndOfTrackEvent()) { Position = 45, Length = 4 }
             });
 
+        [Test]
+        public void ReadLazy_MultipleTrackChunks_UseMemoryMappedFile([Values(1, 5, 4096)] int bufferSize) => ReadLazy(
+            midiFile: new MidiFile(
+                new TrackChunk(
+                    new ControlChangeEvent((SevenBitNumber)70, SevenBitNumber.MaxValue)),
+                new TrackChunk(
+                    new NoteOnEvent((SevenBitNumber)70, SevenBitNumber.MaxValue) { DeltaTime = 100, Channel = (FourBitNumber)4 },
+                    new NoteOffEvent((SevenBitNumber)70, SevenBitNumber.MinValue) { DeltaTime = 50, Channel = (FourBitNumber)4 })),
+            format: MidiFileFormat.MultiTrack,
+            writingSettings: null,
+            readingSettings: new ReadingSettings
+            {
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = BufferingPolicy.UseMemoryMappedFile,
+                    BufferSize = bufferSize
+                }
+            },
+            expectedTokens: new MidiToken[]
+            {
+                new ChunkHeaderToken(HeaderChunk.Id, 6) { Position = 0, Length = 8 },
+                new FileHeaderToken((ushort)MidiFileFormat.MultiTrack, new TicksPerQuarterNoteTimeDivision(), 2) { Position = 8, Length = 6 },
+
+                new ChunkHeaderToken(TrackChunk.Id, 8) { Position = 14, Length = 8 },
+                new MidiEventToken(new ControlChangeEvent((SevenBitNumber)70, SevenBitNumber.MaxValue)) { Position = 22, Length = 4 },
+                new MidiEventToken(new EndOfTrackEvent()) { Position = 26, Length = 4 },
+
+                new ChunkHeaderToken(TrackChunk.Id, 12) { Position = 30, Length = 8 },
+                new MidiEventToken(new NoteOnEvent((SevenBitNumber)70, SevenBitNumber.MaxValue) { DeltaTime = 100, Channel = (FourBitNumber)4 }) { Position = 38, Length = 4 },
+                new MidiEventToken(new NoteOffEvent((SevenBitNumber)70, SevenBitNumber.MinValue) { DeltaTime = 50, Channel = (FourBitNumber)4 }) { Position = 42, Length = 4 },
+                new MidiEventToken(new EndOfTrackEvent()) { Position = 46, Length = 4 }
+            });
+
         [Test]
         public void ReadLazy_UnknownChunk_1() => ReadLazy(
             midiFile: new MidiFile(
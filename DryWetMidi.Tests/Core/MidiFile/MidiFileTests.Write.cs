@@ -380,6 +380,103 @@ namespace Melanchall.DryWetMidi.Tests.Core
                 });
         }
 
+        [TestCase(true)]
+        [TestCase(false)]
+        public void Write_TrackChunksOfDifferentSizes(bool useBuffering)
+        {
+            var midiFile = new MidiFile(
+                new TrackChunk(Enumerable.Range(0, 1000).Select(i => new TextEvent(i.ToString()) { DeltaTime = i })),
+                new TrackChunk(new TextEvent("A")),
+                new TrackChunk(),
+                new TrackChunk(Enumerable.Range(0, 100).Select(i => new ControlChangeEvent((SevenBitNumber)(i % 128), (SevenBitNumber)1))));
+
+            var settings = new WritingSettings
+            {
+                WriterSettings = new WriterSettings
+                {
+                    UseBuffering = useBuffering,
+                    BufferSize = 10
+                }
+            };
+
+            using (var stream = new MemoryStream())
+            {
+                midiFile.Write(stream, settings: settings);
+
+                stream.Position = 0;
+                var newMidiFile = MidiFile.Read(stream, new ReadingSettings { InvalidChunkSizePolicy = InvalidChunkSizePolicy.Abort });
+                MidiAsserts.AreEqual(midiFile, newMidiFile, false, "File is invalid.");
+            }
+        }
+
+        [TestCase(false, false, false, MidiFileFormat.MultiTrack)]
+        [TestCase(true, true, false, MidiFileFormat.MultiTrack)]
+        [TestCase(true, false, true, MidiFileFormat.MultiSequence)]
+        [TestCase(false, true, true, MidiFileFormat.SingleTrack)]
+        public void Write_MaxDegreeOfParallelism(bool useRunningStatus, bool noteOffAsSilentNoteOn, bool deleteDefaultEvents, MidiFileFormat format)
+        {
+            var settings = new WritingSettings
+            {
+                UseRunningStatus = useRunningStatus,
+                NoteOffAsSilentNoteOn = noteOffAsSilentNoteOn,
+                DeleteDefaultKeySignature = deleteDefaultEvents,
+                DeleteDefaultSetTempo = deleteDefaultEvents,
+                DeleteDefaultTimeSignature = deleteDefaultEvents,
+                DeleteUnknownChunks = deleteDefaultEvents,
+                DeleteUnknownMetaEvents = deleteDefaultEvents
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var midiFile = MidiFile.Read(filePath);
+
+                settings.MaxDegreeOfParallelism = 1;
+                var expectedBytes = WriteToBytes(midiFile, format, settings);
+
+                settings.MaxDegreeOfParallelism = 4;
+                var actualBytes = WriteToBytes(midiFile, format, settings);
+
+                CollectionAssert.AreEqual(expectedBytes, actualBytes, $"Bytes are invalid for file '{filePath}'.");
+            }
+        }
+
+        [TestCase(false, false, false)]
+        [TestCase(true, true, false)]
+        [TestCase(true, false, true)]
+        public void Write_UseCompactEventsStorage(bool useRunningStatus, bool noteOffAsSilentNoteOn, bool deleteDefaultEvents)
+        {
+            var settings = new WritingSettings
+            {
+                UseRunningStatus = useRunningStatus,
+                NoteOffAsSilentNoteOn = noteOffAsSilentNoteOn,
+                DeleteDefaultKeySignature = deleteDefaultEvents,
+                DeleteDefaultSetTempo = deleteDefaultEvents,
+                DeleteDefaultTimeSignature = deleteDefaultEvents,
+                DeleteUnknownMetaEvents = deleteDefaultEvents
+            };
+
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var midiFile = MidiFile.Read(filePath, new ReadingSettings { EndOfTrackStoringPolicy = EndOfTrackStoringPolicy.Store });
+                var expectedBytes = WriteToBytes(midiFile, MidiFileFormat.MultiTrack, settings);
+
+                var compactMidiFile = MidiFile.Read(filePath, new ReadingSettings { EndOfTrackStoringPolicy = EndOfTrackStoringPolicy.Store, UseCompactEventsStorage = true });
+                var actualBytes = WriteToBytes(compactMidiFile, MidiFileFormat.MultiTrack, settings);
+                CollectionAssert.AreEqual(expectedBytes, actualBytes, $"Bytes are invalid for file '{filePath}' read with compact events storage.");
+
+                var midiFileFromCompactTracks = new MidiFile(midiFile.Chunks.Select(c =>
+                {
+                    var trackChunk = c as TrackChunk;
+                    return trackChunk != null ? new TrackChunk(trackChunk.ToCompactTrack()) : c.Clone();
+                }))
+                {
+                    TimeDivision = midiFile.TimeDivision
+                };
+                actualBytes = WriteToBytes(midiFileFromCompactTracks, MidiFileFormat.MultiTrack, settings);
+                CollectionAssert.AreEqual(expectedBytes, actualBytes, $"Bytes are invalid for file '{filePath}' built from compact tracks.");
+            }
+        }
+
         [Test]
         public void Write_SingleTrack_EmptyCollection() => CheckWritingWithFormat_SingleTrack(
             chunks: Enumerable.Empty<MidiChunk>(),
@@ -915,6 +1012,15 @@ namespace Melanchall.DryWetMidi.Tests.Core
 
         #region Private methods
 
+        private static byte[] WriteToBytes(MidiFile midiFile, MidiFileFormat format, WritingSettings settings)
+        {
+            using (var stream = new MemoryStream())
+            {
+                midiFile.Write(stream, format, settings);
+                return stream.ToArray();
+            }
+        }
+
         private void CheckWritingWithFormat_MultiSequence(
             IEnumerable<MidiChunk> chunks,
             IEnumerable<MidiChunk> expectedChunks,
@@ -0,0 +1,124 @@
+﻿using System;
+using System.Linq;
+using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
+using Melanchall.DryWetMidi.Interaction;
+using Melanchall.DryWetMidi.Tests.Common;
+using Melanchall.DryWetMidi.Tests.Utilities;
+using NUnit.Framework;
+
+namespace Melanchall.DryWetMidi.Tests.Interaction
+{
+    [TestFixture]
+    public sealed partial class GetObjectsUtilitiesTests
+    {
+        #region Test methods
+
+        [TestCase(ObjectType.TimedEvent)]
+        [TestCase(ObjectType.Note)]
+        [TestCase(ObjectType.Chord)]
+        [TestCase(ObjectType.TimedEvent | ObjectType.Note)]
+        [TestCase(ObjectType.TimedEvent | ObjectType.Chord)]
+        [TestCase(ObjectType.TimedEvent | ObjectType.Note | ObjectType.Chord)]
+        public void ReadObjectsLazy(ObjectType objectType)
+        {
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var expectedObjects = MidiFile.Read(filePath).GetObjects(objectType);
+                var actualObjects = GetObjectsUtilities.ReadObjectsLazy(filePath, objectType).ToArray();
+
+                MidiAsserts.AreEqual(expectedObjects, actualObjects, $"Objects of file '{filePath}' are invalid.");
+            }
+        }
+
+        [TestCase(ObjectType.TimedEvent)]
+        [TestCase(ObjectType.Note)]
+        [TestCase(ObjectType.TimedEvent | ObjectType.Note | ObjectType.Chord)]
+        public void ReadObjectsLazy_CustomReadingSettings(ObjectType objectType)
+        {
+            foreach (var filePath in TestFilesProvider.GetValidFilesPaths())
+            {
+                var readingSettings = new ReadingSettings
+                {
+                    EndOfTrackStoringPolicy = EndOfTrackStoringPolicy.Store,
+                    ExtraTrackChunkPolicy = ExtraTrackChunkPolicy.Skip,
+                    UnknownChunkIdPolicy = UnknownChunkIdPolicy.Skip,
+                    StopReadingOnExpectedTrackChunksCountReached = true,
+                    ReaderSettings = new ReaderSettings
+                    {
+                        BufferingPolicy = BufferingPolicy.DontUseBuffering,
+                        BufferSize = 16
+                    }
+                };
+
+                var expectedObjects = MidiFile.Read(filePath, readingSettings).GetObjects(objectType);
+                var actualObjects = GetObjectsUtilities.ReadObjectsLazy(filePath, objectType, readingSettings: readingSettings).ToArray();
+
+                MidiAsserts.AreEqual(expectedObjects, actualObjects, $"Objects of file '{filePath}' are invalid.");
+            }
+        }
+
+        [TestCase(ExtraTrackChunkPolicy.Read, false)]
+        [TestCase(ExtraTrackChunkPolicy.Skip, false)]
+        [TestCase(ExtraTrackChunkPolicy.Read, true)]
+        [TestCase(ExtraTrackChunkPolicy.Skip, true)]
+        public void ReadObjectsLazy_UnknownAndExtraChunks(ExtraTrackChunkPolicy extraTrackChunkPolicy, bool stopReadingOnExpectedTrackChunksCountReached)
+        {
+            var midiFile = new MidiFile(Enumerable.Range(0, 4).Select(i => new TrackChunk(
+                new NoteOnEvent((SevenBitNumber)(50 + i), (SevenBitNumber)100) { DeltaTime = i * 10 },
+                new NoteOnEvent((SevenBitNumber)(60 + i), (SevenBitNumber)100) { DeltaTime = 5 },
+                new NoteOffEvent((SevenBitNumber)(50 + i), (SevenBitNumber)0) { DeltaTime = 20 },
+                new NoteOffEvent((SevenBitNumber)(60 + i), (SevenBitNumber)0) { DeltaTime = 30 })));
+
+            var readingSettings = new ReadingSettings
+            {
+                ExtraTrackChunkPolicy = extraTrackChunkPolicy,
+                UnknownChunkIdPolicy = UnknownChunkIdPolicy.Skip,
+                StopReadingOnExpectedTrackChunksCountReached = stopReadingOnExpectedTrackChunksCountReached
+            };
+
+            var filePath = FileOperations.GetTempFilePath();
+
+            try
+            {
+                midiFile.Write(filePath, format: MidiFileFormat.MultiTrack);
+
+                // Header declares two track chunks and the first track chunk turns into unknown one
+                var bytes = FileOperations.ReadAllFileBytes(filePath);
+                bytes[10] = 0;
+                bytes[11] = 2;
+                bytes[17] = Convert.ToByte('m');
+                FileOperations.WriteAllBytesToFile(filePath, bytes);
+
+                var expectedObjects = MidiFile.Read(filePath, readingSettings).GetObjects(ObjectType.Note | ObjectType.TimedEvent);
+                var actualObjects = GetObjectsUtilities.ReadObjectsLazy(filePath, ObjectType.Note | ObjectType.TimedEvent, readingSettings: readingSettings).ToArray();
+
+                MidiAsserts.AreEqual(expectedObjects, actualObjects, "Objects are invalid.");
+            }
+            finally
+            {
+                FileOperations.DeleteFile(filePath);
+            }
+        }
+
+        [Test]
+        public void ReadObjectsLazy_UseCustomBuffer()
+        {
+            var settings = new ReadingSettings
+            {
+                ReaderSettings = new ReaderSettings
+                {
+                    BufferingPolicy = BufferingPolicy.UseCustomBuffer,
+                    Buffer = new byte[1024]
+                }
+            };
+
+            Assert.Throws<ArgumentException>(() => GetObjectsUtilities.ReadObjectsLazy(
+                TestFilesProvider.GetValidFilesPaths().First(),
+                ObjectType.Note,
+                readingSettings: settings));
+        }
+
+        #endregion
+    }
+}
@@ -229,6 +229,27 @@ namespace Melanchall.DryWetMidi.Tests.Interaction
                 });
         }
 
+        [Test]
+        public void GetNotes_EventsCollection_ManyOverlapped([Values] ContainerType containerType)
+        {
+            const int notesCount = 300;
+
+            var noteOnEvents = Enumerable
+                .Range(0, notesCount)
+                .Select(i => new NoteOnEvent((SevenBitNumber)(i / 16 % 2), (SevenBitNumber)100) { Channel = (FourBitNumber)(i % 16), DeltaTime = i > 0 ? 1 : 0 });
+            var noteOffEvents = Enumerable
+                .Range(0, notesCount)
+                .Select(i => new NoteOffEvent((SevenBitNumber)(i / 16 % 2), SevenBitNumber.MinValue) { Channel = (FourBitNumber)(i % 16), DeltaTime = 1 });
+
+            GetNotes_EventsCollection(
+                containerType,
+                midiEvents: noteOnEvents.Concat<MidiEvent>(noteOffEvents).ToArray(),
+                expectedNotes: Enumerable
+                    .Range(0, notesCount)
+                    .Select(i => new Note((SevenBitNumber)(i / 16 % 2), notesCount, i) { Velocity = (SevenBitNumber)100, Channel = (FourBitNumber)(i % 16) })
+                    .ToArray());
+        }
+
         [Test]
         public void GetNotes_EventsCollection_NoteAroundEvents([Values] ContainerType containerType)
         {
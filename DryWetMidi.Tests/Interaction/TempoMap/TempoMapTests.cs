@@ -727,10 +727,97 @@ namespace Melanchall.DryWetMidi.Tests.Interaction
             }
         }
 
+        [Test]
+        public void ConvertTime_AfterChange_AtEnd()
+        {
+            using (var tempoMapManager = new TempoMapManager(new TicksPerQuarterNoteTimeDivision(96)))
+            {
+                tempoMapManager.SetTempo(100, new Tempo(300000));
+                tempoMapManager.SetTimeSignature(200, new TimeSignature(3, 8));
+
+                var tempoMap = tempoMapManager.TempoMap;
+                CheckConversions(tempoMap);
+
+                tempoMapManager.SetTempo(5000, new Tempo(700000));
+                tempoMapManager.SetTimeSignature(6000, new TimeSignature(5, 4));
+                CheckConversions(tempoMap);
+            }
+        }
+
+        [Test]
+        public void ConvertTime_AfterChange_AtMiddle()
+        {
+            using (var tempoMapManager = new TempoMapManager(new TicksPerQuarterNoteTimeDivision(96)))
+            {
+                tempoMapManager.SetTempo(100, new Tempo(300000));
+                tempoMapManager.SetTempo(3000, new Tempo(400000));
+                tempoMapManager.SetTimeSignature(200, new TimeSignature(3, 8));
+                tempoMapManager.SetTimeSignature(4000, new TimeSignature(7, 8));
+
+                var tempoMap = tempoMapManager.TempoMap;
+                CheckConversions(tempoMap);
+
+                tempoMapManager.SetTempo(1000, new Tempo(700000));
+                tempoMapManager.SetTimeSignature(1500, new TimeSignature(5, 4));
+                CheckConversions(tempoMap);
+
+                tempoMapManager.ClearTempo(1000);
+                tempoMapManager.ClearTimeSignature(200, 1500);
+                CheckConversions(tempoMap);
+            }
+        }
+
+        [Test]
+        public void ConvertTime_AfterChange_AtStart()
+        {
+            using (var tempoMapManager = new TempoMapManager(new TicksPerQuarterNoteTimeDivision(96)))
+            {
+                tempoMapManager.SetTempo(100, new Tempo(300000));
+                tempoMapManager.SetTimeSignature(200, new TimeSignature(3, 8));
+
+                var tempoMap = tempoMapManager.TempoMap;
+                CheckConversions(tempoMap);
+
+                tempoMapManager.SetTempo(0, new Tempo(700000));
+                tempoMapManager.SetTimeSignature(0, new TimeSignature(5, 4));
+                CheckConversions(tempoMap);
+
+                tempoMapManager.ClearTempoMap();
+                CheckConversions(tempoMap);
+            }
+        }
+
         #endregion
 
         #region Private methods
 
+        private static void CheckConversions(TempoMap tempoMap)
+        {
+            var expectedTempoMap = tempoMap.Clone();
+
+            for (var time = 0L; time < 10000; time += 37)
+            {
+                ClassicAssert.AreEqual(
+                    TimeConverter.ConvertTo<MetricTimeSpan>(time, expectedTempoMap),
+                    TimeConverter.ConvertTo<MetricTimeSpan>(time, tempoMap),
+                    $"Invalid metric time for {time}.");
+                ClassicAssert.AreEqual(
+                    TimeConverter.ConvertTo<BarBeatTicksTimeSpan>(time, expectedTempoMap),
+                    TimeConverter.ConvertTo<BarBeatTicksTimeSpan>(time, tempoMap),
+                    $"Invalid bar/beat time for {time}.");
+                ClassicAssert.AreEqual(
+                    LengthConverter.ConvertTo<BarBeatFractionTimeSpan>(time, 100, expectedTempoMap),
+                    LengthConverter.ConvertTo<BarBeatFractionTimeSpan>(time, 100, tempoMap),
+                    $"Invalid bar/beat length for {time}.");
+
+                var metricTime = new MetricTimeSpan(time * 1000);
+                ClassicAssert.AreEqual(
+                    TimeConverter.ConvertFrom(metricTime, expectedTempoMap),
+                    TimeConverter.ConvertFrom(metricTime, tempoMap),
+                    $"Invalid time for {metricTime}.");
+            }
+        }
+
         private static void TestSimpleTempoMap(TempoMap tempoMap,
                                                TimeDivision expectedTimeDivision,
                                                Tempo expectedTempo,
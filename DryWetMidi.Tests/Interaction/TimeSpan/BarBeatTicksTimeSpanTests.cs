@@ -521,6 +521,27 @@ namespace Melanchall.DryWetMidi.Tests.Interaction
 
         #endregion
 
+        #region ConvertMultiple
+
+        [TestCase(new long[] { 0, 10, 100, 1000, 10000, 100000 })]
+        [TestCase(new long[] { 100000, 0, 5000, 5000, 300, 70000, 10 })]
+        public void ConvertMultiple(long[] times)
+        {
+            var tempoMap = TimeSpanTestUtilities.ComplexTempoMap;
+
+            var bars = new long[times.Length];
+            var beats = new long[times.Length];
+            var ticks = new long[times.Length];
+            TimeConverter.ConvertToBarBeatTicks(times, bars, beats, ticks, tempoMap);
+
+            CollectionAssert.AreEqual(
+                times.Select(t => TimeConverter.ConvertTo<BarBeatTicksTimeSpan>(t, tempoMap)).ToArray(),
+                times.Select((t, i) => new BarBeatTicksTimeSpan(bars[i], beats[i], ticks[i])).ToArray(),
+                "Invalid bar/beat times.");
+        }
+
+        #endregion
+
         #region Parse
 
         [Test]
@@ -359,6 +359,43 @@ namespace Melanchall.DryWetMidi.Tests.Interaction
 
         #endregion
 
+        #region ConvertMultiple
+
+        [TestCase(new long[] { 0, 10, 100, 1000, 10000, 100000 })]
+        [TestCase(new long[] { 100000, 0, 5000, 5000, 300, 70000, 10 })]
+        public void ConvertMultiple(long[] times)
+        {
+            var tempoMap = TimeSpanTestUtilities.ComplexTempoMap;
+
+            var microseconds = new long[times.Length];
+            TimeConverter.ConvertToMicroseconds(times, microseconds, tempoMap);
+
+            CollectionAssert.AreEqual(
+                times.Select(t => TimeConverter.ConvertTo<MetricTimeSpan>(t, tempoMap).TotalMicroseconds).ToArray(),
+                microseconds,
+                "Invalid microseconds.");
+        }
+
+        [Test]
+        public void ConvertMultiple_NegativeTime()
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => TimeConverter.ConvertToMicroseconds(
+                new long[] { 0, -1 },
+                new long[2],
+                TimeSpanTestUtilities.ComplexTempoMap));
+        }
+
+        [Test]
+        public void ConvertMultiple_ShortOutput()
+        {
+            Assert.Throws<ArgumentException>(() => TimeConverter.ConvertToMicroseconds(
+                new long[] { 0, 1 },
+                new long[1],
+                TimeSpanTestUtilities.ComplexTempoMap));
+        }
+
+        #endregion
+
         #region Parse
 
         [TestCaseSource(nameof(ParametersForValidParseCheck))]
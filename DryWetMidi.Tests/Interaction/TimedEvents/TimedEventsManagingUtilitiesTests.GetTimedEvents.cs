@@ -2123,6 +2123,30 @@ namespace Melanchall.DryWetMidi.Tests.Interaction
                 "Invalid timed events.");
         }
 
+        [Test]
+        public void GetTimedEvents_TrackChunksCollection_ManyTrackChunks([Values(2, 10, 100)] int trackChunksCount)
+        {
+            var random = new Random(trackChunksCount);
+            var trackChunks = Enumerable
+                .Range(0, trackChunksCount)
+                .Select(i => new TrackChunk(Enumerable
+                    .Range(0, 50)
+                    .Select(j => new TextEvent($"{i}-{j}") { DeltaTime = random.Next(3) })))
+                .ToArray();
+
+            var timedEvents = trackChunks.GetTimedEvents();
+
+            var expectedTimedEvents = trackChunks
+                .SelectMany(trackChunk => trackChunk.Events.GetTimedEvents())
+                .OrderBy(e => e.Time)
+                .ToArray();
+
+            MidiAsserts.AreEqual(
+                expectedTimedEvents,
+                timedEvents,
+                "Invalid timed events.");
+        }
+
         #endregion
 
         #region Private methods
@@ -37,6 +37,8 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
 
         private static readonly TimeSpan WaitTime = TimeSpan.FromSeconds(5);
 
+        private static readonly int[] JitterHistogramBucketsBoundsInMicroseconds = { 25, 50, 100, 250, 500, 1000 };
+
         #endregion
 
         #region Fields
@@ -79,6 +81,54 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             StopTickGeneratorAndCheckIntervals(runInfo3);
         }
 
+        [Retry(3)]
+        [Test]
+        [Platform("Linux")]
+        public void CheckJitterHistogram_SubMillisecond([Values(250, 500)] int intervalInMicroseconds)
+        {
+            var timestamps = new List<long>(100000);
+
+            using (var tickGenerator = new HighPrecisionTickGenerator())
+            {
+                tickGenerator.TickGenerated += (_, __) =>
+                {
+                    lock (_lockObject)
+                    {
+                        timestamps.Add(Stopwatch.GetTimestamp());
+                    }
+                };
+
+                tickGenerator.TryStart(TimeSpan.FromTicks(intervalInMicroseconds * (TimeSpan.TicksPerMillisecond / 1000)));
+                WaitOperations.Wait(WaitTime);
+                tickGenerator.TryStop();
+            }
+
+            var deviations = new List<double>();
+
+            lock (_lockObject)
+            {
+                for (var i = 1; i < timestamps.Count; i++)
+                {
+                    var deltaInMicroseconds = (timestamps[i] - timestamps[i - 1]) * 1000000.0 / Stopwatch.Frequency;
+                    deviations.Add(Math.Abs(deltaInMicroseconds - intervalInMicroseconds));
+                }
+            }
+
+            var histogram = GetJitterHistogram(deviations);
+
+            var expectedTicksCount = WaitTime.Ticks / (intervalInMicroseconds * (TimeSpan.TicksPerMillisecond / 1000));
+            ClassicAssert.Greater(
+                deviations.Count,
+                expectedTicksCount * 0.9,
+                $"Too few ticks generated for [{intervalInMicroseconds}] us interval.{Environment.NewLine}{histogram}");
+
+            var ratio = deviations.Count(d => d <= intervalInMicroseconds / 2.0) / (double)deviations.Count;
+            ClassicAssert.Greater(
+                ratio,
+                0.9,
+                $"Count of good intervals of [{intervalInMicroseconds}] us is too low.{Environment.NewLine}{histogram}");
+        }
+
         #endregion
 
         #region Private methods
@@ -133,6 +183,22 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             ClassicAssert.Greater(ratio, 0.9, $"Count of good intervals of [{runInfo.IntervalInMs}] ms is too low (total count = [{deltas.Count}], min = [{min}], max = [{max}], average = [{average:0.##}]).");
         }
 
+        private static string GetJitterHistogram(ICollection<double> deviations)
+        {
+            var lines = new List<string>();
+            var lowerBound = 0;
+
+            foreach (var upperBound in JitterHistogramBucketsBoundsInMicroseconds)
+            {
+                var count = deviations.Count(d => d >= lowerBound && d < upperBound);
+                lines.Add($"[{lowerBound}; {upperBound}) us: {count}");
+                lowerBound = upperBound;
+            }
+
+            lines.Add($"[{lowerBound}; +inf) us: {deviations.Count(d => d >= lowerBound)}");
+            return string.Join(Environment.NewLine, lines);
+        }
+
         #endregion
     }
 }
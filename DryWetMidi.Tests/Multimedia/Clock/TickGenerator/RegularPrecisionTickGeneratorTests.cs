@@ -0,0 +1,65 @@
+﻿using System;
+using System.Threading;
+using Melanchall.DryWetMidi.Multimedia;
+using Melanchall.DryWetMidi.Tests.Common;
+using NUnit.Framework;
+using NUnit.Framework.Legacy;
+
+namespace Melanchall.DryWetMidi.Tests.Multimedia
+{
+    [TestFixture]
+    public sealed class RegularPrecisionTickGeneratorTests
+    {
+        #region Constants
+
+        private static readonly TimeSpan TickDelay = TimeSpan.FromMilliseconds(10);
+        private static readonly TimeSpan WaitTime = TimeSpan.FromMilliseconds(500);
+
+        #endregion
+
+        #region Test methods
+
+        [Test]
+        public void OneShot_SingleTickPerSchedule()
+        {
+            using (var tickGenerator = new RegularPrecisionTickGenerator())
+            {
+                var ticksCount = 0;
+                tickGenerator.TickGenerated += (_, __) => Interlocked.Increment(ref ticksCount);
+
+                tickGenerator.TryStartOneShot();
+                tickGenerator.ScheduleTick(TickDelay);
+                WaitOperations.Wait(WaitTime);
+
+                ClassicAssert.AreEqual(1, ticksCount, "Invalid ticks count after the first start.");
+
+                tickGenerator.TryStop();
+                tickGenerator.TryStartOneShot();
+                tickGenerator.ScheduleTick(TickDelay);
+                WaitOperations.Wait(WaitTime);
+
+                ClassicAssert.AreEqual(2, ticksCount, "Invalid ticks count after restart.");
+            }
+        }
+
+        [Test]
+        public void OneShot_ScheduleTickAfterStop()
+        {
+            using (var tickGenerator = new RegularPrecisionTickGenerator())
+            {
+                var ticksCount = 0;
+                tickGenerator.TickGenerated += (_, __) => Interlocked.Increment(ref ticksCount);
+
+                tickGenerator.TryStartOneShot();
+                tickGenerator.ScheduleTick(TickDelay);
+                tickGenerator.TryStop();
+                tickGenerator.ScheduleTick(TickDelay);
+                WaitOperations.Wait(WaitTime);
+
+                ClassicAssert.AreEqual(0, ticksCount, "Tick generated after stop.");
+            }
+        }
+
+        #endregion
+    }
+}
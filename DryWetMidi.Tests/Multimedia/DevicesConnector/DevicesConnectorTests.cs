@@ -93,6 +93,115 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
                 new SentReceivedEvent(new NoteOffEvent { NoteNumber = (SevenBitNumber)70 }, TimeSpan.FromMilliseconds(500)),
             });
 
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckEventsReceivingWithNativeRouting_DefaultSettings() => CheckEventsReceivingWithNativeRouting(
+            eventsToSend: new[]
+            {
+                new EventToSend(new NoteOnEvent((SevenBitNumber)100, (SevenBitNumber)20) { Channel = (FourBitNumber)5 }, TimeSpan.Zero),
+                new EventToSend(new NoteOffEvent((SevenBitNumber)100, (SevenBitNumber)10) { Channel = (FourBitNumber)5 }, TimeSpan.FromMilliseconds(500)),
+                new EventToSend(new SongSelectEvent((SevenBitNumber)20), TimeSpan.Zero),
+                new EventToSend(new TuneRequestEvent(), TimeSpan.FromMilliseconds(200)),
+            },
+            nativeRoutingSettings: new DevicesConnectorNativeRoutingSettings(),
+            expectedReceivedEvents: new[]
+            {
+                new SentReceivedEvent(new NoteOnEvent((SevenBitNumber)100, (SevenBitNumber)20) { Channel = (FourBitNumber)5 }, TimeSpan.Zero),
+                new SentReceivedEvent(new NoteOffEvent((SevenBitNumber)100, (SevenBitNumber)10) { Channel = (FourBitNumber)5 }, TimeSpan.FromMilliseconds(500)),
+                new SentReceivedEvent(new SongSelectEvent((SevenBitNumber)20), TimeSpan.FromMilliseconds(500)),
+                new SentReceivedEvent(new TuneRequestEvent(), TimeSpan.FromMilliseconds(700)),
+            });
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckEventsReceivingWithNativeRouting_Filters() => CheckEventsReceivingWithNativeRouting(
+            eventsToSend: new[]
+            {
+                new EventToSend(new NoteOnEvent((SevenBitNumber)50, (SevenBitNumber)20), TimeSpan.Zero),
+                new EventToSend(new NoteOnEvent((SevenBitNumber)60, (SevenBitNumber)20) { Channel = (FourBitNumber)1 }, TimeSpan.FromMilliseconds(100)),
+                new EventToSend(new NoteOnEvent((SevenBitNumber)60, (SevenBitNumber)20) { Channel = (FourBitNumber)2 }, TimeSpan.FromMilliseconds(100)),
+                new EventToSend(new NoteOnEvent((SevenBitNumber)120, (SevenBitNumber)20), TimeSpan.FromMilliseconds(100)),
+                new EventToSend(new PitchBendEvent(100), TimeSpan.FromMilliseconds(100)),
+                new EventToSend(new ControlChangeEvent((SevenBitNumber)7, (SevenBitNumber)70), TimeSpan.FromMilliseconds(100)),
+                new EventToSend(new StartEvent(), TimeSpan.FromMilliseconds(100)),
+                new EventToSend(new NoteOffEvent((SevenBitNumber)50, (SevenBitNumber)0), TimeSpan.FromMilliseconds(100)),
+            },
+            nativeRoutingSettings: new DevicesConnectorNativeRoutingSettings
+            {
+                Channels = new[] { (FourBitNumber)0, (FourBitNumber)1 },
+                EventTypes = new[] { MidiEventType.NoteOn, MidiEventType.NoteOff, MidiEventType.ControlChange },
+                ChannelsMapping = new Dictionary<FourBitNumber, FourBitNumber> { [(FourBitNumber)1] = (FourBitNumber)9 },
+                NotesMapping = new Dictionary<SevenBitNumber, SevenBitNumber> { [(SevenBitNumber)60] = (SevenBitNumber)36 },
+                Transpose = 12
+            },
+            expectedReceivedEvents: new[]
+            {
+                new SentReceivedEvent(new NoteOnEvent((SevenBitNumber)62, (SevenBitNumber)20), TimeSpan.Zero),
+                new SentReceivedEvent(new NoteOnEvent((SevenBitNumber)48, (SevenBitNumber)20) { Channel = (FourBitNumber)9 }, TimeSpan.FromMilliseconds(100)),
+                new SentReceivedEvent(new ControlChangeEvent((SevenBitNumber)7, (SevenBitNumber)70), TimeSpan.FromMilliseconds(500)),
+                new SentReceivedEvent(new NoteOffEvent((SevenBitNumber)62, (SevenBitNumber)0), TimeSpan.FromMilliseconds(700)),
+            });
+
+        [Test]
+        public void Connect_NativeRouting_NotNativeDevices()
+        {
+            var inputA = TestDeviceManager.GetInputDevice(MidiDevicesNames.DeviceA);
+            var outputB = TestDeviceManager.GetOutputDevice(MidiDevicesNames.DeviceB);
+
+            var devicesConnector = new DevicesConnector(inputA, outputB)
+            {
+                NativeRoutingSettings = new DevicesConnectorNativeRoutingSettings()
+            };
+
+            ClassicAssert.Throws<InvalidOperationException>(() => devicesConnector.Connect(), "Exception is not thrown.");
+            ClassicAssert.IsFalse(devicesConnector.AreDevicesConnected, "Devices are connected.");
+        }
+
+        [Test]
+        public void Connect_NativeRouting_UnsupportedEventType()
+        {
+            using (var inputA = InputDevice.GetByName(MidiDevicesNames.DeviceA))
+            using (var outputB = OutputDevice.GetByName(MidiDevicesNames.DeviceB))
+            {
+                var devicesConnector = new DevicesConnector(inputA, outputB)
+                {
+                    NativeRoutingSettings = new DevicesConnectorNativeRoutingSettings
+                    {
+                        EventTypes = new[] { MidiEventType.NormalSysEx }
+                    }
+                };
+
+                ClassicAssert.Throws<InvalidOperationException>(() => devicesConnector.Connect(), "Exception is not thrown.");
+                ClassicAssert.IsFalse(devicesConnector.AreDevicesConnected, "Devices are connected.");
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckNativeRoutingLatency()
+        {
+            const int eventsCount = 500;
+
+            var nativeLatency = MeasureRoutingLatency(new DevicesConnectorNativeRoutingSettings(), eventsCount);
+            ClassicAssert.LessOrEqual(
+                nativeLatency,
+                MaximumEventSendReceiveDelay,
+                $"Native routing median latency ({nativeLatency.TotalMilliseconds} ms) is too high for {eventsCount} events.");
+        }
+
+        [Explicit("Latencies depend on the machine load, so the test only reports them.")]
+        [Test]
+        public void CompareManagedAndNativeRoutingLatency()
+        {
+            const int eventsCount = 500;
+
+            var managedLatency = MeasureRoutingLatency(null, eventsCount);
+            var nativeLatency = MeasureRoutingLatency(new DevicesConnectorNativeRoutingSettings(), eventsCount);
+
+            TestContext.WriteLine($"Managed routing median latency for {eventsCount} events: {managedLatency.TotalMilliseconds} ms.");
+            TestContext.WriteLine($"Native routing median latency for {eventsCount} events: {nativeLatency.TotalMilliseconds} ms.");
+        }
+
         #endregion
 
         #region Private methods
@@ -206,6 +315,119 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             SendReceiveUtilities.CheckReceivedEvents(receivedEventsC, expectedReceivedEvents, MaximumEventSendReceiveDelay);
         }
 
+        private static void CheckEventsReceivingWithNativeRouting(
+            IReadOnlyList<EventToSend> eventsToSend,
+            DevicesConnectorNativeRoutingSettings nativeRoutingSettings,
+            IReadOnlyList<SentReceivedEvent> expectedReceivedEvents)
+        {
+            var receivedEventsB = new List<SentReceivedEvent>();
+            var receivedEventsC = new List<SentReceivedEvent>();
+
+            var stopwatch = new Stopwatch();
+
+            using (var outputA = OutputDevice.GetByName(MidiDevicesNames.DeviceA))
+            using (var inputB = InputDevice.GetByName(MidiDevicesNames.DeviceB))
+            using (var inputC = InputDevice.GetByName(MidiDevicesNames.DeviceC))
+            {
+                inputB.EventReceived += (_, e) => receivedEventsB.Add(new SentReceivedEvent(e.Event, stopwatch.Elapsed));
+                inputB.StartEventsListening();
+
+                inputC.EventReceived += (_, e) => receivedEventsC.Add(new SentReceivedEvent(e.Event, stopwatch.Elapsed));
+                inputC.StartEventsListening();
+
+                using (var inputA = InputDevice.GetByName(MidiDevicesNames.DeviceA))
+                using (var outputB = OutputDevice.GetByName(MidiDevicesNames.DeviceB))
+                using (var outputC = OutputDevice.GetByName(MidiDevicesNames.DeviceC))
+                {
+                    inputA.StartEventsListening();
+
+                    var devicesConnector = new DevicesConnector(inputA, outputB, outputC)
+                    {
+                        NativeRoutingSettings = nativeRoutingSettings
+                    };
+                    devicesConnector.Connect();
+                    ClassicAssert.IsTrue(devicesConnector.AreDevicesConnected, "Devices aren't connected.");
+
+                    stopwatch.Start();
+                    SendReceiveUtilities.SendEvents(eventsToSend, outputA);
+
+                    var timeout = TimeSpan.FromTicks(eventsToSend.Sum(e => e.Delay.Ticks)) + SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                    var areEventsReceived = WaitOperations.Wait(
+                        () => receivedEventsB.Count == expectedReceivedEvents.Count && receivedEventsC.Count == expectedReceivedEvents.Count,
+                        timeout);
+                    ClassicAssert.IsTrue(areEventsReceived, $"Events are not received for timeout {timeout}.");
+
+                    devicesConnector.Disconnect();
+                    ClassicAssert.IsFalse(devicesConnector.AreDevicesConnected, "Devices aren't disconnected.");
+
+                    outputA.SendEvent(new NoteOnEvent());
+                    WaitOperations.Wait(MaximumEventSendReceiveDelay);
+                    stopwatch.Stop();
+                }
+            }
+
+            SendReceiveUtilities.CheckReceivedEvents(receivedEventsB, expectedReceivedEvents, MaximumEventSendReceiveDelay);
+            SendReceiveUtilities.CheckReceivedEvents(receivedEventsC, expectedReceivedEvents, MaximumEventSendReceiveDelay);
+        }
+
+        private static TimeSpan MeasureRoutingLatency(DevicesConnectorNativeRoutingSettings nativeRoutingSettings, int eventsCount)
+        {
+            var latencies = new List<TimeSpan>();
+            var sendingTimes = new TimeSpan[eventsCount];
+
+            var stopwatch = Stopwatch.StartNew();
+
+            using (var outputA = OutputDevice.GetByName(MidiDevicesNames.DeviceA))
+            using (var inputB = InputDevice.GetByName(MidiDevicesNames.DeviceB))
+            {
+                inputB.EventReceived += (_, e) =>
+                {
+                    var noteOnEvent = (NoteOnEvent)e.Event;
+                    var latency = stopwatch.Elapsed - sendingTimes[noteOnEvent.NoteNumber * 127 + noteOnEvent.Velocity - 1];
+
+                    lock (latencies)
+                        latencies.Add(latency);
+                };
+                inputB.StartEventsListening();
+
+                using (var inputA = InputDevice.GetByName(MidiDevicesNames.DeviceA))
+                using (var outputB = OutputDevice.GetByName(MidiDevicesNames.DeviceB))
+                {
+                    inputA.StartEventsListening();
+
+                    var devicesConnector = new DevicesConnector(inputA, outputB)
+                    {
+                        NativeRoutingSettings = nativeRoutingSettings
+                    };
+                    devicesConnector.Connect();
+
+                    for (var i = 0; i < eventsCount; i++)
+                    {
+                        sendingTimes[i] = stopwatch.Elapsed;
+                        outputA.SendEvent(new NoteOnEvent((SevenBitNumber)(i / 127), (SevenBitNumber)(i % 127 + 1)));
+                        WaitOperations.Wait(TimeSpan.FromMilliseconds(1));
+                    }
+
+                    var areEventsReceived = WaitOperations.Wait(
+                        () =>
+                        {
+                            lock (latencies)
+                                return latencies.Count == eventsCount;
+                        },
+                        TimeSpan.FromSeconds(5));
+                    ClassicAssert.IsTrue(areEventsReceived, "Events are not received.");
+
+                    devicesConnector.Disconnect();
+                }
+            }
+
+            lock (latencies)
+            {
+                latencies.Sort();
+                return latencies[latencies.Count / 2];
+            }
+        }
+
         #endregion
     }
 }
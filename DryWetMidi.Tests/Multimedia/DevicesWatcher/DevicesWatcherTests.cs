@@ -9,7 +9,7 @@ using NUnit.Framework.Legacy;
 namespace Melanchall.DryWetMidi.Tests.Multimedia
 {
     [TestFixture]
-    [Platform("MacOsX")]
+    [Platform("MacOsX,Linux")]
     public sealed class DevicesWatcherTests
     {
         #region Test methods
@@ -0,0 +1,198 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
+using Melanchall.DryWetMidi.Multimedia;
+using Melanchall.DryWetMidi.Tests.Common;
+using Melanchall.DryWetMidi.Tests.Utilities;
+using NUnit.Framework;
+using NUnit.Framework.Legacy;
+
+namespace Melanchall.DryWetMidi.Tests.Multimedia
+{
+    [TestFixture]
+    public sealed partial class InputDeviceTests
+    {
+        #region Test methods
+
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void ReceiveEvents_DispatchThread()
+        {
+            var eventsToSend = GetEventsForBufferedReceiving(100);
+
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            using (var outputDevice = OutputDevice.GetByName(virtualDevice.Name))
+            {
+                inputDevice.ReceivingMode = InputDeviceReceivingMode.DispatchThread;
+
+                var receivedEvents = new List<MidiEvent>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                        receivedEvents.Add(e.Event);
+                };
+
+                inputDevice.StartEventsListening();
+
+                foreach (var midiEvent in eventsToSend)
+                {
+                    outputDevice.SendEvent(midiEvent);
+                }
+
+                var timeout = SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                var areEventsReceived = WaitOperations.Wait(
+                    () =>
+                    {
+                        lock (receivedEvents)
+                            return receivedEvents.Count >= eventsToSend.Length;
+                    },
+                    timeout);
+                ClassicAssert.IsTrue(areEventsReceived, $"Events are not received for [{timeout}].");
+
+                inputDevice.StopEventsListening();
+
+                MidiAsserts.AreEqual(eventsToSend, receivedEvents, false, "Received events are invalid.");
+                ClassicAssert.AreEqual(0, inputDevice.BufferOverflowsCount, "Overflows count is invalid.");
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void ReadEvents_Polling()
+        {
+            var eventsToSend = GetEventsForBufferedReceiving(100);
+
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            using (var outputDevice = OutputDevice.GetByName(virtualDevice.Name))
+            {
+                inputDevice.ReceivingMode = InputDeviceReceivingMode.Polling;
+
+                var eventReceivedRaised = false;
+                inputDevice.EventReceived += (_, e) => eventReceivedRaised = true;
+
+                inputDevice.StartEventsListening();
+
+                foreach (var midiEvent in eventsToSend)
+                {
+                    outputDevice.SendEvent(midiEvent);
+                }
+
+                var receivedEvents = new List<MidiEvent>();
+                var buffer = new MidiEvent[7];
+
+                var timeout = SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                var areEventsReceived = WaitOperations.Wait(
+                    () =>
+                    {
+                        var eventsCount = inputDevice.ReadEvents(buffer);
+                        receivedEvents.AddRange(buffer.Take(eventsCount));
+                        return receivedEvents.Count >= eventsToSend.Length;
+                    },
+                    timeout);
+                ClassicAssert.IsTrue(areEventsReceived, $"Events are not received for [{timeout}].");
+
+                inputDevice.StopEventsListening();
+
+                MidiAsserts.AreEqual(eventsToSend, receivedEvents, false, "Received events are invalid.");
+                ClassicAssert.IsFalse(eventReceivedRaised, "EventReceived raised in polling mode.");
+                ClassicAssert.AreEqual(0, inputDevice.BufferOverflowsCount, "Overflows count is invalid.");
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void ReadEvents_Polling_Overflow()
+        {
+            const int eventsCount = 100;
+
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            using (var outputDevice = OutputDevice.GetByName(virtualDevice.Name))
+            {
+                inputDevice.ReceivingMode = InputDeviceReceivingMode.Polling;
+                inputDevice.ReceivingBufferSize = 1024;
+                inputDevice.StartEventsListening();
+
+                for (var i = 0; i < eventsCount; i++)
+                {
+                    outputDevice.SendEvent(new NoteOnEvent((SevenBitNumber)(i % 128), (SevenBitNumber)100));
+                }
+
+                var timeout = SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                var overflowsOccurred = WaitOperations.Wait(() => inputDevice.BufferOverflowsCount > 0, timeout);
+                ClassicAssert.IsTrue(overflowsOccurred, $"Overflows are not occurred for [{timeout}].");
+
+                WaitOperations.Wait(TimeSpan.FromMilliseconds(500));
+
+                var receivedEventsCount = 0;
+                var buffer = new MidiEvent[eventsCount];
+
+                int readEventsCount;
+                while ((readEventsCount = inputDevice.ReadEvents(buffer)) > 0)
+                {
+                    receivedEventsCount += readEventsCount;
+                }
+
+                // Every record takes 3 bytes of a Note On event plus 16-byte header rounded up to 24 bytes
+                ClassicAssert.AreEqual(1024 / 24, receivedEventsCount, "Received events count is invalid.");
+                ClassicAssert.AreEqual(eventsCount - receivedEventsCount, inputDevice.BufferOverflowsCount, "Overflows count is invalid.");
+            }
+        }
+
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void ReadEvents_NotPollingMode()
+        {
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            {
+                ClassicAssert.Throws<InvalidOperationException>(() => inputDevice.ReadEvents(new MidiEvent[1]), "Exception is not thrown.");
+            }
+        }
+
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void SetReceivingMode_AfterListeningStarted()
+        {
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            {
+                inputDevice.StartEventsListening();
+                inputDevice.StopEventsListening();
+
+                ClassicAssert.Throws<InvalidOperationException>(() => inputDevice.ReceivingMode = InputDeviceReceivingMode.Polling, "Exception is not thrown for mode.");
+                ClassicAssert.Throws<InvalidOperationException>(() => inputDevice.ReceivingBufferSize = 4096, "Exception is not thrown for buffer size.");
+            }
+        }
+
+        #endregion
+
+        #region Private methods
+
+        private static VirtualDevice GetVirtualDevice()
+        {
+            var deviceName = Guid.NewGuid().ToString().Replace("-", string.Empty).Substring(0, 10);
+            return VirtualDevice.Create(deviceName);
+        }
+
+        private static MidiEvent[] GetEventsForBufferedReceiving(int shortEventsCount)
+        {
+            return Enumerable
+                .Range(0, shortEventsCount)
+                .Select(i => i % 2 == 0
+                    ? (MidiEvent)new NoteOnEvent((SevenBitNumber)(i % 128), (SevenBitNumber)100)
+                    : new ControlChangeEvent((SevenBitNumber)(i % 128), (SevenBitNumber)50))
+                .Concat(new[] { new NormalSysExEvent(Enumerable.Range(0, 3000).Select(i => (byte)(i % 128)).Concat(new byte[] { 0xF7 }).ToArray()) })
+                .ToArray();
+        }
+
+        #endregion
+    }
+}
@@ -305,6 +305,108 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             }
         }
 
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void ReceiveEvents_LargeSysExMixedWithShortEvents()
+        {
+            var largeSysExData = Enumerable.Range(0, 150000).Select(i => (byte)(i % 128)).Concat(new byte[] { 0xF7 }).ToArray();
+            var smallSysExData = Enumerable.Range(0, 300).Select(i => (byte)(i % 128)).Concat(new byte[] { 0xF7 }).ToArray();
+
+            var eventsToSend = Enumerable
+                .Range(0, 5)
+                .SelectMany(i => new MidiEvent[]
+                {
+                    new NormalSysExEvent(largeSysExData),
+                    new NoteOnEvent((SevenBitNumber)i, (SevenBitNumber)100),
+                    new NormalSysExEvent(smallSysExData),
+                })
+                .ToArray();
+
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            using (var outputDevice = OutputDevice.GetByName(virtualDevice.Name))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                        receivedEvents.Add(e.Event);
+                };
+
+                inputDevice.StartEventsListening();
+
+                foreach (var midiEvent in eventsToSend)
+                {
+                    outputDevice.SendEvent(midiEvent);
+                }
+
+                var timeout = SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                var areEventsReceived = WaitOperations.Wait(
+                    () =>
+                    {
+                        lock (receivedEvents)
+                            return receivedEvents.Count >= eventsToSend.Length;
+                    },
+                    timeout);
+                ClassicAssert.IsTrue(areEventsReceived, $"Events are not received for [{timeout}].");
+
+                inputDevice.StopEventsListening();
+
+                MidiAsserts.AreEqual(eventsToSend, receivedEvents, false, "Received events are invalid.");
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void ReceiveEvents_Timestamps()
+        {
+            const int eventsCount = 5;
+            var delay = TimeSpan.FromMilliseconds(100);
+
+            using (var virtualDevice = GetVirtualDevice())
+            using (var inputDevice = InputDevice.GetByName(virtualDevice.Name))
+            using (var outputDevice = OutputDevice.GetByName(virtualDevice.Name))
+            {
+                var timestamps = new List<long?>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (timestamps)
+                        timestamps.Add(e.Timestamp);
+                };
+
+                inputDevice.StartEventsListening();
+
+                for (var i = 0; i < eventsCount; i++)
+                {
+                    outputDevice.SendEvent(new NoteOnEvent((SevenBitNumber)i, (SevenBitNumber)100));
+                    WaitOperations.Wait(delay);
+                }
+
+                var timeout = SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                var areEventsReceived = WaitOperations.Wait(
+                    () =>
+                    {
+                        lock (timestamps)
+                            return timestamps.Count >= eventsCount;
+                    },
+                    timeout);
+                ClassicAssert.IsTrue(areEventsReceived, $"Events are not received for [{timeout}].");
+
+                inputDevice.StopEventsListening();
+
+                CollectionAssert.AllItemsAreNotNull(timestamps, "There are events without timestamp.");
+
+                for (var i = 1; i < timestamps.Count; i++)
+                {
+                    var difference = TimeSpan.FromTicks((timestamps[i].Value - timestamps[i - 1].Value) / 100);
+                    ClassicAssert.GreaterOrEqual(difference, delay - SendReceiveUtilities.MaximumEventSendReceiveDelay, $"Difference between timestamps {i - 1} and {i} is too small.");
+                    ClassicAssert.LessOrEqual(difference, delay + SendReceiveUtilities.MaximumEventSendReceiveDelay, $"Difference between timestamps {i - 1} and {i} is too big.");
+                }
+            }
+        }
+
         #endregion
 
         #region Private methods
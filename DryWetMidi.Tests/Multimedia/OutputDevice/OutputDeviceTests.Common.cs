@@ -88,6 +88,58 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
                     .ToArray()));
         }
 
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void SendEvent_SysEx_BufferPoolReused()
+        {
+            using (var outputDevice = GetUserOutputDevice())
+            {
+                for (var i = 0; i < 50; i++)
+                {
+                    outputDevice.SendEvent(new NormalSysExEvent(new byte[] { (byte)i, 0x40, 0xF7 }));
+                }
+
+                long acquisitionsCount;
+                long reusesCount;
+                long exhaustionsCount;
+                outputDevice.GetSysExBufferPoolCounters(out acquisitionsCount, out reusesCount, out exhaustionsCount);
+
+                ClassicAssert.AreEqual(50, acquisitionsCount, "Acquisitions count is invalid.");
+                ClassicAssert.AreEqual(49, reusesCount, "Reuses count is invalid.");
+                ClassicAssert.AreEqual(0, exhaustionsCount, "Exhaustions count is invalid.");
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        [Platform("MacOsX,Linux")]
+        public void SendEvent_SysEx_BufferPoolExhausted()
+        {
+            var sysExEvent = new NormalSysExEvent(
+                Enumerable
+                    .Range(0, 100000)
+                    .Select(i => (byte)(i % 100))
+                    .Concat(new byte[] { 0xF7 })
+                    .ToArray());
+
+            SendEvent(sysExEvent);
+
+            using (var outputDevice = GetUserOutputDevice())
+            {
+                outputDevice.SendEvent(sysExEvent);
+
+                long acquisitionsCount;
+                long reusesCount;
+                long exhaustionsCount;
+                outputDevice.GetSysExBufferPoolCounters(out acquisitionsCount, out reusesCount, out exhaustionsCount);
+
+                ClassicAssert.AreEqual(1, acquisitionsCount, "Acquisitions count is invalid.");
+                ClassicAssert.AreEqual(0, reusesCount, "Reuses count is invalid.");
+                ClassicAssert.AreEqual(1, exhaustionsCount, "Exhaustions count is invalid.");
+            }
+        }
+
         [Retry(RetriesNumber)]
         [TestCase(MidiEventType.ActiveSensing)]
         [TestCase(MidiEventType.Continue)]
@@ -123,6 +175,184 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             SendEvent(midiEvent);
         }
 
+        [Retry(RetriesNumber)]
+        [Test]
+        public void SendEvents_Short()
+        {
+            SendEvents(Enumerable
+                .Range(0, 1000)
+                .Select(i => new NoteOnEvent((SevenBitNumber)(i % 128), (SevenBitNumber)(i % 100 + 1)) { Channel = (FourBitNumber)(i % 16) })
+                .ToArray());
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void SendEvents_ShortAndSysEx()
+        {
+            SendEvents(GetNonDefaultShortEvents()
+                .Concat(new[] { new NormalSysExEvent(new byte[] { 0x5F, 0x40, 0xF7 }) })
+                .Concat(GetNonDefaultShortEvents())
+                .Concat(new[] { new NormalSysExEvent(new byte[] { 0x6F, 0x50, 0xF7 }) })
+                .ToArray());
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void ScheduleEvent()
+        {
+            var deviceName = MidiDevicesNames.DeviceA;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            using (var inputDevice = InputDevice.GetByName(deviceName))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                var receivingTimestamps = new List<long>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                    {
+                        receivedEvents.Add(e.Event);
+                        receivingTimestamps.Add(MidiDevice.GetCurrentTimestamp());
+                    }
+                };
+
+                inputDevice.StartEventsListening();
+
+                var midiEvents = new MidiEvent[]
+                {
+                    new NoteOnEvent((SevenBitNumber)10, (SevenBitNumber)20),
+                    new ControlChangeEvent((SevenBitNumber)30, (SevenBitNumber)40),
+                    new NoteOffEvent((SevenBitNumber)10, (SevenBitNumber)0),
+                };
+
+                var startTimestamp = MidiDevice.GetCurrentTimestamp();
+                var delays = new[] { TimeSpan.FromMilliseconds(300), TimeSpan.FromMilliseconds(100), TimeSpan.FromMilliseconds(200) };
+                var timestamps = delays.Select(d => startTimestamp + d.Ticks * 100).ToArray();
+
+                for (var i = 0; i < midiEvents.Length; i++)
+                {
+                    outputDevice.ScheduleEvent(midiEvents[i], timestamps[i]);
+                }
+
+                var timeout = delays.Max() + SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                var areEventsReceived = WaitOperations.Wait(() => receivedEvents.Count >= midiEvents.Length, timeout);
+                ClassicAssert.IsTrue(areEventsReceived, "Events are not received.");
+
+                MidiAsserts.AreEqual(
+                    new[] { midiEvents[1], midiEvents[2], midiEvents[0] },
+                    receivedEvents,
+                    false,
+                    "Received events are invalid.");
+
+                var expectedTimestamps = new[] { timestamps[1], timestamps[2], timestamps[0] };
+                var maximumDelay = SendReceiveUtilities.MaximumEventSendReceiveDelay.Ticks * 100;
+
+                for (var i = 0; i < expectedTimestamps.Length; i++)
+                {
+                    var delay = receivingTimestamps[i] - expectedTimestamps[i];
+                    ClassicAssert.IsTrue(delay >= 0 && delay <= maximumDelay, $"Event {i} is received with invalid delay of {delay} ns.");
+                }
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void ScheduleEvent_Cancel()
+        {
+            var deviceName = MidiDevicesNames.DeviceA;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            using (var inputDevice = InputDevice.GetByName(deviceName))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                        receivedEvents.Add(e.Event);
+                };
+
+                inputDevice.StartEventsListening();
+
+                var startTimestamp = MidiDevice.GetCurrentTimestamp();
+                outputDevice.ScheduleEvent(new NoteOnEvent((SevenBitNumber)10, (SevenBitNumber)20), startTimestamp + TimeSpan.FromMilliseconds(100).Ticks * 100);
+                outputDevice.ScheduleEvent(new NoteOffEvent((SevenBitNumber)10, (SevenBitNumber)0), startTimestamp + TimeSpan.FromMilliseconds(500).Ticks * 100);
+
+                var isEventReceived = WaitOperations.Wait(() => receivedEvents.Count > 0, TimeSpan.FromMilliseconds(400));
+                ClassicAssert.IsTrue(isEventReceived, "First event is not received.");
+
+                outputDevice.CancelScheduledEvents();
+
+                WaitOperations.Wait(TimeSpan.FromMilliseconds(600));
+                MidiAsserts.AreEqual(
+                    new[] { new NoteOnEvent((SevenBitNumber)10, (SevenBitNumber)20) },
+                    receivedEvents,
+                    false,
+                    "Received events are invalid.");
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void ScheduleEvent_CancelByToken()
+        {
+            var deviceName = MidiDevicesNames.DeviceA;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            using (var inputDevice = InputDevice.GetByName(deviceName))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                        receivedEvents.Add(e.Event);
+                };
+
+                inputDevice.StartEventsListening();
+
+                var token = OutputDevice.GetNewScheduledEventsToken();
+                var otherToken = OutputDevice.GetNewScheduledEventsToken();
+
+                var timestamp = MidiDevice.GetCurrentTimestamp() + TimeSpan.FromMilliseconds(200).Ticks * 100;
+                outputDevice.ScheduleEvent(new NoteOnEvent((SevenBitNumber)10, (SevenBitNumber)20), timestamp);
+                outputDevice.ScheduleEvent(new NoteOnEvent((SevenBitNumber)30, (SevenBitNumber)40), timestamp, token);
+                outputDevice.ScheduleEvent(new NoteOnEvent((SevenBitNumber)50, (SevenBitNumber)60), timestamp, otherToken);
+
+                outputDevice.CancelScheduledEvents(token);
+
+                WaitOperations.Wait(TimeSpan.FromMilliseconds(400));
+                MidiAsserts.AreEqual(
+                    new[]
+                    {
+                        new NoteOnEvent((SevenBitNumber)10, (SevenBitNumber)20),
+                        new NoteOnEvent((SevenBitNumber)50, (SevenBitNumber)60)
+                    },
+                    receivedEvents,
+                    false,
+                    "Received events are invalid.");
+            }
+        }
+
+        [Test]
+        public void ScheduleEvent_SysEx()
+        {
+            using (var outputDevice = GetUserOutputDevice())
+            {
+                ClassicAssert.Throws<ArgumentException>(
+                    () => outputDevice.ScheduleEvent(new NormalSysExEvent(new byte[] { 0x5F, 0xF7 }), MidiDevice.GetCurrentTimestamp()),
+                    "System exclusive event is scheduled.");
+            }
+        }
+
+        [Test]
+        public void SendEvents_Null()
+        {
+            using (var outputDevice = GetUserOutputDevice())
+            {
+                ClassicAssert.Throws<ArgumentNullException>(() => outputDevice.SendEvents(null), "Null collection is accepted.");
+                ClassicAssert.Throws<ArgumentException>(() => outputDevice.SendEvents(new MidiEvent[] { new NoteOnEvent(), null }), "Collection with null is accepted.");
+            }
+        }
+
         [Test]
         public void OutputDeviceIsReleasedByDispose()
         {
@@ -285,6 +515,56 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             }
         }
 
+        private void SendEvents(ICollection<MidiEvent> midiEvents)
+        {
+            var deviceName = MidiDevicesNames.DeviceA;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            {
+                var eventsSent = new List<MidiEvent>();
+                outputDevice.EventSent += (_, e) =>
+                {
+                    lock (eventsSent)
+                        eventsSent.Add(e.Event);
+                };
+
+                using (var inputDevice = InputDevice.GetByName(deviceName))
+                {
+                    var eventsReceived = new List<MidiEvent>();
+                    inputDevice.EventReceived += (_, e) =>
+                    {
+                        lock (eventsReceived)
+                            eventsReceived.Add(e.Event);
+                    };
+
+                    inputDevice.StartEventsListening();
+
+                    outputDevice.PrepareForEventsSending();
+                    outputDevice.SendEvents(midiEvents);
+
+                    var timeout = SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                    var areEventsSentReceived = WaitOperations.Wait(
+                        () =>
+                        {
+                            lock (eventsSent)
+                            lock (eventsReceived)
+                                return eventsSent.Count >= midiEvents.Count && eventsReceived.Count >= midiEvents.Count;
+                        },
+                        timeout);
+                    ClassicAssert.IsTrue(areEventsSentReceived, "Events either not sent ot not received.");
+
+                    // On Windows EventSent for a system exclusive event is raised asynchronously
+                    // so only the order of short events is checked for sent events
+                    MidiAsserts.AreEqual(
+                        midiEvents.Where(e => !(e is SysExEvent)).ToArray(),
+                        eventsSent.Where(e => !(e is SysExEvent)).ToArray(),
+                        false,
+                        "Sent events are invalid.");
+                    MidiAsserts.AreEqual(midiEvents, eventsReceived, false, "Received events are invalid.");
+                }
+            }
+        }
+
         #endregion
     }
 }
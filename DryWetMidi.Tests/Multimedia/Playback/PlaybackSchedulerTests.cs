@@ -0,0 +1,80 @@
+﻿using System;
+using System.Threading;
+using Melanchall.DryWetMidi.Multimedia;
+using Melanchall.DryWetMidi.Tests.Common;
+using NUnit.Framework;
+using NUnit.Framework.Legacy;
+
+namespace Melanchall.DryWetMidi.Tests.Multimedia
+{
+    [TestFixture]
+    public sealed class PlaybackSchedulerTests
+    {
+        #region Constants
+
+        private static readonly TimeSpan TickDelay = TimeSpan.FromMilliseconds(10);
+        private static readonly TimeSpan HandlerTime = TimeSpan.FromMilliseconds(200);
+        private static readonly TimeSpan WaitTime = TimeSpan.FromMilliseconds(500);
+
+        #endregion
+
+        #region Test methods
+
+        [Test]
+        public void TickHandlerException_ErrorOccurred()
+        {
+            using (var scheduler = new PlaybackScheduler(1))
+            {
+                Exception reportedException = null;
+                scheduler.ErrorOccurred += (_, e) => reportedException = e.Exception;
+
+                var exception = new InvalidOperationException("Tick handler error.");
+
+                using (var faultyTickGenerator = scheduler.CreateTickGenerator())
+                using (var tickGenerator = scheduler.CreateTickGenerator())
+                {
+                    var ticksCount = 0;
+                    faultyTickGenerator.TickGenerated += (_, __) => { throw exception; };
+                    tickGenerator.TickGenerated += (_, __) => Interlocked.Increment(ref ticksCount);
+
+                    faultyTickGenerator.TryStartOneShot();
+                    tickGenerator.TryStartOneShot();
+                    faultyTickGenerator.ScheduleTick(TickDelay);
+                    tickGenerator.ScheduleTick(TickDelay);
+                    WaitOperations.Wait(WaitTime);
+
+                    ClassicAssert.AreSame(exception, reportedException, "Invalid reported exception.");
+                    ClassicAssert.AreEqual(1, ticksCount, "Invalid ticks count of the other tick generator.");
+                }
+            }
+        }
+
+        [Test]
+        public void Dispose_WaitsForTickHandler()
+        {
+            var handlerCompleted = false;
+
+            var scheduler = new PlaybackScheduler(1);
+            var tickGenerator = scheduler.CreateTickGenerator();
+            var handlerStarted = new ManualResetEventSlim();
+
+            tickGenerator.TickGenerated += (_, __) =>
+            {
+                handlerStarted.Set();
+                Thread.Sleep(HandlerTime);
+                Volatile.Write(ref handlerCompleted, true);
+            };
+
+            tickGenerator.TryStartOneShot();
+            tickGenerator.ScheduleTick(TickDelay);
+            ClassicAssert.IsTrue(handlerStarted.Wait(WaitTime), "Tick handler is not started.");
+
+            scheduler.Dispose();
+            ClassicAssert.IsTrue(Volatile.Read(ref handlerCompleted), "Dispose returned before tick handler completed.");
+
+            tickGenerator.Dispose();
+        }
+
+        #endregion
+    }
+}
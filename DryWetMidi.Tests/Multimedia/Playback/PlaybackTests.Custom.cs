@@ -1,4 +1,5 @@
-﻿using System.Collections.Generic;
+﻿using System;
+using System.Collections.Generic;
 using System.Linq;
 using Melanchall.DryWetMidi.Common;
 using Melanchall.DryWetMidi.Core;
@@ -6,6 +7,8 @@ using Melanchall.DryWetMidi.Multimedia;
 using Melanchall.DryWetMidi.Interaction;
 using Melanchall.DryWetMidi.Tests.Common;
 using NUnit.Framework;
+using NUnit.Framework.Legacy;
+using Melanchall.DryWetMidi.Tests.Utilities;
 
 namespace Melanchall.DryWetMidi.Tests.Multimedia
 {
@@ -59,6 +62,26 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             }
         }
 
+        private sealed class EventsCollectingPlayback : Playback
+        {
+            public EventsCollectingPlayback(IEnumerable<ITimedObject> timedObjects, TempoMap tempoMap, IOutputDevice outputDevice, PlaybackSettings playbackSettings)
+                : base(timedObjects, tempoMap, outputDevice, playbackSettings)
+            {
+            }
+
+            public List<MidiEvent> PlayedEvents { get; } = new List<MidiEvent>();
+
+            public bool CanSendEventsDirectlyValue => CanSendEventsDirectly;
+
+            protected override bool TryPlayEvent(MidiEvent midiEvent, object metadata)
+            {
+                lock (PlayedEvents)
+                    PlayedEvents.Add(midiEvent);
+
+                return base.TryPlayEvent(midiEvent, metadata);
+            }
+        }
+
         #endregion
 
         #region Test methods
@@ -85,6 +108,44 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             }
         }
 
+        [TestCase(false)]
+        [TestCase(true)]
+        public void CustomPlayback_TryPlayEventOverridden_CalledForEveryEvent(bool useOutputLookAhead)
+        {
+            var timedObjects = new ITimedObject[]
+            {
+                new TimedEvent(new ProgramChangeEvent((SevenBitNumber)10)),
+                new Note((SevenBitNumber)60).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(50), TempoMap).SetLength((MetricTimeSpan)TimeSpan.FromMilliseconds(100), TempoMap),
+            };
+
+            var expectedEvents = new MidiEvent[]
+            {
+                new ProgramChangeEvent((SevenBitNumber)10),
+                new NoteOnEvent((SevenBitNumber)60, Note.DefaultVelocity),
+                new NoteOffEvent((SevenBitNumber)60, Note.DefaultOffVelocity),
+            };
+
+            using (var outputDevice = OutputDevice.GetByName(SendReceiveUtilities.DeviceToTestOnName))
+            using (var playback = new EventsCollectingPlayback(timedObjects, TempoMap, outputDevice, new PlaybackSettings { UseCompiledTimeline = true }))
+            {
+                ClassicAssert.IsFalse(playback.CanSendEventsDirectlyValue, "Events can be sent directly.");
+
+                if (useOutputLookAhead)
+                    playback.OutputLookAhead = TimeSpan.FromMilliseconds(50);
+
+                playback.Start();
+
+                var isPlaybackFinished = WaitOperations.Wait(() => !playback.IsRunning, TimeSpan.FromSeconds(1));
+                ClassicAssert.IsTrue(isPlaybackFinished, "Playback is not finished.");
+
+                MidiAsserts.AreEqual(
+                    expectedEvents,
+                    playback.PlayedEvents,
+                    false,
+                    "Events passed to TryPlayEvent are invalid.");
+            }
+        }
+
         #endregion
     }
 }
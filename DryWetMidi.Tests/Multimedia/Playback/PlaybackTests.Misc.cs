@@ -495,6 +495,202 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             }
         }
 
+        [Retry(RetriesNumber)]
+        [TestCase(1.0)]
+        [TestCase(2.0)]
+        public void CheckPlayback_OutputLookAhead(double speed)
+        {
+            var eventsTimes = new[] { 0, 100, 150, 400, 410, 700 };
+            var playbackEvents = eventsTimes
+                .Select((t, i) => new TimedEvent(new ControlChangeEvent((SevenBitNumber)i, (SevenBitNumber)70))
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(t), TempoMap))
+                .ToArray();
+
+            var deviceName = SendReceiveUtilities.DeviceToTestOnName;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            using (var inputDevice = InputDevice.GetByName(deviceName))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                var receivingTimestamps = new List<long>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                    {
+                        receivedEvents.Add(e.Event);
+                        receivingTimestamps.Add(MidiDevice.GetCurrentTimestamp());
+                    }
+                };
+
+                inputDevice.StartEventsListening();
+
+                using (var playback = new Playback(playbackEvents, TempoMap, outputDevice))
+                {
+                    playback.Speed = speed;
+                    playback.OutputLookAhead = TimeSpan.FromMilliseconds(50);
+
+                    var finishedTimestamp = 0L;
+                    playback.Finished += (_, __) => finishedTimestamp = MidiDevice.GetCurrentTimestamp();
+
+                    var startTimestamp = MidiDevice.GetCurrentTimestamp();
+                    playback.Start();
+
+                    var timeout = TimeSpan.FromMilliseconds(eventsTimes.Last() / speed) + SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                    var isPlaybackFinished = WaitOperations.Wait(() => finishedTimestamp > 0 && receivedEvents.Count >= playbackEvents.Length, timeout);
+                    ClassicAssert.IsTrue(isPlaybackFinished, "Playback is not finished.");
+
+                    MidiAsserts.AreEqual(
+                        playbackEvents.Select(e => e.Event).ToArray(),
+                        receivedEvents,
+                        false,
+                        "Received events are invalid.");
+
+                    var maximumDelay = SendReceiveUtilities.MaximumEventSendReceiveDelay.Ticks * 100;
+
+                    for (var i = 0; i < eventsTimes.Length; i++)
+                    {
+                        var expectedTimestamp = startTimestamp + TimeSpan.FromMilliseconds(eventsTimes[i] / speed).Ticks * 100;
+                        var delay = receivingTimestamps[i] - expectedTimestamp;
+                        ClassicAssert.IsTrue(delay >= 0 && delay <= maximumDelay, $"Event {i} is received with invalid delay of {delay} ns.");
+                    }
+
+                    ClassicAssert.GreaterOrEqual(finishedTimestamp, receivingTimestamps.Last(), "Playback finished before the last event received.");
+                }
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_OutputLookAhead_Stop()
+        {
+            var playbackEvents = new[]
+            {
+                new TimedEvent(new NoteOnEvent((SevenBitNumber)10, (SevenBitNumber)70))
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(100), TempoMap),
+                new TimedEvent(new NoteOffEvent((SevenBitNumber)10, (SevenBitNumber)0))
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(300), TempoMap),
+            };
+
+            var deviceName = SendReceiveUtilities.DeviceToTestOnName;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            using (var inputDevice = InputDevice.GetByName(deviceName))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                        receivedEvents.Add(e.Event);
+                };
+
+                inputDevice.StartEventsListening();
+
+                using (var playback = new Playback(playbackEvents, TempoMap, outputDevice))
+                {
+                    playback.TrackNotes = false;
+                    playback.InterruptNotesOnStop = false;
+                    playback.OutputLookAhead = TimeSpan.FromMilliseconds(200);
+
+                    playback.Start();
+                    WaitOperations.Wait(TimeSpan.FromMilliseconds(150));
+                    playback.Stop();
+
+                    WaitOperations.Wait(TimeSpan.FromMilliseconds(300));
+                    MidiAsserts.AreEqual(
+                        new[] { playbackEvents[0].Event },
+                        receivedEvents,
+                        false,
+                        "Received events are invalid.");
+                }
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [TestCase(false)]
+        [TestCase(true)]
+        public void CheckPlayback_CompiledTimeline(bool useEventCallback)
+        {
+            var timedObjects = new ITimedObject[]
+            {
+                new TimedEvent(new ProgramChangeEvent((SevenBitNumber)10)).SetTime((MetricTimeSpan)TimeSpan.Zero, TempoMap),
+                new Note((SevenBitNumber)60, 10).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(100), TempoMap),
+                new Note((SevenBitNumber)64, 10).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(100), TempoMap),
+                new TimedEvent(new ControlChangeEvent((SevenBitNumber)7, (SevenBitNumber)70)).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(100), TempoMap),
+                new TimedEvent(new NormalSysExEvent(new byte[] { 1, 2, 3, 0xF7 })).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(50), TempoMap),
+                new TimedEvent(new PitchBendEvent(1000)).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(100), TempoMap),
+                new TimedEvent(new StartEvent()).SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(200), TempoMap),
+            };
+
+            var deviceName = SendReceiveUtilities.DeviceToTestOnName;
+
+            using (var outputDevice = OutputDevice.GetByName(deviceName))
+            using (var inputDevice = InputDevice.GetByName(deviceName))
+            {
+                var receivedEvents = new List<MidiEvent>();
+                inputDevice.EventReceived += (_, e) =>
+                {
+                    lock (receivedEvents)
+                        receivedEvents.Add(e.Event);
+                };
+
+                inputDevice.StartEventsListening();
+
+                using (var playback = new Playback(timedObjects, TempoMap, outputDevice, new PlaybackSettings { UseCompiledTimeline = true }))
+                {
+                    if (useEventCallback)
+                        playback.EventCallback = (e, rawTime, playbackTime) => e is ControlChangeEvent controlChangeEvent
+                            ? new ControlChangeEvent(controlChangeEvent.ControlNumber, (SevenBitNumber)100)
+                            : e;
+
+                    var notifications = new List<string>();
+                    playback.EventPlayed += (_, e) => notifications.Add($"Played {e.Event}");
+                    playback.NotesPlaybackStarted += (_, e) => notifications.Add($"Started {string.Join(", ", e.Notes.Select(n => n.NoteNumber))}");
+                    playback.NotesPlaybackFinished += (_, e) => notifications.Add($"Finished {string.Join(", ", e.Notes.Select(n => n.NoteNumber))}");
+
+                    var finished = false;
+                    playback.Finished += (_, __) => finished = true;
+
+                    playback.Start();
+
+                    var expectedEvents = new MidiEvent[]
+                    {
+                        new ProgramChangeEvent((SevenBitNumber)10),
+                        new NormalSysExEvent(new byte[] { 1, 2, 3, 0xF7 }),
+                        new ControlChangeEvent((SevenBitNumber)7, (SevenBitNumber)(useEventCallback ? 100 : 70)),
+                        new PitchBendEvent(1000),
+                        new NoteOnEvent((SevenBitNumber)60, Note.DefaultVelocity),
+                        new NoteOnEvent((SevenBitNumber)64, Note.DefaultVelocity),
+                        new NoteOffEvent((SevenBitNumber)60, Note.DefaultOffVelocity),
+                        new NoteOffEvent((SevenBitNumber)64, Note.DefaultOffVelocity),
+                        new StartEvent(),
+                    };
+
+                    var timeout = TimeSpan.FromMilliseconds(200) + SendReceiveUtilities.MaximumEventSendReceiveDelay;
+                    var isPlaybackFinished = WaitOperations.Wait(() => finished && receivedEvents.Count >= expectedEvents.Length, timeout);
+                    ClassicAssert.IsTrue(isPlaybackFinished, "Playback is not finished.");
+
+                    MidiAsserts.AreEqual(
+                        expectedEvents,
+                        receivedEvents,
+                        false,
+                        "Received events are invalid.");
+
+                    var noteEventsPlayedIndex = notifications.IndexOf($"Played {expectedEvents[4]}");
+                    CollectionAssert.AreEqual(
+                        new[]
+                        {
+                            $"Played {expectedEvents[4]}",
+                            "Started 60",
+                            $"Played {expectedEvents[5]}",
+                            "Started 64",
+                        },
+                        notifications.Skip(noteEventsPlayedIndex).Take(4),
+                        "Notifications are raised in invalid order.");
+                    ClassicAssert.AreEqual(expectedEvents.Length + 4, notifications.Count, "Invalid count of notifications.");
+                }
+            }
+        }
+
         [Retry(RetriesNumber)]
         [Test]
         public void CheckPlaybackEvents_Normal()
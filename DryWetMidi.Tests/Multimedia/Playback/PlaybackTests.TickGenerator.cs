@@ -88,6 +88,80 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
             CheckPlayback_TickGenerator(() => new ThreadTickGenerator(), TimeSpan.FromMilliseconds(10));
         }
 
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_PlaybackScheduler()
+        {
+            using (var scheduler = new PlaybackScheduler(2))
+            {
+                CheckPlayback_TickGenerator(scheduler.CreateTickGenerator, TimeSpan.FromMilliseconds(10));
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_HighPrecisionTickGenerator_DeadlineTicking()
+        {
+            CheckPlayback_TickGenerator(() => new HighPrecisionTickGenerator(), TimeSpan.FromMilliseconds(30), MidiClockTickingMode.Deadline);
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_RegularPrecisionTickGenerator_DeadlineTicking()
+        {
+            CheckPlayback_TickGenerator(() => new RegularPrecisionTickGenerator(), TimeSpan.FromMilliseconds(50), MidiClockTickingMode.Deadline);
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_PlaybackScheduler_DeadlineTicking()
+        {
+            using (var scheduler = new PlaybackScheduler(2))
+            {
+                CheckPlayback_TickGenerator(scheduler.CreateTickGenerator, TimeSpan.FromMilliseconds(10), MidiClockTickingMode.Deadline);
+            }
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_CustomTickGenerator_DeadlineTicking()
+        {
+            CheckPlayback_TickGenerator(() => new ThreadTickGenerator(), TimeSpan.FromMilliseconds(10), MidiClockTickingMode.Deadline);
+        }
+
+        [Retry(RetriesNumber)]
+        [Test]
+        public void CheckPlayback_DeadlineTicking_StopStartChangeSpeed()
+        {
+            CheckPlayback(
+                useOutputDevice: false,
+                initialPlaybackObjects: GetTickGeneratorTestObjects(),
+                actions: new[]
+                {
+                    new PlaybackAction(TimeSpan.FromMilliseconds(500), p => p.Stop()),
+                    new PlaybackAction(TimeSpan.FromMilliseconds(500), p => p.Start()),
+                    new PlaybackAction(TimeSpan.FromMilliseconds(250), p => p.Speed = 2),
+                },
+                expectedReceivedEvents: new[]
+                {
+                    new SentReceivedEvent(new NoteOnEvent((SevenBitNumber)100, (SevenBitNumber)20) { Channel = (FourBitNumber)5 }, TimeSpan.Zero),
+                    new SentReceivedEvent(new NoteOffEvent((SevenBitNumber)100, (SevenBitNumber)10) { Channel = (FourBitNumber)5 }, TimeSpan.FromMilliseconds(500)),
+                    new SentReceivedEvent(new NoteOnEvent((SevenBitNumber)100, (SevenBitNumber)20) { Channel = (FourBitNumber)5 }, TimeSpan.FromMilliseconds(1000)),
+                    new SentReceivedEvent(new NoteOffEvent((SevenBitNumber)100, (SevenBitNumber)10) { Channel = (FourBitNumber)5 }, TimeSpan.FromMilliseconds(1375)),
+                    new SentReceivedEvent(new NoteOnEvent(), TimeSpan.FromMilliseconds(1625)),
+                    new SentReceivedEvent(new NoteOnEvent((SevenBitNumber)30, (SevenBitNumber)50), TimeSpan.FromMilliseconds(1625)),
+                    new SentReceivedEvent(new NoteOffEvent(), TimeSpan.FromMilliseconds(2375)),
+                    new SentReceivedEvent(new NoteOffEvent((SevenBitNumber)30, (SevenBitNumber)50), TimeSpan.FromMilliseconds(2375)),
+                },
+                playbackSettings: new PlaybackSettings
+                {
+                    ClockSettings = new MidiClockSettings
+                    {
+                        TickingMode = MidiClockTickingMode.Deadline
+                    }
+                });
+        }
+
         [Retry(RetriesNumber)]
         [Test]
         public void CheckPlayback_ManualTicking()
@@ -146,24 +220,14 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
 
         #region Private methods
 
-        private void CheckPlayback_TickGenerator(Func<TickGenerator> createTickGeneratorCallback, TimeSpan maximumEventSendReceiveDelay)
+        private void CheckPlayback_TickGenerator(
+            Func<TickGenerator> createTickGeneratorCallback,
+            TimeSpan maximumEventSendReceiveDelay,
+            MidiClockTickingMode tickingMode = MidiClockTickingMode.FixedInterval)
         {
             CheckPlayback(
                 useOutputDevice: false,
-                initialPlaybackObjects: new[]
-                {
-                    new TimedEvent(new NoteOnEvent((SevenBitNumber)100, (SevenBitNumber)20) { Channel = (FourBitNumber)5 }),
-                    new TimedEvent(new NoteOffEvent((SevenBitNumber)100, (SevenBitNumber)10) { Channel = (FourBitNumber)5 })
-                        .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(1000), TempoMap),
-                    new TimedEvent(new NoteOnEvent())
-                        .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(1500), TempoMap),
-                    new TimedEvent(new NoteOnEvent((SevenBitNumber)30, (SevenBitNumber)50))
-                        .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(1500), TempoMap),
-                    new TimedEvent(new NoteOffEvent())
-                        .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(3000), TempoMap),
-                    new TimedEvent(new NoteOffEvent((SevenBitNumber)30, (SevenBitNumber)50))
-                        .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(3000), TempoMap),
-                },
+                initialPlaybackObjects: GetTickGeneratorTestObjects(),
                 actions: Array.Empty<PlaybackAction>(),
                 expectedReceivedEvents: new[]
                 {
@@ -174,9 +238,35 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
                     new SentReceivedEvent(new NoteOffEvent(), TimeSpan.FromMilliseconds(3000)),
                     new SentReceivedEvent(new NoteOffEvent((SevenBitNumber)30, (SevenBitNumber)50), TimeSpan.FromMilliseconds(3000)),
                 },
+                playbackSettings: new PlaybackSettings
+                {
+                    ClockSettings = new MidiClockSettings
+                    {
+                        CreateTickGeneratorCallback = createTickGeneratorCallback,
+                        TickingMode = tickingMode
+                    }
+                },
                 sendReceiveTimeDelta: maximumEventSendReceiveDelay);
         }
 
+        private ITimedObject[] GetTickGeneratorTestObjects()
+        {
+            return new ITimedObject[]
+            {
+                new TimedEvent(new NoteOnEvent((SevenBitNumber)100, (SevenBitNumber)20) { Channel = (FourBitNumber)5 }),
+                new TimedEvent(new NoteOffEvent((SevenBitNumber)100, (SevenBitNumber)10) { Channel = (FourBitNumber)5 })
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(1000), TempoMap),
+                new TimedEvent(new NoteOnEvent())
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(1500), TempoMap),
+                new TimedEvent(new NoteOnEvent((SevenBitNumber)30, (SevenBitNumber)50))
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(1500), TempoMap),
+                new TimedEvent(new NoteOffEvent())
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(3000), TempoMap),
+                new TimedEvent(new NoteOffEvent((SevenBitNumber)30, (SevenBitNumber)50))
+                    .SetTime((MetricTimeSpan)TimeSpan.FromMilliseconds(3000), TempoMap),
+            };
+        }
+
         #endregion
     }
 }
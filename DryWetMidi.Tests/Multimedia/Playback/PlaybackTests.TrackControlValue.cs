@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Linq;
 using Melanchall.DryWetMidi.Common;
 using Melanchall.DryWetMidi.Core;
 using Melanchall.DryWetMidi.Interaction;
@@ -932,6 +933,47 @@ namespace Melanchall.DryWetMidi.Tests.Multimedia
                 });
         }
 
+        [Retry(RetriesNumber)]
+        [Test]
+        public void TrackControlValue_ManyControlChanges_MoveToTime(
+            [Values(300, 302)] int moveToMs)
+        {
+            var controlChangesCount = 100;
+            var controlChangesStep = TimeSpan.FromMilliseconds(4);
+            var lastEventTime = TimeSpan.FromSeconds(1);
+            var controlNumber = (SevenBitNumber)7;
+
+            var moveFrom = TimeSpan.FromMilliseconds(500);
+            var moveTo = TimeSpan.FromMilliseconds(moveToMs);
+
+            var controlChanges = Enumerable
+                .Range(0, controlChangesCount)
+                .Select(i => new { Time = TimeSpan.FromTicks(controlChangesStep.Ticks * i), Value = (SevenBitNumber)(byte)i })
+                .ToArray();
+
+            var lastValueBeforeMove = controlChanges.Last(c => c.Time <= moveTo);
+
+            CheckPlayback(
+                useOutputDevice: false,
+                initialPlaybackObjects: controlChanges
+                    .Select(c => new TimedEvent(new ControlChangeEvent(controlNumber, c.Value)).SetTime((MetricTimeSpan)c.Time, TempoMap))
+                    .Concat(new[] { new TimedEvent(new NoteAftertouchEvent()).SetTime((MetricTimeSpan)lastEventTime, TempoMap) })
+                    .ToArray(),
+                actions: new[]
+                {
+                    new PlaybackAction(moveFrom,
+                        p => p.MoveToTime((MetricTimeSpan)moveTo)),
+                },
+                expectedReceivedEvents: controlChanges
+                    .Select(c => new SentReceivedEvent(new ControlChangeEvent(controlNumber, c.Value), c.Time))
+                    .Concat(new[] { new SentReceivedEvent(new ControlChangeEvent(controlNumber, lastValueBeforeMove.Value), moveFrom) })
+                    .Concat(controlChanges
+                        .Where(c => c.Time > lastValueBeforeMove.Time)
+                        .Select(c => new SentReceivedEvent(new ControlChangeEvent(controlNumber, c.Value), c.Time - moveTo + moveFrom)))
+                    .Concat(new[] { new SentReceivedEvent(new NoteAftertouchEvent(), lastEventTime - moveTo + moveFrom) })
+                    .ToArray());
+        }
+
         #endregion
     }
 }
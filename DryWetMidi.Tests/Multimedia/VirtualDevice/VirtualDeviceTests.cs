@@ -13,7 +13,7 @@ using NUnit.Framework.Legacy;
 namespace Melanchall.DryWetMidi.Tests.Multimedia
 {
     [TestFixture]
-    [Platform("MacOsX")]
+    [Platform("MacOsX,Linux")]
     public sealed class VirtualDeviceTests
     {
         #region Constants
@@ -0,0 +1,216 @@
+﻿using System.Collections.Generic;
+
+namespace Melanchall.DryWetMidi.Common
+{
+    // Hierarchical timer wheel: level 0 has a slot per wheel tick, every next level has
+    // a slot per full rotation of the previous one. Nodes are placed by the distance to
+    // their deadlines and are moved down a level (cascaded) when the wheel reaches their
+    // slot, so adding and removing a node is O(1) regardless of the number of nodes.
+    // Deadlines are in arbitrary units, the wheel tick is the specified number of them.
+    // A node expires at the first wheel tick not earlier than its deadline.
+    internal sealed class TimerWheel<TValue>
+    {
+        #region Constants
+
+        private const int LevelBits = 6;
+        private const int SlotsPerLevel = 1 << LevelBits;
+        private const int SlotMask = SlotsPerLevel - 1;
+        private const int LevelsCount = 4;
+
+        private const long MaxTicksDelta = (1L << (LevelBits * LevelsCount)) - 1;
+
+        #endregion
+
+        #region Fields
+
+        private readonly long _resolution;
+        private readonly TimerWheelNode<TValue>[][] _slots = new TimerWheelNode<TValue>[LevelsCount][];
+        private readonly int[] _levelsCounts = new int[LevelsCount];
+
+        private long _currentTick;
+
+        #endregion
+
+        #region Constructor
+
+        public TimerWheel(long resolution, long startTime)
+        {
+            _resolution = resolution;
+            _currentTick = startTime / resolution;
+
+            for (var level = 0; level < LevelsCount; level++)
+            {
+                _slots[level] = new TimerWheelNode<TValue>[SlotsPerLevel];
+            }
+        }
+
+        #endregion
+
+        #region Properties
+
+        public int Count { get; private set; }
+
+        #endregion
+
+        #region Methods
+
+        public void Add(TimerWheelNode<TValue> node, long deadline)
+        {
+            if (node.IsInWheel)
+                Remove(node);
+
+            node.Deadline = deadline;
+            Insert(node, _currentTick + 1);
+        }
+
+        public bool Remove(TimerWheelNode<TValue> node)
+        {
+            if (!node.IsInWheel)
+                return false;
+
+            Unlink(node);
+            return true;
+        }
+
+        public void Advance(long time, ICollection<TimerWheelNode<TValue>> expiredNodes)
+        {
+            var targetTick = time / _resolution;
+
+            while (_currentTick < targetTick)
+            {
+                if (Count == 0)
+                {
+                    _currentTick = targetTick;
+                    break;
+                }
+
+                _currentTick++;
+
+                for (var level = 1; level < LevelsCount; level++)
+                {
+                    if ((_currentTick & ((1L << (LevelBits * level)) - 1)) != 0)
+                        break;
+
+                    Cascade(level, (int)((_currentTick >> (LevelBits * level)) & SlotMask));
+                }
+
+                var slots = _slots[0];
+                var slot = (int)(_currentTick & SlotMask);
+
+                while (slots[slot] != null)
+                {
+                    var node = slots[slot];
+                    Unlink(node);
+                    expiredNodes.Add(node);
+                }
+            }
+        }
+
+        // Returns the time the wheel should be advanced at to either expire nodes or
+        // cascade them to lower levels, or null if the wheel is empty
+        public long? GetNextAdvanceTime()
+        {
+            if (Count == 0)
+                return null;
+
+            var result = long.MaxValue;
+
+            for (var level = 0; level < LevelsCount; level++)
+            {
+                if (_levelsCounts[level] == 0)
+                    continue;
+
+                var shift = LevelBits * level;
+                var blockIndex = _currentTick >> shift;
+                var slots = _slots[level];
+
+                for (var i = 1; i <= SlotsPerLevel; i++)
+                {
+                    if (slots[(int)((blockIndex + i) & SlotMask)] == null)
+                        continue;
+
+                    var tick = (blockIndex + i) << shift;
+                    if (tick < result)
+                        result = tick;
+
+                    break;
+                }
+            }
+
+            return result * _resolution;
+        }
+
+        private void Insert(TimerWheelNode<TValue> node, long minTick)
+        {
+            var tick = (node.Deadline + _resolution - 1) / _resolution;
+            if (tick < minTick)
+                tick = minTick;
+
+            // Too distant nodes are placed to the farthest slot and will be placed
+            // again when the wheel reaches it
+            var delta = tick - _currentTick;
+            if (delta > MaxTicksDelta)
+            {
+                delta = MaxTicksDelta;
+                tick = _currentTick + delta;
+            }
+
+            var level = 0;
+            while (level < LevelsCount - 1 && delta >= 1L << (LevelBits * (level + 1)))
+            {
+                level++;
+            }
+
+            var slot = (int)((tick >> (LevelBits * level)) & SlotMask);
+            var slots = _slots[level];
+
+            node.Level = level;
+            node.Slot = slot;
+            node.Previous = null;
+            node.Next = slots[slot];
+
+            if (node.Next != null)
+                node.Next.Previous = node;
+
+            slots[slot] = node;
+
+            _levelsCounts[level]++;
+            Count++;
+        }
+
+        private void Unlink(TimerWheelNode<TValue> node)
+        {
+            if (node.Previous != null)
+                node.Previous.Next = node.Next;
+            else
+                _slots[node.Level][node.Slot] = node.Next;
+
+            if (node.Next != null)
+                node.Next.Previous = node.Previous;
+
+            _levelsCounts[node.Level]--;
+            Count--;
+
+            node.Next = null;
+            node.Previous = null;
+            node.Level = -1;
+        }
+
+        private void Cascade(int level, int slot)
+        {
+            var slots = _slots[level];
+
+            while (slots[slot] != null)
+            {
+                var node = slots[slot];
+                Unlink(node);
+
+                // Nodes expiring at the current tick are placed to the slot of level 0
+                // which is processed right after cascading
+                Insert(node, _currentTick);
+            }
+        }
+
+        #endregion
+    }
+}
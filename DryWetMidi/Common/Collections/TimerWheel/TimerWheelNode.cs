@@ -0,0 +1,32 @@
+﻿namespace Melanchall.DryWetMidi.Common
+{
+    internal sealed class TimerWheelNode<TValue>
+    {
+        #region Constructor
+
+        public TimerWheelNode(TValue value)
+        {
+            Value = value;
+        }
+
+        #endregion
+
+        #region Properties
+
+        public TValue Value { get; }
+
+        public long Deadline { get; set; }
+
+        public TimerWheelNode<TValue> Next { get; set; }
+
+        public TimerWheelNode<TValue> Previous { get; set; }
+
+        public int Level { get; set; } = -1;
+
+        public int Slot { get; set; }
+
+        public bool IsInWheel => Level >= 0;
+
+        #endregion
+    }
+}
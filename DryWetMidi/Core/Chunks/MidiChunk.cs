@@ -176,6 +176,11 @@ namespace Melanchall.DryWetMidi.Core
             long readerPosition;
             var size = ReadSize(reader, out readerPosition);
 
+            ReadContent(reader, settings, size, readerPosition);
+        }
+
+        internal void ReadContent(MidiReader reader, ReadingSettings settings, uint size, long readerPosition)
+        {
             ReadContent(reader, settings, size);
 
             var bytesReadCount = reader.Position - readerPosition;
@@ -201,7 +206,7 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="IOException">
         /// An I/O error occurred on the <paramref name="writer"/>'s underlying stream.
         /// </exception>
-        internal void Write(MidiWriter writer, WritingSettings settings)
+        internal virtual void Write(MidiWriter writer, WritingSettings settings)
         {
             var size = GetContentSize(settings);
             WriteHeader(ChunkId, size, writer, settings);
@@ -3,6 +3,7 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
+using System.Threading;
 
 namespace Melanchall.DryWetMidi.Core
 {
@@ -23,6 +24,17 @@ namespace Melanchall.DryWetMidi.Core
         /// </summary>
         public const string Id = "MTrk";
 
+        // Typical size of a channel event in bytes (one byte delta-time and two data bytes
+        // with running status) used to estimate events count by content size
+        private const int AverageEventSize = 3;
+
+        #endregion
+
+        #region Fields
+
+        private EventsCollection _events = new EventsCollection();
+        private CompactTrack _compactTrack;
+
         #endregion
 
         #region Constructor
@@ -72,6 +84,25 @@ namespace Melanchall.DryWetMidi.Core
             Events.AddRange(events);
         }
 
+        /// <summary>
+        /// Initializes a new instance of the <see cref="TrackChunk"/> with events of the specified
+        /// compact track.
+        /// </summary>
+        /// <param name="compactTrack">Compact track to take events from.</param>
+        /// <remarks>
+        /// <para>Events are kept in the compact form until <see cref="Events"/> is accessed for the first
+        /// time, so a track chunk created this way can be written without creating an object for each
+        /// channel event.</para>
+        /// </remarks>
+        /// <exception cref="ArgumentNullException"><paramref name="compactTrack"/> is <c>null</c>.</exception>
+        public TrackChunk(CompactTrack compactTrack)
+            : this()
+        {
+            ThrowIfArgument.IsNull(nameof(compactTrack), compactTrack);
+
+            SetCompactTrack(compactTrack);
+        }
+
         #endregion
 
         #region Properties
@@ -79,7 +110,18 @@ namespace Melanchall.DryWetMidi.Core
         /// <summary>
         /// Gets the collection of events contained in the track chunk.
         /// </summary>
-        public EventsCollection Events { get; } = new EventsCollection();
+        /// <remarks>
+        /// <para>If events of the track chunk are stored in the compact form (see <see cref="TrackChunk(CompactTrack)"/>
+        /// and <see cref="ReadingSettings.UseCompactEventsStorage"/>), objects for them are created on
+        /// first access to the property.</para>
+        /// </remarks>
+        public EventsCollection Events
+        {
+            get
+            {
+                return _events ?? MaterializeEvents();
+            }
+        }
 
         #endregion
 
@@ -91,6 +133,11 @@ namespace Melanchall.DryWetMidi.Core
         /// <returns>Copy of the chunk.</returns>
         public override MidiChunk Clone()
         {
+            // Compact track can't be changed so it can be shared between chunks
+            var compactTrack = _compactTrack;
+            if (compactTrack != null)
+                return new TrackChunk(compactTrack);
+
             return new TrackChunk(Events.Select(e => e.Clone()));
         }
 
@@ -114,6 +161,12 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="MissedEndOfTrackEventException">Track chunk doesn't end with End Of Track event.</exception>
         protected override void ReadContent(MidiReader reader, ReadingSettings settings, uint size)
         {
+            if (settings.UseCompactEventsStorage)
+            {
+                ReadCompactContent(reader, settings, size);
+                return;
+            }
+
             var endReaderPosition = reader.Position + size;
             var endOfTrackPresented = false;
 
@@ -160,6 +213,13 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="IOException">An I/O error occurred on the writer's underlying stream.</exception>
         protected override void WriteContent(MidiWriter writer, WritingSettings settings)
         {
+            var compactTrack = _compactTrack;
+            if (compactTrack != null)
+            {
+                WriteCompactContent(compactTrack, writer, settings);
+                return;
+            }
+
             ProcessEvents(settings, (eventWriter, midiEvent, writeStatusByte) =>
             {
                 writer.WriteVlqNumber(midiEvent.DeltaTime);
@@ -175,6 +235,16 @@ namespace Melanchall.DryWetMidi.Core
         /// <returns>Number of bytes required to write <see cref="TrackChunk"/>'s content.</returns>
         protected override uint GetContentSize(WritingSettings settings)
         {
+            var compactTrack = _compactTrack;
+            if (compactTrack != null)
+            {
+                using (var writer = new MidiWriter(Stream.Null, new WriterSettings { UseBuffering = false }))
+                {
+                    WriteCompactContent(compactTrack, writer, settings);
+                    return (uint)writer.Length;
+                }
+            }
+
             uint result = 0;
 
             ProcessEvents(settings, (eventWriter, midiEvent, writeStatusByte) =>
@@ -192,13 +262,82 @@ namespace Melanchall.DryWetMidi.Core
         /// <returns>A string that represents the current object.</returns>
         public override string ToString()
         {
-            return $"Track chunk ({Events.Count} events)";
+            var compactTrack = _compactTrack;
+            var eventsCount = compactTrack != null ? compactTrack.Count : Events.Count;
+            return $"Track chunk ({eventsCount} events)";
         }
 
         #endregion
 
         #region Methods
 
+        /// <summary>
+        /// Gets events of the track chunk in the compact form.
+        /// </summary>
+        /// <returns>An instance of the <see cref="CompactTrack"/> holding events of the track chunk.</returns>
+        /// <remarks>
+        /// <para>If events are already stored in the compact form, the same instance is returned;
+        /// otherwise a new one is created from the current content of <see cref="Events"/>.</para>
+        /// </remarks>
+        public CompactTrack ToCompactTrack()
+        {
+            return _compactTrack ?? new CompactTrack(Events);
+        }
+
+        internal override void Write(MidiWriter writer, WritingSettings settings)
+        {
+            // Events are written once to the writer's content buffer instead of calculating
+            // content size walking through events and then walking through them again to write
+
+            var contentWriter = writer.StartChunkContent();
+            WriteContent(contentWriter, settings);
+            writer.EndChunkContent(ChunkId, settings);
+        }
+
+        // Reads events of a track chunk the same way reading of a whole file does but one by one,
+        // so they can be processed without storing them in a chunk
+        internal static IEnumerable<MidiEvent> EnumerateEvents(MidiReader reader, ReadingSettings settings, uint size)
+        {
+            var readerPosition = reader.Position;
+            var endReaderPosition = readerPosition + size;
+            var endOfTrackPresented = false;
+
+            byte? currentChannelEventStatusByte = null;
+
+            //
+
+            while (reader.Position < endReaderPosition && !reader.EndReached)
+            {
+                MidiEvent midiEvent;
+                if (!TryReadEvent(reader, settings, ref currentChannelEventStatusByte, out midiEvent))
+                    yield break;
+
+                if (midiEvent == null)
+                    continue;
+
+                if (midiEvent is EndOfTrackEvent)
+                {
+                    endOfTrackPresented = true;
+
+                    if (settings.EndOfTrackStoringPolicy == EndOfTrackStoringPolicy.Store)
+                        yield return midiEvent;
+
+                    break;
+                }
+
+                yield return midiEvent;
+            }
+
+            //
+
+            if (settings.MissedEndOfTrackPolicy == MissedEndOfTrackPolicy.Abort && !endOfTrackPresented)
+                throw new MissedEndOfTrackEventException();
+
+            var bytesReadCount = reader.Position - readerPosition;
+            if (settings.InvalidChunkSizePolicy == InvalidChunkSizePolicy.Abort && bytesReadCount != size)
+                throw new InvalidChunkSizeException(Id, size, bytesReadCount);
+        }
+
         internal static MidiEvent ReadEvent(MidiReader reader, ReadingSettings settings, ref byte? channelEventStatusByte)
         {
             var deltaTime = reader.ReadVlqLongNumber();
@@ -215,8 +354,11 @@ namespace Melanchall.DryWetMidi.Core
                 reader.Position--;
             }
 
-            //
+            return ReadEvent(reader, settings, deltaTime, statusByte, ref channelEventStatusByte);
+        }
 
+        private static MidiEvent ReadEvent(MidiReader reader, ReadingSettings settings, long deltaTime, byte statusByte, ref byte? channelEventStatusByte)
+        {
             var eventReader = EventReaderFactory.GetReader(statusByte, smfOnly: true);
             var midiEvent = eventReader.Read(reader, settings, statusByte);
 
@@ -310,6 +452,217 @@ namespace Melanchall.DryWetMidi.Core
             eventHandler(eventWriter, eventToWrite, writeStatusByte);
         }
 
+        private void SetCompactTrack(CompactTrack compactTrack)
+        {
+            _compactTrack = compactTrack;
+            _events = null;
+        }
+
+        private EventsCollection MaterializeEvents()
+        {
+            // Compact track is cleared only after events are published so if it's gone
+            // events have been materialized by another thread
+            var compactTrack = _compactTrack;
+            if (compactTrack == null)
+                return Volatile.Read(ref _events);
+
+            var events = new EventsCollection();
+
+            for (var i = 0; i < compactTrack.Count; i++)
+            {
+                events.AddInternal(compactTrack.CreateEvent(i));
+            }
+
+            events.IsInitialState = true;
+
+            // Only the first created collection is published so all threads get the same
+            // events. Once objects are created they can be changed so compact track becomes
+            // out of date
+            var publishedEvents = Interlocked.CompareExchange(ref _events, events, null);
+            if (publishedEvents != null)
+                return publishedEvents;
+
+            _compactTrack = null;
+            return events;
+        }
+
+        private void ReadCompactContent(MidiReader reader, ReadingSettings settings, uint size)
+        {
+            // Compact track is set before reading so events read before an error are kept
+            // in the chunk as it happens for regular reading
+            var compactTrack = new CompactTrack(EstimateEventsCount(reader, size));
+            SetCompactTrack(compactTrack);
+
+            var endReaderPosition = reader.Position + size;
+            var endOfTrackPresented = false;
+
+            byte? currentChannelEventStatusByte = null;
+
+            //
+
+            while (reader.Position < endReaderPosition && !reader.EndReached)
+            {
+                // Channel events are decoded right here to not create objects for them, the logic
+                // must match ReadEvent and ChannelEventReader
+
+                var deltaTime = reader.ReadVlqLongNumber();
+                if (deltaTime < 0)
+                    deltaTime = 0;
+
+                var statusByte = reader.ReadByte();
+                if (statusByte <= SevenBitNumber.MaxValue)
+                {
+                    if (currentChannelEventStatusByte == null)
+                        throw new UnexpectedRunningStatusException();
+
+                    statusByte = currentChannelEventStatusByte.Value;
+                    reader.Position--;
+                }
+
+                if (statusByte < EventStatusBytes.Global.NormalSysEx)
+                {
+                    var eventType = CompactTrack.GetChannelEventType(statusByte);
+
+                    var dataByte1 = ChannelEvent.ReadDataByte(reader, settings, eventType);
+                    var dataByte2 = CompactTrack.HasTwoDataBytes(statusByte)
+                        ? ChannelEvent.ReadDataByte(reader, settings, eventType)
+                        : (byte)0;
+
+                    currentChannelEventStatusByte = statusByte;
+
+                    if (eventType == MidiEventType.NoteOn && dataByte2 == 0 && settings.SilentNoteOnPolicy == SilentNoteOnPolicy.NoteOff)
+                        statusByte = DataTypesUtilities.CombineAsFourBitNumbers(EventStatusBytes.Channel.NoteOff, statusByte.GetTail());
+
+                    compactTrack.AddChannelEvent(deltaTime, statusByte, dataByte1, dataByte2);
+                    continue;
+                }
+
+                var midiEvent = ReadEvent(reader, settings, deltaTime, statusByte, ref currentChannelEventStatusByte);
+                if (midiEvent == null)
+                    continue;
+
+                if (midiEvent is EndOfTrackEvent)
+                {
+                    endOfTrackPresented = true;
+
+                    if (settings.EndOfTrackStoringPolicy == EndOfTrackStoringPolicy.Store)
+                        compactTrack.AddNonChannelEvent(midiEvent);
+
+                    break;
+                }
+
+                compactTrack.AddNonChannelEvent(midiEvent);
+            }
+
+            //
+
+            if (settings.MissedEndOfTrackPolicy == MissedEndOfTrackPolicy.Abort && !endOfTrackPresented)
+                throw new MissedEndOfTrackEventException();
+        }
+
+        // Lack of bytes stops reading of the chunk (or throws an exception depending on the policy)
+        // as it happens on reading of a whole file
+        private static bool TryReadEvent(MidiReader reader, ReadingSettings settings, ref byte? channelEventStatusByte, out MidiEvent midiEvent)
+        {
+            midiEvent = null;
+
+            try
+            {
+                midiEvent = ReadEvent(reader, settings, ref channelEventStatusByte);
+                return true;
+            }
+            catch (NotEnoughBytesException ex)
+            {
+                MidiFile.ReactOnNotEnoughBytes(settings.NotEnoughBytesPolicy, ex);
+            }
+            catch (EndOfStreamException ex)
+            {
+                MidiFile.ReactOnNotEnoughBytes(settings.NotEnoughBytesPolicy, ex);
+            }
+
+            return false;
+        }
+
+        private static int EstimateEventsCount(MidiReader reader, uint size)
+        {
+            // Size declared in the header can be invalid so it's limited by the actual data length
+            // known for seekable streams only
+            if (!reader.SupportsRandomAccess)
+                return 0;
+
+            var contentSize = Math.Min(size, Math.Max(reader.Length - reader.Position, 0));
+            return (int)Math.Min(contentSize / AverageEventSize, int.MaxValue);
+        }
+
+        private void WriteCompactContent(CompactTrack compactTrack, MidiWriter writer, WritingSettings settings)
+        {
+            // Channel events are written right from the compact track to not create objects
+            // for them, the logic must match ProcessEvent
+
+            Action<IEventWriter, MidiEvent, bool> eventHandler = (eventWriter, midiEvent, writeStatusByte) =>
+            {
+                writer.WriteVlqNumber(midiEvent.DeltaTime);
+                eventWriter.Write(midiEvent, writer, settings, writeStatusByte);
+            };
+
+            byte? runningStatus = null;
+
+            var skipSetTempo = true;
+            var skipKeySignature = true;
+            var skipTimeSignature = true;
+            var additionalDeltaTime = 0L;
+            var lastEventIsEndOfTrack = false;
+
+            for (var i = 0; i < compactTrack.Count; i++)
+            {
+                if (!compactTrack.IsChannelEvent(i))
+                {
+                    ProcessEvent(
+                        compactTrack.GetNonChannelEventInternal(i),
+                        settings,
+                        eventHandler,
+                        ref lastEventIsEndOfTrack,
+                        ref additionalDeltaTime,
+                        ref runningStatus,
+                        ref skipSetTempo,
+                        ref skipKeySignature,
+                        ref skipTimeSignature);
+                    continue;
+                }
+
+                lastEventIsEndOfTrack = false;
+
+                var statusByte = compactTrack.GetStatusByteInternal(i);
+                var dataByte2 = compactTrack.GetDataByte2Internal(i);
+
+                if (settings.NoteOffAsSilentNoteOn && statusByte.GetHead() == EventStatusBytes.Channel.NoteOff)
+                {
+                    statusByte = DataTypesUtilities.CombineAsFourBitNumbers(EventStatusBytes.Channel.NoteOn, statusByte.GetTail());
+                    dataByte2 = 0;
+                }
+
+                var writeStatusByte = runningStatus != statusByte || !settings.UseRunningStatus;
+                runningStatus = statusByte;
+
+                writer.WriteVlqNumber(compactTrack.GetDeltaTimeInternal(i) + additionalDeltaTime);
+
+                if (writeStatusByte)
+                    writer.WriteByte(statusByte);
+
+                writer.WriteByte(compactTrack.GetDataByte1Internal(i));
+
+                if (CompactTrack.HasTwoDataBytes(statusByte))
+                    writer.WriteByte(dataByte2);
+            }
+
+            var endOfTrackEvent = new EndOfTrackEvent
+            {
+                DeltaTime = lastEventIsEndOfTrack ? additionalDeltaTime : 0
+            };
+            var endOfTrackEventWriter = EventWriterFactory.GetWriter(endOfTrackEvent);
+            eventHandler(endOfTrackEventWriter, endOfTrackEvent, true);
+        }
+
         private void ProcessEvents(WritingSettings settings, Action<IEventWriter, MidiEvent, bool> eventHandler)
         {
             byte? runningStatus = null;
@@ -0,0 +1,422 @@
+﻿using Melanchall.DryWetMidi.Common;
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.ComponentModel;
+
+namespace Melanchall.DryWetMidi.Core
+{
+    /// <summary>
+    /// Represents a read-only sequence of MIDI events of a track stored in a compact form.
+    /// </summary>
+    /// <remarks>
+    /// <para>Channel events are stored as delta-times, status bytes and data bytes in parallel
+    /// arrays rather than separate objects, so a track with millions of events occupies a few arrays
+    /// instead of millions of <see cref="MidiEvent"/> instances. All other events (meta, system exclusive
+    /// and so on) are stored as objects. Instances of <see cref="MidiEvent"/> are created on demand only,
+    /// for example, by <see cref="GetEvent(int)"/> or on enumerating of the track.</para>
+    /// <para>Compact track can be obtained with <see cref="TrackChunk.ToCompactTrack"/> or by reading
+    /// a MIDI file with <see cref="ReadingSettings.UseCompactEventsStorage"/> set to <c>true</c>. A track chunk
+    /// can be created from compact track with <see cref="TrackChunk(CompactTrack)"/> constructor.</para>
+    /// </remarks>
+    public sealed class CompactTrack : IEnumerable<MidiEvent>
+    {
+        #region Constants
+
+        private const int DefaultCapacity = 16;
+
+        // Channel events always have status byte of 0x80 or greater, so zero marks an event
+        // kept in the side storage
+        private const byte NonChannelEventStatusByte = 0;
+
+        #endregion
+
+        #region Fields
+
+        private long[] _deltaTimes;
+        private byte[] _statusBytes;
+        private byte[] _dataBytes1;
+        private byte[] _dataBytes2;
+        private int _count;
+
+        private readonly Dictionary<int, MidiEvent> _nonChannelEvents = new Dictionary<int, MidiEvent>();
+
+        #endregion
+
+        #region Constructor
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CompactTrack"/> with the specified events.
+        /// </summary>
+        /// <param name="events">Events to store in the compact track.</param>
+        /// <remarks>
+        /// <para>Events are copied so further changes of them don't affect the compact track.
+        /// <c>null</c> elements of <paramref name="events"/> are ignored.</para>
+        /// </remarks>
+        /// <exception cref="ArgumentNullException"><paramref name="events"/> is <c>null</c>.</exception>
+        public CompactTrack(IEnumerable<MidiEvent> events)
+            : this()
+        {
+            ThrowIfArgument.IsNull(nameof(events), events);
+
+            foreach (var midiEvent in events)
+            {
+                if (midiEvent == null)
+                    continue;
+
+                var channelEvent = midiEvent as ChannelEvent;
+                if (channelEvent != null)
+                    AddChannelEvent(
+                        channelEvent._deltaTime,
+                        DataTypesUtilities.CombineAsFourBitNumbers(GetStatusByteHead(channelEvent.EventType), channelEvent.Channel),
+                        channelEvent._dataByte1,
+                        channelEvent._dataByte2);
+                else
+                    AddNonChannelEvent(midiEvent.Clone());
+            }
+        }
+
+        internal CompactTrack()
+            : this(DefaultCapacity)
+        {
+        }
+
+        internal CompactTrack(int capacity)
+        {
+            capacity = Math.Max(capacity, DefaultCapacity);
+
+            _deltaTimes = new long[capacity];
+            _statusBytes = new byte[capacity];
+            _dataBytes1 = new byte[capacity];
+            _dataBytes2 = new byte[capacity];
+        }
+
+        #endregion
+
+        #region Properties
+
+        /// <summary>
+        /// Gets the number of events contained in the compact track.
+        /// </summary>
+        public int Count => _count;
+
+        #endregion
+
+        #region Methods
+
+        /// <summary>
+        /// Gets delta-time of the event at the specified index.
+        /// </summary>
+        /// <param name="index">The zero-based index of the event.</param>
+        /// <returns>Delta-time of the event at <paramref name="index"/>.</returns>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="index"/> is less than 0;
+        /// or <paramref name="index"/> is equal to or greater than <see cref="Count"/>.</exception>
+        public long GetDeltaTime(int index)
+        {
+            ThrowIfArgument.IsInvalidIndex(nameof(index), index, _count);
+
+            return _deltaTimes[index];
+        }
+
+        /// <summary>
+        /// Gets the type of the event at the specified index.
+        /// </summary>
+        /// <param name="index">The zero-based index of the event.</param>
+        /// <returns>The type of the event at <paramref name="index"/>.</returns>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="index"/> is less than 0;
+        /// or <paramref name="index"/> is equal to or greater than <see cref="Count"/>.</exception>
+        public MidiEventType GetEventType(int index)
+        {
+            ThrowIfArgument.IsInvalidIndex(nameof(index), index, _count);
+
+            return GetEventTypeInternal(index);
+        }
+
+        /// <summary>
+        /// Gets channel of the event at the specified index.
+        /// </summary>
+        /// <param name="index">The zero-based index of the event.</param>
+        /// <returns>Channel of the event at <paramref name="index"/>; or <c>null</c> if the event is
+        /// not a channel one.</returns>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="index"/> is less than 0;
+        /// or <paramref name="index"/> is equal to or greater than <see cref="Count"/>.</exception>
+        public FourBitNumber? GetChannel(int index)
+        {
+            ThrowIfArgument.IsInvalidIndex(nameof(index), index, _count);
+
+            var statusByte = _statusBytes[index];
+            return statusByte != NonChannelEventStatusByte
+                ? statusByte.GetTail()
+                : (FourBitNumber?)null;
+        }
+
+        /// <summary>
+        /// Creates an instance of <see cref="MidiEvent"/> representing the event at the specified index.
+        /// </summary>
+        /// <param name="index">The zero-based index of the event.</param>
+        /// <returns>A new instance of <see cref="MidiEvent"/> representing the event at <paramref name="index"/>.</returns>
+        /// <remarks>
+        /// <para>New object is created on every call so changes of the returned event don't affect
+        /// the compact track.</para>
+        /// </remarks>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="index"/> is less than 0;
+        /// or <paramref name="index"/> is equal to or greater than <see cref="Count"/>.</exception>
+        public MidiEvent GetEvent(int index)
+        {
+            ThrowIfArgument.IsInvalidIndex(nameof(index), index, _count);
+
+            return CreateEvent(index);
+        }
+
+        /// <summary>
+        /// Gets the number of events of the specified type.
+        /// </summary>
+        /// <param name="eventType">The type of events to count.</param>
+        /// <returns>The number of events of <paramref name="eventType"/> type.</returns>
+        /// <exception cref="InvalidEnumArgumentException"><paramref name="eventType"/> specified an invalid value.</exception>
+        public int GetEventsCount(MidiEventType eventType)
+        {
+            ThrowIfArgument.IsInvalidEnumValue(nameof(eventType), eventType);
+
+            var result = 0;
+
+            for (var i = 0; i < _count; i++)
+            {
+                if (GetEventTypeInternal(i) == eventType)
+                    result++;
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Gets channels used by channel events of the compact track.
+        /// </summary>
+        /// <returns>Collection of channels used by channel events in ascending order.</returns>
+        public ICollection<FourBitNumber> GetChannels()
+        {
+            var usedChannels = new bool[FourBitNumber.MaxValue + 1];
+
+            for (var i = 0; i < _count; i++)
+            {
+                var statusByte = _statusBytes[i];
+                if (statusByte != NonChannelEventStatusByte)
+                    usedChannels[statusByte & FourBitNumber.MaxValue] = true;
+            }
+
+            var result = new List<FourBitNumber>();
+
+            for (var channel = 0; channel < usedChannels.Length; channel++)
+            {
+                if (usedChannels[channel])
+                    result.Add((FourBitNumber)(byte)channel);
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Gets the sum of delta-times of all events of the compact track.
+        /// </summary>
+        /// <returns>The sum of delta-times of all events, i.e. absolute time of the last event.</returns>
+        public long GetTotalDeltaTime()
+        {
+            var result = 0L;
+
+            for (var i = 0; i < _count; i++)
+            {
+                result += _deltaTimes[i];
+            }
+
+            return result;
+        }
+
+        internal void AddChannelEvent(long deltaTime, byte statusByte, byte dataByte1, byte dataByte2)
+        {
+            EnsureCapacity();
+
+            _deltaTimes[_count] = deltaTime;
+            _statusBytes[_count] = statusByte;
+            _dataBytes1[_count] = dataByte1;
+            _dataBytes2[_count] = dataByte2;
+            _count++;
+        }
+
+        internal void AddNonChannelEvent(MidiEvent midiEvent)
+        {
+            EnsureCapacity();
+
+            _nonChannelEvents.Add(_count, midiEvent);
+
+            _deltaTimes[_count] = midiEvent._deltaTime;
+            _statusBytes[_count] = NonChannelEventStatusByte;
+            _dataBytes1[_count] = 0;
+            _dataBytes2[_count] = 0;
+            _count++;
+        }
+
+        internal bool IsChannelEvent(int index)
+        {
+            return _statusBytes[index] != NonChannelEventStatusByte;
+        }
+
+        internal long GetDeltaTimeInternal(int index)
+        {
+            return _deltaTimes[index];
+        }
+
+        internal byte GetStatusByteInternal(int index)
+        {
+            return _statusBytes[index];
+        }
+
+        internal byte GetDataByte1Internal(int index)
+        {
+            return _dataBytes1[index];
+        }
+
+        internal byte GetDataByte2Internal(int index)
+        {
+            return _dataBytes2[index];
+        }
+
+        internal MidiEvent GetNonChannelEventInternal(int index)
+        {
+            return _nonChannelEvents[index];
+        }
+
+        internal MidiEvent CreateEvent(int index)
+        {
+            var statusByte = _statusBytes[index];
+            if (statusByte == NonChannelEventStatusByte)
+                return _nonChannelEvents[index].Clone();
+
+            var channelEvent = CreateChannelEvent(statusByte);
+            channelEvent._deltaTime = _deltaTimes[index];
+            channelEvent.Channel = statusByte.GetTail();
+            channelEvent._dataByte1 = _dataBytes1[index];
+            channelEvent._dataByte2 = _dataBytes2[index];
+
+            return channelEvent;
+        }
+
+        internal static bool HasTwoDataBytes(byte statusByte)
+        {
+            var statusByteHead = statusByte.GetHead();
+            return statusByteHead != EventStatusBytes.Channel.ProgramChange &&
+                   statusByteHead != EventStatusBytes.Channel.ChannelAftertouch;
+        }
+
+        internal static MidiEventType GetChannelEventType(byte statusByte)
+        {
+            switch ((byte)statusByte.GetHead())
+            {
+                case EventStatusBytes.Channel.NoteOff:
+                    return MidiEventType.NoteOff;
+                case EventStatusBytes.Channel.NoteOn:
+                    return MidiEventType.NoteOn;
+                case EventStatusBytes.Channel.NoteAftertouch:
+                    return MidiEventType.NoteAftertouch;
+                case EventStatusBytes.Channel.ControlChange:
+                    return MidiEventType.ControlChange;
+                case EventStatusBytes.Channel.ProgramChange:
+                    return MidiEventType.ProgramChange;
+                case EventStatusBytes.Channel.ChannelAftertouch:
+                    return MidiEventType.ChannelAftertouch;
+                default:
+                    return MidiEventType.PitchBend;
+            }
+        }
+
+        private MidiEventType GetEventTypeInternal(int index)
+        {
+            var statusByte = _statusBytes[index];
+            return statusByte != NonChannelEventStatusByte
+                ? GetChannelEventType(statusByte)
+                : _nonChannelEvents[index].EventType;
+        }
+
+        private void EnsureCapacity()
+        {
+            if (_count < _statusBytes.Length)
+                return;
+
+            var capacity = (int)Math.Min(_statusBytes.Length * 2L, int.MaxValue);
+
+            Array.Resize(ref _deltaTimes, capacity);
+            Array.Resize(ref _statusBytes, capacity);
+            Array.Resize(ref _dataBytes1, capacity);
+            Array.Resize(ref _dataBytes2, capacity);
+        }
+
+        private static ChannelEvent CreateChannelEvent(byte statusByte)
+        {
+            switch ((byte)statusByte.GetHead())
+            {
+                case EventStatusBytes.Channel.NoteOff:
+                    return new NoteOffEvent();
+                case EventStatusBytes.Channel.NoteOn:
+                    return new NoteOnEvent();
+                case EventStatusBytes.Channel.NoteAftertouch:
+                    return new NoteAftertouchEvent();
+                case EventStatusBytes.Channel.ControlChange:
+                    return new ControlChangeEvent();
+                case EventStatusBytes.Channel.ProgramChange:
+                    return new ProgramChangeEvent();
+                case EventStatusBytes.Channel.ChannelAftertouch:
+                    return new ChannelAftertouchEvent();
+                default:
+                    return new PitchBendEvent();
+            }
+        }
+
+        private static byte GetStatusByteHead(MidiEventType eventType)
+        {
+            switch (eventType)
+            {
+                case MidiEventType.NoteOff:
+                    return EventStatusBytes.Channel.NoteOff;
+                case MidiEventType.NoteOn:
+                    return EventStatusBytes.Channel.NoteOn;
+                case MidiEventType.NoteAftertouch:
+                    return EventStatusBytes.Channel.NoteAftertouch;
+                case MidiEventType.ControlChange:
+                    return EventStatusBytes.Channel.ControlChange;
+                case MidiEventType.ProgramChange:
+                    return EventStatusBytes.Channel.ProgramChange;
+                case MidiEventType.ChannelAftertouch:
+                    return EventStatusBytes.Channel.ChannelAftertouch;
+                default:
+                    return EventStatusBytes.Channel.PitchBend;
+            }
+        }
+
+        #endregion
+
+        #region IEnumerable<MidiEvent>
+
+        /// <summary>
+        /// Returns an enumerator that iterates through the compact track creating an instance
+        /// of <see cref="MidiEvent"/> for each event.
+        /// </summary>
+        /// <returns>An enumerator that can be used to iterate through the compact track.</returns>
+        public IEnumerator<MidiEvent> GetEnumerator()
+        {
+            for (var i = 0; i < _count; i++)
+            {
+                yield return CreateEvent(i);
+            }
+        }
+
+        /// <summary>
+        /// Returns an enumerator that iterates through the compact track.
+        /// </summary>
+        /// <returns>An enumerator that can be used to iterate through the compact track.</returns>
+        IEnumerator IEnumerable.GetEnumerator()
+        {
+            return GetEnumerator();
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,33 @@
+﻿namespace Melanchall.DryWetMidi.Core
+{
+    internal sealed class DeferredTrackChunk
+    {
+        #region Constructor
+
+        public DeferredTrackChunk(TrackChunk trackChunk, byte[] data, uint size, bool isDataEndReached)
+        {
+            TrackChunk = trackChunk;
+            Data = data;
+            Size = size;
+            IsDataEndReached = isDataEndReached;
+        }
+
+        #endregion
+
+        #region Properties
+
+        public TrackChunk TrackChunk { get; }
+
+        // Content of the chunk followed by the first byte after it (if any), so reading
+        // beyond the chunk can be detected
+        public byte[] Data { get; }
+
+        public uint Size { get; }
+
+        public bool IsDataEndReached { get; }
+
+        public bool IsRead { get; set; }
+
+        #endregion
+    }
+}
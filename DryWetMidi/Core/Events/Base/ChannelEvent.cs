@@ -51,6 +51,11 @@ namespace Melanchall.DryWetMidi.Core
         /// <param name="settings">Settings according to which a data byte should be read and processed.</param>
         /// <returns>A data byte read with <paramref name="reader"/>.</returns>
         protected byte ReadDataByte(MidiReader reader, ReadingSettings settings)
+        {
+            return ReadDataByte(reader, settings, EventType);
+        }
+
+        internal static byte ReadDataByte(MidiReader reader, ReadingSettings settings, MidiEventType eventType)
         {
             var value = reader.ReadByte();
             if (value > SevenBitNumber.MaxValue)
@@ -58,7 +63,7 @@ namespace Melanchall.DryWetMidi.Core
                 switch (settings.InvalidChannelEventParameterValuePolicy)
                 {
                     case InvalidChannelEventParameterValuePolicy.Abort:
-                        throw new InvalidChannelEventParameterValueException(EventType, value);
+                        throw new InvalidChannelEventParameterValueException(eventType, value);
                     case InvalidChannelEventParameterValuePolicy.ReadValid:
                         value &= SevenBitNumber.MaxValue;
                         break;
@@ -78,13 +78,23 @@ namespace Melanchall.DryWetMidi.Core
                 return;
             }
 
+            var encoding = settings.TextEncoding ?? SmfConstants.DefaultTextEncoding;
+
+            var decodeTextCallback = settings.DecodeTextCallback;
+            if (decodeTextCallback == null)
+            {
+                string text;
+                if (reader.TryReadString(size, encoding, out text))
+                {
+                    Text = text;
+                    return;
+                }
+            }
+
             var bytes = reader.ReadBytes(size);
             if (bytes.Length != size && settings.NotEnoughBytesPolicy == NotEnoughBytesPolicy.Abort)
                 throw new NotEnoughBytesException("Not enough bytes in the stream to read the text of a text based meta event.", size, bytes.Length);
 
-            var encoding = settings.TextEncoding ?? SmfConstants.DefaultTextEncoding;
-
-            var decodeTextCallback = settings.DecodeTextCallback;
             Text = decodeTextCallback != null
                 ? decodeTextCallback(bytes, settings)
                 : encoding.GetString(bytes);
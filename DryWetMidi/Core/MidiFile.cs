@@ -459,97 +459,141 @@ namespace Melanchall.DryWetMidi.Core
 
             //
 
-            if (settings == null)
-                settings = new ReadingSettings();
-
-            if (settings.ReaderSettings == null)
-                settings.ReaderSettings = new ReaderSettings();
-
-            var file = new MidiFile();
+            settings = PrepareReadingSettings(settings);
 
-            int? expectedTrackChunksCount = null;
-            int actualTrackChunksCount = 0;
-            bool headerChunkIsRead = false;
-
-            //
-
-            try
+            using (var reader = new MidiReader(stream, settings.ReaderSettings))
             {
-                using (var reader = new MidiReader(stream, settings.ReaderSettings))
-                {
-                    if (reader.EndReached)
-                        throw new ArgumentException("Stream is already read.", nameof(stream));
-
-                    // Read RIFF header
-
-                    long? smfEndPosition = null;
-                    MidiFileReadingUtilities.ReadRmidPreamble(reader, out smfEndPosition);
-
-                    // Read SMF
-
-                    while (!reader.EndReached && (smfEndPosition == null || reader.Position < smfEndPosition))
-                    {
-                        if (expectedTrackChunksCount != null &&
-                            actualTrackChunksCount == expectedTrackChunksCount &&
-                            settings.StopReadingOnExpectedTrackChunksCountReached)
-                            return file;
-
-                        // Read chunk
-
-                        var chunk = ReadChunk(reader, settings, actualTrackChunksCount, expectedTrackChunksCount);
-                        if (chunk == null)
-                            continue;
-
-                        // Process header chunk
-
-                        var headerChunk = chunk as HeaderChunk;
-                        if (headerChunk != null)
-                        {
-                            if (!headerChunkIsRead)
-                            {
-                                expectedTrackChunksCount = headerChunk.TracksNumber;
-                                file.TimeDivision = headerChunk.TimeDivision;
-                                file._originalFormat = headerChunk.FileFormat;
-                            }
-
-                            headerChunkIsRead = true;
-                            continue;
-                        }
-
-                        // Process track chunk
-
-                        if (chunk is TrackChunk)
-                            actualTrackChunksCount++;
+                if (reader.EndReached)
+                    throw new ArgumentException("Stream is already read.", nameof(stream));
 
-                        // Add chunk to chunks collection of the file
+                return Read(reader, settings);
+            }
+        }
 
-                        file.Chunks.Add(chunk);
-                    }
+        /// <summary>
+        /// Reads a MIDI file from the specified byte array.
+        /// </summary>
+        /// <param name="data">Bytes of a MIDI file.</param>
+        /// <param name="settings">Settings according to which the file must be read. Specify <c>null</c> to use
+        /// default settings.</param>
+        /// <returns>An instance of the <see cref="MidiFile"/> representing a MIDI file was read from the
+        /// <paramref name="data"/>.</returns>
+        /// <remarks>
+        /// Data is read directly from the <paramref name="data"/> without wrapping it into a stream and copying
+        /// to an intermediate buffer, so it's the fastest way to read a MIDI file which is already in memory.
+        /// <see cref="ReaderSettings.BufferingPolicy"/> of the <paramref name="settings"/> is ignored.
+        /// </remarks>
+        /// <exception cref="ArgumentNullException"><paramref name="data"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException"><paramref name="data"/> is empty.</exception>
+        /// <exception cref="NoHeaderChunkException">There is no header chunk in a file and that should be treated as error
+        /// according to the <see cref="ReadingSettings.NoHeaderChunkPolicy"/> of the <paramref name="settings"/>.</exception>
+        /// <exception cref="InvalidChunkSizeException">Actual header or track chunk's size differs from the one declared
+        /// in its header and that should be treated as error according to the <see cref="ReadingSettings.InvalidChunkSizePolicy"/>
+        /// of the <paramref name="settings"/>.</exception>
+        /// <exception cref="UnknownChunkException">Chunk to be read has unknown ID and that
+        /// should be treated as error according to the <see cref="ReadingSettings.UnknownChunkIdPolicy"/> of the
+        /// <paramref name="settings"/>.</exception>
+        /// <exception cref="UnexpectedTrackChunksCountException">Actual track chunks
+        /// count differs from the expected one (declared in the file header) and that should be treated as error according to
+        /// the <see cref="ReadingSettings.UnexpectedTrackChunksCountPolicy"/> of the specified <paramref name="settings"/>.</exception>
+        /// <exception cref="UnknownFileFormatException">The header chunk of the file specifies unknown file format and
+        /// that should be treated as error according to the <see cref="ReadingSettings.UnknownFileFormatPolicy"/> of
+        /// the <paramref name="settings"/>.</exception>
+        /// <exception cref="InvalidChannelEventParameterValueException">Value of a channel event's parameter
+        /// just read is invalid (is out of [0; 127] range) and that should be treated as error according to the
+        /// <see cref="ReadingSettings.InvalidChannelEventParameterValuePolicy"/> of the <paramref name="settings"/>.</exception>
+        /// <exception cref="InvalidMetaEventParameterValueException">Value of a meta event's parameter
+        /// just read is invalid and that should be treated as error according to the
+        /// <see cref="ReadingSettings.InvalidMetaEventParameterValuePolicy"/> of the <paramref name="settings"/>.</exception>
+        /// <exception cref="UnknownChannelEventException">Reader has encountered an unknown channel event and that
+        /// should be treated as error according to the <see cref="ReadingSettings.UnknownChannelEventPolicy"/> of
+        /// the <paramref name="settings"/>.</exception>
+        /// <exception cref="NotEnoughBytesException">MIDI file data cannot be read since the reader's underlying stream doesn't
+        /// have enough bytes and that should be treated as error according to the <see cref="ReadingSettings.NotEnoughBytesPolicy"/>
+        /// of the <paramref name="settings"/>.</exception>
+        /// <exception cref="UnexpectedRunningStatusException">Unexpected running status is encountered.</exception>
+        /// <exception cref="MissedEndOfTrackEventException">Track chunk doesn't end with <c>End Of Track</c> event and that
+        /// should be treated as error according to the <see cref="ReadingSettings.MissedEndOfTrackPolicy"/> of
+        /// the <paramref name="settings"/>.</exception>
+        public static MidiFile Read(byte[] data, ReadingSettings settings = null)
+        {
+            ThrowIfArgument.IsNull(nameof(data), data);
 
-                    if (expectedTrackChunksCount != null && actualTrackChunksCount != expectedTrackChunksCount)
-                        ReactOnUnexpectedTrackChunksCount(settings.UnexpectedTrackChunksCountPolicy, actualTrackChunksCount, expectedTrackChunksCount.Value);
-                }
+            return Read(data, 0, data.Length, settings);
+        }
 
-                // Process header chunks count
+        /// <summary>
+        /// Reads a MIDI file from the specified region of a byte array.
+        /// </summary>
+        /// <param name="data">Array containing bytes of a MIDI file.</param>
+        /// <param name="offset">Index of the first byte of the file within the <paramref name="data"/>.</param>
+        /// <param name="count">The number of bytes of the file.</param>
+        /// <param name="settings">Settings according to which the file must be read. Specify <c>null</c> to use
+        /// default settings.</param>
+        /// <returns>An instance of the <see cref="MidiFile"/> representing a MIDI file was read from the
+        /// <paramref name="data"/>.</returns>
+        /// <remarks>
+        /// Data is read directly from the <paramref name="data"/> without wrapping it into a stream and copying
+        /// to an intermediate buffer, so it's the fastest way to read a MIDI file which is already in memory.
+        /// <see cref="ReaderSettings.BufferingPolicy"/> of the <paramref name="settings"/> is ignored.
+        /// </remarks>
+        /// <exception cref="ArgumentNullException"><paramref name="data"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">
+        /// One of the following errors occurred:
+        /// <list type="bullet">
+        /// <item>
+        /// <description><paramref name="offset"/> is out of range of the <paramref name="data"/>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="count"/> is negative or exceeds the number of bytes
+        /// after the <paramref name="offset"/>.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        /// <exception cref="ArgumentException"><paramref name="count"/> is zero.</exception>
+        /// <exception cref="NoHeaderChunkException">There is no header chunk in a file and that should be treated as error
+        /// according to the <see cref="ReadingSettings.NoHeaderChunkPolicy"/> of the <paramref name="settings"/>.</exception>
+        /// <exception cref="InvalidChunkSizeException">Actual header or track chunk's size differs from the one declared
+        /// in its header and that should be treated as error according to the <see cref="ReadingSettings.InvalidChunkSizePolicy"/>
+        /// of the <paramref name="settings"/>.</exception>
+        /// <exception cref="UnknownChunkException">Chunk to be read has unknown ID and that
+        /// should be treated as error according to the <see cref="ReadingSettings.UnknownChunkIdPolicy"/> of the
+        /// <paramref name="settings"/>.</exception>
+        /// <exception cref="UnexpectedTrackChunksCountException">Actual track chunks
+        /// count differs from the expected one (declared in the file header) and that should be treated as error according to
+        /// the <see cref="ReadingSettings.UnexpectedTrackChunksCountPolicy"/> of the specified <paramref name="settings"/>.</exception>
+        /// <exception cref="UnknownFileFormatException">The header chunk of the file specifies unknown file format and
+        /// that should be treated as error according to the <see cref="ReadingSettings.UnknownFileFormatPolicy"/> of
+        /// the <paramref name="settings"/>.</exception>
+        /// <exception cref="InvalidChannelEventParameterValueException">Value of a channel event's parameter
+        /// just read is invalid (is out of [0; 127] range) and that should be treated as error according to the
+        /// <see cref="ReadingSettings.InvalidChannelEventParameterValuePolicy"/> of the <paramref name="settings"/>.</exception>
+        /// <exception cref="InvalidMetaEventParameterValueException">Value of a meta event's parameter
+        /// just read is invalid and that should be treated as error according to the
+        /// <see cref="ReadingSettings.InvalidMetaEventParameterValuePolicy"/> of the <paramref name="settings"/>.</exception>
+        /// <exception cref="UnknownChannelEventException">Reader has encountered an unknown channel event and that
+        /// should be treated as error according to the <see cref="ReadingSettings.UnknownChannelEventPolicy"/> of
+        /// the <paramref name="settings"/>.</exception>
+        /// <exception cref="NotEnoughBytesException">MIDI file data cannot be read since the reader's underlying stream doesn't
+        /// have enough bytes and that should be treated as error according to the <see cref="ReadingSettings.NotEnoughBytesPolicy"/>
+        /// of the <paramref name="settings"/>.</exception>
+        /// <exception cref="UnexpectedRunningStatusException">Unexpected running status is encountered.</exception>
+        /// <exception cref="MissedEndOfTrackEventException">Track chunk doesn't end with <c>End Of Track</c> event and that
+        /// should be treated as error according to the <see cref="ReadingSettings.MissedEndOfTrackPolicy"/> of
+        /// the <paramref name="settings"/>.</exception>
+        public static MidiFile Read(byte[] data, int offset, int count, ReadingSettings settings = null)
+        {
+            ThrowIfArgument.IsNull(nameof(data), data);
 
-                if (!headerChunkIsRead)
-                {
-                    file.TimeDivision = null;
+            settings = PrepareReadingSettings(settings);
 
-                    if (settings.NoHeaderChunkPolicy == NoHeaderChunkPolicy.Abort)
-                        throw new NoHeaderChunkException();
-                }
-            }
-            catch (NotEnoughBytesException ex)
-            {
-                ReactOnNotEnoughBytes(settings.NotEnoughBytesPolicy, ex);
-            }
-            catch (EndOfStreamException ex)
+            using (var reader = new MidiReader(data, offset, count, settings.ReaderSettings))
             {
-                ReactOnNotEnoughBytes(settings.NotEnoughBytesPolicy, ex);
-            }
+                if (reader.EndReached)
+                    throw new ArgumentException("Data is empty.", nameof(count));
 
-            return file;
+                return Read(reader, settings);
+            }
         }
 
         /// <summary>
@@ -652,11 +696,15 @@ namespace Melanchall.DryWetMidi.Core
                     headerChunk.Write(writer, settings);
                 }
 
-                foreach (var chunk in chunks)
+                var chunksToWrite = chunks.Where(c => !(c is UnknownChunk && settings.DeleteUnknownChunks)).ToList();
+                if (settings.MaxDegreeOfParallelism > 1 && chunksToWrite.Count > 1)
                 {
-                    if (chunk is UnknownChunk && settings.DeleteUnknownChunks)
-                        continue;
+                    MidiFileWritingUtilities.WriteChunksInParallel(writer, chunksToWrite, settings);
+                    return;
+                }
 
+                foreach (var chunk in chunksToWrite)
+                {
                     chunk.Write(writer, settings);
                 }
             }
@@ -798,7 +846,158 @@ namespace Melanchall.DryWetMidi.Core
                 timeDivision ?? new TicksPerQuarterNoteTimeDivision());
         }
 
-        private static MidiChunk ReadChunk(MidiReader reader, ReadingSettings settings, int actualTrackChunksCount, int? expectedTrackChunksCount)
+        internal static ReadingSettings PrepareReadingSettings(ReadingSettings settings)
+        {
+            if (settings == null)
+                settings = new ReadingSettings();
+
+            if (settings.ReaderSettings == null)
+                settings.ReaderSettings = new ReaderSettings();
+
+            return settings;
+        }
+
+        private static MidiFile Read(MidiReader reader, ReadingSettings settings)
+        {
+            if (settings.MaxDegreeOfParallelism > 1 && reader.SupportsRandomAccess)
+            {
+                var startPosition = reader.Position;
+
+                var file = ReadInParallel(reader, settings);
+                if (file != null)
+                    return file;
+
+                // Something went wrong so the data is read again sequentially to get
+                // exactly the same result (or error) as without parallelism
+
+                reader.Position = startPosition;
+            }
+
+            return Read(reader, settings, null, null);
+        }
+
+        // Goes through the chunks the same way Read does but skips content of track chunks,
+        // so they can be read later by the returned locations
+        internal static IList<TrackChunkLocation> ReadTrackChunksLocations(MidiReader reader, ReadingSettings settings)
+        {
+            var trackChunksLocations = new List<TrackChunkLocation>();
+            Read(reader, settings, null, trackChunksLocations);
+            return trackChunksLocations;
+        }
+
+        private static MidiFile ReadInParallel(MidiReader reader, ReadingSettings settings)
+        {
+            var deferredTrackChunks = new List<DeferredTrackChunk>();
+            MidiFile file;
+
+            try
+            {
+                file = Read(reader, settings, deferredTrackChunks, null);
+            }
+            catch (Exception)
+            {
+                return null;
+            }
+
+            return MidiFileReadingUtilities.ReadDeferredTrackChunks(deferredTrackChunks, settings)
+                ? file
+                : null;
+        }
+
+        private static MidiFile Read(
+            MidiReader reader,
+            ReadingSettings settings,
+            ICollection<DeferredTrackChunk> deferredTrackChunks,
+            ICollection<TrackChunkLocation> trackChunksLocations)
+        {
+            var file = new MidiFile();
+
+            int? expectedTrackChunksCount = null;
+            int actualTrackChunksCount = 0;
+            bool headerChunkIsRead = false;
+
+            //
+
+            try
+            {
+                // Read RIFF header
+
+                long? smfEndPosition = null;
+                MidiFileReadingUtilities.ReadRmidPreamble(reader, out smfEndPosition);
+
+                // Read SMF
+
+                while (!reader.EndReached && (smfEndPosition == null || reader.Position < smfEndPosition))
+                {
+                    if (expectedTrackChunksCount != null &&
+                        actualTrackChunksCount == expectedTrackChunksCount &&
+                        settings.StopReadingOnExpectedTrackChunksCountReached)
+                        return file;
+
+                    // Read chunk
+
+                    var chunk = ReadChunk(reader, settings, actualTrackChunksCount, expectedTrackChunksCount, deferredTrackChunks, trackChunksLocations);
+                    if (chunk == null)
+                        continue;
+
+                    // Process header chunk
+
+                    var headerChunk = chunk as HeaderChunk;
+                    if (headerChunk != null)
+                    {
+                        if (!headerChunkIsRead)
+                        {
+                            expectedTrackChunksCount = headerChunk.TracksNumber;
+                            file.TimeDivision = headerChunk.TimeDivision;
+                            file._originalFormat = headerChunk.FileFormat;
+                        }
+
+                        headerChunkIsRead = true;
+                        continue;
+                    }
+
+                    // Process track chunk
+
+                    if (chunk is TrackChunk)
+                        actualTrackChunksCount++;
+
+                    // Add chunk to chunks collection of the file
+
+                    file.Chunks.Add(chunk);
+                }
+
+                if (expectedTrackChunksCount != null && actualTrackChunksCount != expectedTrackChunksCount)
+                    ReactOnUnexpectedTrackChunksCount(settings.UnexpectedTrackChunksCountPolicy, actualTrackChunksCount, expectedTrackChunksCount.Value);
+
+                // Process header chunks count
+
+                if (!headerChunkIsRead)
+                {
+                    file.TimeDivision = null;
+
+                    if (settings.NoHeaderChunkPolicy == NoHeaderChunkPolicy.Abort)
+                        throw new NoHeaderChunkException();
+                }
+            }
+            catch (NotEnoughBytesException ex)
+            {
+                ReactOnNotEnoughBytes(settings.NotEnoughBytesPolicy, ex);
+            }
+            catch (EndOfStreamException ex)
+            {
+                ReactOnNotEnoughBytes(settings.NotEnoughBytesPolicy, ex);
+            }
+
+            return file;
+        }
+
+        private static MidiChunk ReadChunk(
+            MidiReader reader,
+            ReadingSettings settings,
+            int actualTrackChunksCount,
+            int? expectedTrackChunksCount,
+            ICollection<DeferredTrackChunk> deferredTrackChunks,
+            ICollection<TrackChunkLocation> trackChunksLocations)
         {
             MidiChunk chunk = null;
 
@@ -867,7 +1066,19 @@ namespace Melanchall.DryWetMidi.Core
                     }
                 }
 
-                chunk?.Read(reader, settings);
+                var trackChunk = chunk as TrackChunk;
+                if (trackChunk != null && trackChunksLocations != null)
+                {
+                    long readerPosition;
+                    var size = MidiChunk.ReadSize(reader, out readerPosition);
+
+                    trackChunksLocations.Add(new TrackChunkLocation(readerPosition, size));
+                    reader.Position += size;
+                }
+                else if (trackChunk != null && deferredTrackChunks != null)
+                    MidiFileReadingUtilities.DeferTrackChunkReading(reader, trackChunk, settings, deferredTrackChunks);
+                else
+                    chunk?.Read(reader, settings);
             }
             catch (NotEnoughBytesException ex)
             {
@@ -893,7 +1104,7 @@ namespace Melanchall.DryWetMidi.Core
             }
         }
 
-        private static void ReactOnNotEnoughBytes(NotEnoughBytesPolicy policy, Exception exception)
+        internal static void ReactOnNotEnoughBytes(NotEnoughBytesPolicy policy, Exception exception)
         {
             if (policy == NotEnoughBytesPolicy.Abort)
                 throw new NotEnoughBytesException("MIDI file cannot be read since the reader's underlying stream doesn't have enough bytes.", exception);
@@ -1,4 +1,8 @@
 ﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
 
 namespace Melanchall.DryWetMidi.Core
 {
@@ -36,6 +40,127 @@ namespace Melanchall.DryWetMidi.Core
                 : null;
         }
 
+        public static void DeferTrackChunkReading(
+            MidiReader reader,
+            TrackChunk trackChunk,
+            ReadingSettings settings,
+            ICollection<DeferredTrackChunk> deferredTrackChunks)
+        {
+            long readerPosition;
+            var size = MidiChunk.ReadSize(reader, out readerPosition);
+
+            // Chunk that is not entirely within the data is read right now since its
+            // reading depends on the data end
+
+            var availableBytesCount = reader.Length - readerPosition;
+            var dataSize = Math.Min(size + 1L, availableBytesCount);
+            if (size > availableBytesCount || dataSize > int.MaxValue)
+            {
+                trackChunk.ReadContent(reader, settings, size, readerPosition);
+                return;
+            }
+
+            var data = reader.ReadBytes((int)dataSize);
+            if (data.Length != dataSize)
+            {
+                reader.Position = readerPosition;
+                trackChunk.ReadContent(reader, settings, size, readerPosition);
+                return;
+            }
+
+            reader.Position = readerPosition + size;
+            deferredTrackChunks.Add(new DeferredTrackChunk(trackChunk, data, size, dataSize == availableBytesCount));
+        }
+
+        // Finds track chunks skipping their content and returns lazy collections of their events.
+        // Each collection is read by its own reader but all readers work on the same stream which
+        // is possible since a buffered reader positions the stream every time it fills the buffer
+        public static IEnumerable<MidiEvent>[] GetTrackChunksEventsLazy(Stream stream, ReadingSettings settings)
+        {
+            var readerSettings = new ReaderSettings
+            {
+                BufferingPolicy = BufferingPolicy.UseFixedSizeBuffer,
+                BufferSize = settings.ReaderSettings.BufferSize,
+                BytesPacketMaxLength = settings.ReaderSettings.BytesPacketMaxLength
+            };
+
+            var startPosition = stream.Position;
+            IList<TrackChunkLocation> trackChunksLocations;
+
+            try
+            {
+                using (var reader = new MidiReader(stream, readerSettings))
+                {
+                    trackChunksLocations = MidiFile.ReadTrackChunksLocations(reader, settings);
+                }
+            }
+            catch (Exception)
+            {
+                // Sizes of chunks can be invalid, so the data is read sequentially to get exactly
+                // the same result (or error) as on reading of the whole file
+
+                stream.Position = startPosition;
+                return MidiFile.Read(stream, settings)
+                    .GetTrackChunks()
+                    .Select(c => (IEnumerable<MidiEvent>)c.Events)
+                    .ToArray();
+            }
+
+            return trackChunksLocations
+                .Select(l => EnumerateTrackChunkEvents(stream, readerSettings, settings, l))
+                .ToArray();
+        }
+
+        public static bool ReadDeferredTrackChunks(IList<DeferredTrackChunk> deferredTrackChunks, ReadingSettings settings)
+        {
+            if (deferredTrackChunks.Count == 1)
+                ReadDeferredTrackChunk(deferredTrackChunks[0], settings);
+            else if (deferredTrackChunks.Count > 1)
+                Parallel.ForEach(
+                    deferredTrackChunks,
+                    new ParallelOptions { MaxDegreeOfParallelism = settings.MaxDegreeOfParallelism },
+                    deferredTrackChunk => ReadDeferredTrackChunk(deferredTrackChunk, settings));
+
+            return deferredTrackChunks.All(c => c.IsRead);
+        }
+
+        private static void ReadDeferredTrackChunk(DeferredTrackChunk deferredTrackChunk, ReadingSettings settings)
+        {
+            try
+            {
+                using (var reader = new MidiReader(deferredTrackChunk.Data, 0, deferredTrackChunk.Data.Length, settings.ReaderSettings))
+                {
+                    deferredTrackChunk.TrackChunk.ReadContent(reader, settings, deferredTrackChunk.Size, 0);
+
+                    // Reading beyond the chunk gives the same result as sequential one only
+                    // if the data ends right after the chunk
+                    deferredTrackChunk.IsRead = reader.Position <= deferredTrackChunk.Size || deferredTrackChunk.IsDataEndReached;
+                }
+            }
+            catch (Exception)
+            {
+                // Error will be reproduced by sequential reading
+                deferredTrackChunk.IsRead = false;
+            }
+        }
+
+        private static IEnumerable<MidiEvent> EnumerateTrackChunkEvents(
+            Stream stream,
+            ReaderSettings readerSettings,
+            ReadingSettings settings,
+            TrackChunkLocation trackChunkLocation)
+        {
+            using (var reader = new MidiReader(stream, readerSettings))
+            {
+                reader.Position = trackChunkLocation.ContentPosition;
+
+                foreach (var midiEvent in TrackChunk.EnumerateEvents(reader, settings, trackChunkLocation.Size))
+                {
+                    yield return midiEvent;
+                }
+            }
+        }
+
         private static bool IsChunkType(Type type)
         {
             return type != null &&
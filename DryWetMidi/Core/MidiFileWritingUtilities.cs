@@ -0,0 +1,58 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.ExceptionServices;
+using System.Threading.Tasks;
+
+namespace Melanchall.DryWetMidi.Core
+{
+    internal static class MidiFileWritingUtilities
+    {
+        #region Methods
+
+        public static void WriteChunksInParallel(MidiWriter writer, IList<MidiChunk> chunks, WritingSettings settings)
+        {
+            var chunksData = new MemoryStream[chunks.Count];
+            var exceptions = new Exception[chunks.Count];
+
+            // Chunk data is collected in memory stream so there is no need in additional buffering
+            var chunkWriterSettings = new WriterSettings { UseBuffering = false };
+
+            Parallel.For(
+                0,
+                chunks.Count,
+                new ParallelOptions { MaxDegreeOfParallelism = settings.MaxDegreeOfParallelism },
+                i =>
+                {
+                    var chunkData = new MemoryStream();
+                    chunksData[i] = chunkData;
+
+                    try
+                    {
+                        using (var chunkWriter = new MidiWriter(chunkData, chunkWriterSettings))
+                        {
+                            chunks[i].Write(chunkWriter, settings);
+                        }
+                    }
+                    catch (Exception ex)
+                    {
+                        exceptions[i] = ex;
+                    }
+                });
+
+            // Data written before an error is written to the output too, so the result
+            // is the same as for sequential writing
+
+            for (var i = 0; i < chunks.Count; i++)
+            {
+                var chunkData = chunksData[i];
+                writer.WriteBytes(chunkData.GetBuffer(), 0, (int)chunkData.Length);
+
+                if (exceptions[i] != null)
+                    ExceptionDispatchInfo.Capture(exceptions[i]).Throw();
+            }
+        }
+
+        #endregion
+    }
+}
@@ -2,7 +2,9 @@
 using System;
 using System.Collections.Generic;
 using System.IO;
+using System.IO.MemoryMappedFiles;
 using System.Linq;
+using System.Text;
 
 namespace Melanchall.DryWetMidi.Core
 {
@@ -24,6 +26,11 @@ namespace Melanchall.DryWetMidi.Core
         private readonly Stream _stream;
         private readonly bool _isStreamWrapped;
 
+        private readonly MemoryMappedFile _memoryMappedFile;
+
+        private readonly byte[] _data;
+        private readonly int _dataOffset;
+
         private readonly bool _useBuffering;
         private byte[] _buffer;
         private int _bufferSize;
@@ -73,11 +80,68 @@ namespace Melanchall.DryWetMidi.Core
             _stream = stream;
             Length = _stream.Length;
 
+            var fileStream = _stream as FileStream;
+            if (_settings.BufferingPolicy == BufferingPolicy.UseMemoryMappedFile && fileStream != null && Length > 0)
+            {
+                _memoryMappedFile = CreateMemoryMappedFile(fileStream);
+                _stream = _memoryMappedFile.CreateViewStream(0, Length, MemoryMappedFileAccess.Read);
+            }
+
             _useBuffering = _settings.BufferingPolicy != BufferingPolicy.DontUseBuffering && !_isStreamWrapped && !(_stream is MemoryStream);
             if (_useBuffering)
                 PrepareBuffer();
         }
 
+        /// <summary>
+        /// Initializes a new instance of the <see cref="MidiReader"/> with the specified region of
+        /// a byte array.
+        /// </summary>
+        /// <remarks>
+        /// Data is read directly from the <paramref name="data"/> without copying it to an internal
+        /// buffer, so <see cref="ReaderSettings.BufferingPolicy"/> is ignored. The array must not be
+        /// changed while the reader is in use.
+        /// </remarks>
+        /// <param name="data">Array to read MIDI data from.</param>
+        /// <param name="offset">Index of the first byte of MIDI data within the <paramref name="data"/>.</param>
+        /// <param name="count">The number of bytes of MIDI data.</param>
+        /// <param name="settings">Settings according to which MIDI data should be read.</param>
+        /// <exception cref="ArgumentNullException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><paramref name="data"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="settings"/> is <c>null</c>.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        /// <exception cref="ArgumentOutOfRangeException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><paramref name="offset"/> is out of range of the <paramref name="data"/>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="count"/> is negative or exceeds the number of bytes
+        /// after the <paramref name="offset"/>.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        public MidiReader(byte[] data, int offset, int count, ReaderSettings settings)
+        {
+            ThrowIfArgument.IsNull(nameof(data), data);
+            ThrowIfArgument.IsOutOfRange(nameof(offset), offset, 0, data.Length, "Offset is out of range.");
+            ThrowIfArgument.IsOutOfRange(nameof(count), count, 0, data.Length - offset, "Count is out of range.");
+            ThrowIfArgument.IsNull(nameof(settings), settings);
+
+            _settings = settings;
+
+            _data = data;
+            _dataOffset = offset;
+            Length = count;
+        }
+
         #endregion
 
         #region Properties
@@ -89,12 +153,12 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="ObjectDisposedException">Property was called after the reader was disposed.</exception>
         public long Position
         {
-            get { return _useBuffering ? _position : _stream.Position; }
+            get { return _useBuffering || _data != null ? _position : _stream.Position; }
             set
             {
                 if (_useBuffering)
                     _bufferPosition += (int)(value - _position);
-                else
+                else if (_data == null)
                     _stream.Position = value;
 
                 _position = value;
@@ -113,6 +177,8 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="ObjectDisposedException">Property was called after the reader was disposed.</exception>
         public bool EndReached => Position >= Length || (_isStreamWrapped && ((StreamWrapper)_stream).IsEndReached());
 
+        internal bool SupportsRandomAccess => !_isStreamWrapped;
+
         #endregion
 
         #region Methods
@@ -126,7 +192,14 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="IOException">An I/O error occurred on the underlying stream.</exception>
         public byte ReadByte()
         {
-            if (_useBuffering)
+            if (_data != null)
+            {
+                if (_position >= Length)
+                    throw new EndOfStreamException();
+
+                return _data[_dataOffset + (int)_position++];
+            }
+            else if (_useBuffering)
             {
                 if (!EnsureBufferIsReadyForReading())
                     throw new EndOfStreamException();
@@ -202,6 +275,11 @@ namespace Melanchall.DryWetMidi.Core
         {
             const int wordSize = sizeof(ushort);
 
+            byte[] buffer;
+            int index;
+            if (TryReadDirectly(wordSize, out buffer, out index))
+                return (ushort)((buffer[index] << 8) + buffer[index + 1]);
+
             var bytes = ReadBytes(wordSize);
             if (bytes.Length < wordSize)
                 throw new NotEnoughBytesException("Not enough bytes in the stream to read a WORD.", wordSize, bytes.Length);
@@ -221,6 +299,11 @@ namespace Melanchall.DryWetMidi.Core
         {
             const int dwordSize = sizeof(uint);
 
+            byte[] buffer;
+            int index;
+            if (TryReadDirectly(dwordSize, out buffer, out index))
+                return (uint)((buffer[index] << 24) + (buffer[index + 1] << 16) + (buffer[index + 2] << 8) + buffer[index + 3]);
+
             var bytes = ReadBytes(dwordSize);
             if (bytes.Length < dwordSize)
                 throw new NotEnoughBytesException("Not enough bytes in the stream to read a DWORD.", dwordSize, bytes.Length);
@@ -240,6 +323,11 @@ namespace Melanchall.DryWetMidi.Core
         {
             const int int16Size = sizeof(short);
 
+            byte[] buffer;
+            int index;
+            if (TryReadDirectly(int16Size, out buffer, out index))
+                return (short)((buffer[index] << 8) + buffer[index + 1]);
+
             var bytes = ReadBytes(int16Size);
             if (bytes.Length < int16Size)
                 throw new NotEnoughBytesException("Not enough bytes in the stream to read a INT16.", int16Size, bytes.Length);
@@ -258,10 +346,28 @@ namespace Melanchall.DryWetMidi.Core
         /// <exception cref="IOException">An I/O error occurred on the underlying stream.</exception>
         public string ReadString(int count)
         {
+            string result;
+            if (TryReadString(count, SmfConstants.DefaultTextEncoding, out result))
+                return result;
+
             var bytes = ReadBytesInternal(count);
             return SmfConstants.DefaultTextEncoding.GetString(bytes);
         }
 
+        // Decodes a string right from the data the reader works on avoiding an intermediate array
+        internal bool TryReadString(int count, Encoding encoding, out string result)
+        {
+            result = null;
+
+            byte[] buffer;
+            int index;
+            if (count < 0 || !TryReadDirectly(count, out buffer, out index))
+                return false;
+
+            result = encoding.GetString(buffer, index, count);
+            return true;
+        }
+
         /// <summary>
         /// Reads a 32-bit signed integer presented in compressed format called variable-length quantity (VLQ)
         /// to the underlying stream.
@@ -330,6 +436,11 @@ namespace Melanchall.DryWetMidi.Core
         {
             const int dwordSize = 3;
 
+            byte[] buffer;
+            int index;
+            if (TryReadDirectly(dwordSize, out buffer, out index))
+                return (uint)((buffer[index] << 16) + (buffer[index + 1] << 8) + buffer[index + 2]);
+
             var bytes = ReadBytes(dwordSize);
             if (bytes.Length < dwordSize)
                 throw new NotEnoughBytesException("Not enough bytes in the stream to read a 3-byte DWORD.", dwordSize, bytes.Length);
@@ -342,7 +453,9 @@ namespace Melanchall.DryWetMidi.Core
             if (count == 0)
                 return EmptyByteArray;
 
-            if (_useBuffering)
+            if (_data != null)
+                return ReadBytesFromData(count);
+            else if (_useBuffering)
                 return ReadBytesWithBuffering(count);
             else
                 return ReadBytesWithoutBuffering(count);
@@ -356,18 +469,32 @@ namespace Melanchall.DryWetMidi.Core
             if (_bufferPosition + count <= _bufferSize)
                 return ReadBytesFromBuffer(count);
 
-            var availableBytesCount = _bufferSize - _bufferPosition;
-            if (availableBytesCount == 0)
-                return EmptyByteArray;
+            // Bytes are collected from buffer refills into the single array, so reading
+            // of large data (a whole chunk for example) doesn't copy it over and over
+
+            var result = new byte[count];
+            var totalReadBytesCount = 0;
+
+            do
+            {
+                var availableBytesCount = Math.Min(_bufferSize - _bufferPosition, count - totalReadBytesCount);
+                if (availableBytesCount <= 0)
+                    break;
+
+                Buffer.BlockCopy(_buffer, _bufferPosition, result, totalReadBytesCount, availableBytesCount);
+                Position += availableBytesCount;
+                totalReadBytesCount += availableBytesCount;
+            }
+            while (totalReadBytesCount < count && EnsureBufferIsReadyForReading());
 
-            var firstBytes = ReadBytesFromBuffer(availableBytesCount);
-            var lastBytes = ReadBytesWithBuffering(count - availableBytesCount);
-            
-            var fullBytes = new byte[firstBytes.Length + lastBytes.Length];
-            Buffer.BlockCopy(firstBytes, 0, fullBytes, 0, firstBytes.Length);
-            Buffer.BlockCopy(lastBytes, 0, fullBytes, firstBytes.Length, lastBytes.Length);
+            if (totalReadBytesCount != result.Length)
+            {
+                var copy = new byte[totalReadBytesCount];
+                Buffer.BlockCopy(result, 0, copy, 0, totalReadBytesCount);
+                result = copy;
+            }
 
-            return fullBytes;
+            return result;
         }
 
         private byte[] ReadBytesFromBuffer(int count)
@@ -378,6 +505,47 @@ namespace Melanchall.DryWetMidi.Core
             return result;
         }
 
+        private byte[] ReadBytesFromData(int count)
+        {
+            ThrowIfArgument.IsNegative(nameof(count), count, "Count is negative.");
+
+            count = (int)Math.Min(count, Length - _position);
+            if (count <= 0)
+                return EmptyByteArray;
+
+            var result = new byte[count];
+            Buffer.BlockCopy(_data, _dataOffset + (int)_position, result, 0, count);
+            _position += count;
+            return result;
+        }
+
+        // Provides the specified number of next bytes as a region of an array the reader
+        // reads data from (if the bytes are available there) and advances the position
+        private bool TryReadDirectly(int count, out byte[] buffer, out int index)
+        {
+            buffer = null;
+            index = 0;
+
+            if (_data != null)
+            {
+                if (_position + count > Length)
+                    return false;
+
+                buffer = _data;
+                index = _dataOffset + (int)_position;
+                _position += count;
+                return true;
+            }
+
+            if (!_useBuffering || !EnsureBufferIsReadyForReading() || _bufferPosition + count > _bufferSize)
+                return false;
+
+            buffer = _buffer;
+            index = _bufferPosition;
+            Position += count;
+            return true;
+        }
+
         private byte[] ReadBytesWithoutBuffering(int count)
         {
             var result = new byte[count];
@@ -415,7 +583,7 @@ namespace Melanchall.DryWetMidi.Core
                 _bufferStart = _stream.Position;
 
                 var totalReadBytesCount = 0;
-                var count = _buffer.Length;
+                var count = (int)Math.Min(_buffer.Length, Length - _bufferStart);
 
                 do
                 {
@@ -460,6 +628,7 @@ namespace Melanchall.DryWetMidi.Core
                     break;
 
                 case BufferingPolicy.UseFixedSizeBuffer:
+                case BufferingPolicy.UseMemoryMappedFile:
                     {
                         _buffer = new byte[_settings.BufferSize];
                     }
@@ -476,6 +645,18 @@ namespace Melanchall.DryWetMidi.Core
             }
         }
 
+        private static MemoryMappedFile CreateMemoryMappedFile(FileStream fileStream)
+        {
+            // Mapping is created for the already opened file rather than by path so the file
+            // is not opened once more with sharing mode that can conflict with the stream's one
+
+#if NET45
+            return MemoryMappedFile.CreateFromFile(fileStream, null, 0, MemoryMappedFileAccess.Read, null, HandleInheritability.None, true);
+#else
+            return MemoryMappedFile.CreateFromFile(fileStream, null, 0, MemoryMappedFileAccess.Read, HandleInheritability.None, true);
+#endif
+        }
+
         #endregion
 
         #region IDisposable
@@ -495,6 +676,11 @@ namespace Melanchall.DryWetMidi.Core
 
             if (disposing)
             {
+                if (_memoryMappedFile != null)
+                {
+                    _stream.Dispose();
+                    _memoryMappedFile.Dispose();
+                }
             }
 
             _disposed = true;
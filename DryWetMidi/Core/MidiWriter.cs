@@ -22,6 +22,9 @@ namespace Melanchall.DryWetMidi.Core
         private int _bufferPosition;
         private long _length;
 
+        private MemoryStream _chunkContentStream;
+        private MidiWriter _chunkContentWriter;
+
         private bool _disposed;
 
         #endregion
@@ -246,7 +249,36 @@ namespace Melanchall.DryWetMidi.Core
             _buffer = new byte[_settings.BufferSize];
         }
 
-        private void WriteBytes(byte[] bytes, int offset, int length)
+        // Returns writer to write content of a chunk to the buffer reused between chunks;
+        // the chunk (header with actual content size and the content) is written by
+        // the EndChunkContent call
+        internal MidiWriter StartChunkContent()
+        {
+            if (_chunkContentWriter == null)
+            {
+                _chunkContentStream = new MemoryStream();
+                _chunkContentWriter = new MidiWriter(_chunkContentStream, _settings);
+            }
+            else
+            {
+                _chunkContentWriter._bufferPosition = 0;
+                _chunkContentStream.SetLength(0);
+            }
+
+            return _chunkContentWriter;
+        }
+
+        internal void EndChunkContent(string chunkId, WritingSettings settings)
+        {
+            if (_chunkContentWriter._useBuffering)
+                _chunkContentWriter.FlushBuffer();
+
+            var size = _chunkContentStream.Length;
+            MidiChunk.WriteHeader(chunkId, (uint)size, this, settings);
+            WriteBytes(_chunkContentStream.GetBuffer(), 0, (int)size);
+        }
+
+        internal void WriteBytes(byte[] bytes, int offset, int length)
         {
             if (_useBuffering)
                 WriteBytesWithBuffering(bytes, offset, length);
@@ -273,7 +305,15 @@ namespace Melanchall.DryWetMidi.Core
                 var firstBytesCount = _buffer.Length - _bufferPosition;
                 WriteBytesToBuffer(bytes, offset, firstBytesCount);
                 FlushBuffer();
-                WriteBytesWithBuffering(bytes, offset + firstBytesCount, length - firstBytesCount);
+
+                // Data that doesn't fit the buffer is written directly to the stream
+                // to not copy it to the buffer piece by piece
+
+                var lastBytesCount = length - firstBytesCount;
+                if (lastBytesCount >= _buffer.Length)
+                    _stream.Write(bytes, offset + firstBytesCount, lastBytesCount);
+                else
+                    WriteBytesToBuffer(bytes, offset + firstBytesCount, lastBytesCount);
             }
         }
 
@@ -24,6 +24,15 @@
         /// <summary>
         /// Put entire MIDI data to buffer in memory and read it from here.
         /// </summary>
-        BufferAllData
+        BufferAllData,
+
+        /// <summary>
+        /// Map file to memory and read data from the mapped view in portions of size specified by
+        /// <see cref="ReaderSettings.BufferSize"/>. Only file part being read right now is loaded to
+        /// memory by OS so huge files can be read with small memory footprint. The policy is
+        /// applied to <see cref="System.IO.FileStream"/> only; data of other streams will be read
+        /// as with <see cref="UseFixedSizeBuffer"/> policy.
+        /// </summary>
+        UseMemoryMappedFile
     }
 }
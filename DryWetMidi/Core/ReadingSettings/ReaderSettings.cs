@@ -103,7 +103,8 @@ namespace Melanchall.DryWetMidi.Core
 
         /// <summary>
         /// Gets or sets the size of a buffer that will be used by <see cref="MidiReader"/> in case of
-        /// <see cref="BufferingPolicy.UseFixedSizeBuffer"/> policy used for <see cref="BufferingPolicy"/>.
+        /// <see cref="BufferingPolicy.UseFixedSizeBuffer"/> or <see cref="BufferingPolicy.UseMemoryMappedFile"/>
+        /// policy used for <see cref="BufferingPolicy"/>.
         /// </summary>
         /// <exception cref="ArgumentOutOfRangeException"><paramref name="value"/> is zero or negative.</exception>
         public int BufferSize
@@ -1,4 +1,5 @@
-﻿using System.ComponentModel;
+﻿using System;
+using System.ComponentModel;
 using System.Text;
 using Melanchall.DryWetMidi.Common;
 
@@ -26,6 +27,7 @@ namespace Melanchall.DryWetMidi.Core
         private NoHeaderChunkPolicy _noHeaderChunkPolicy = NoHeaderChunkPolicy.Abort;
         private ZeroLengthDataPolicy _zeroLengthDataPolicy = ZeroLengthDataPolicy.ReadAsEmptyObject;
         private EndOfTrackStoringPolicy _endOfTrackStoringPolicy = EndOfTrackStoringPolicy.Omit;
+        private int _maxDegreeOfParallelism = 1;
 
         #endregion
 
@@ -387,6 +389,46 @@ namespace Melanchall.DryWetMidi.Core
             }
         }
 
+        /// <summary>
+        /// Gets or sets the maximum number of track chunks which events can be read concurrently.
+        /// The default value is 1 which means all chunks will be read sequentially on the calling thread.
+        /// </summary>
+        /// <remarks>
+        /// <para>If the value is greater than 1, the reading engine first finds boundaries of all chunks
+        /// using their headers and then reads events of track chunks in parallel. The result is the same
+        /// as for sequential reading, including reaction on errors according to other settings: if reading
+        /// of any chunk fails or goes beyond the chunk's declared size, the data is read again sequentially.
+        /// Data of a non-seekable stream is always read sequentially.</para>
+        /// <para>Please note that callbacks like <see cref="DecodeTextCallback"/> can be called from
+        /// different threads concurrently in case of parallel reading, and for corrupted data they can
+        /// be called more than once for the same bytes.</para>
+        /// </remarks>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="value"/> is zero or negative.</exception>
+        public int MaxDegreeOfParallelism
+        {
+            get { return _maxDegreeOfParallelism; }
+            set
+            {
+                ThrowIfArgument.IsNonpositive(nameof(value), value, "Value is zero or negative.");
+
+                _maxDegreeOfParallelism = value;
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets a value indicating whether events of track chunks should be read into
+        /// <see cref="CompactTrack"/> rather than separate <see cref="MidiEvent"/> objects.
+        /// The default value is <c>false</c>.
+        /// </summary>
+        /// <remarks>
+        /// <para>If the value is <c>true</c>, channel events are read without creating an object for
+        /// each of them, which greatly reduces memory consumption for large files. Events of a track chunk
+        /// are converted to objects on first access to <see cref="TrackChunk.Events"/>, so the setting is
+        /// useful when a file is read to be written or inspected with <see cref="TrackChunk.ToCompactTrack"/>.
+        /// Other settings are applied in the same way as for regular reading.</para>
+        /// </remarks>
+        public bool UseCompactEventsStorage { get; set; }
+
         /// <summary>
         /// Gets or sets settings according to which <see cref="MidiReader"/> should read MIDI data.
         /// </summary>
@@ -0,0 +1,23 @@
+﻿namespace Melanchall.DryWetMidi.Core
+{
+    internal sealed class TrackChunkLocation
+    {
+        #region Constructor
+
+        public TrackChunkLocation(long contentPosition, uint size)
+        {
+            ContentPosition = contentPosition;
+            Size = size;
+        }
+
+        #endregion
+
+        #region Properties
+
+        public long ContentPosition { get; }
+
+        public uint Size { get; }
+
+        #endregion
+    }
+}
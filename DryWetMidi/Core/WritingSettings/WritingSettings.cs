@@ -1,4 +1,6 @@
-﻿using System.Text;
+﻿using System;
+using System.Text;
+using Melanchall.DryWetMidi.Common;
 
 namespace Melanchall.DryWetMidi.Core
 {
@@ -7,6 +9,12 @@ namespace Melanchall.DryWetMidi.Core
     /// </summary>
     public class WritingSettings
     {
+        #region Fields
+
+        private int _maxDegreeOfParallelism = 1;
+
+        #endregion
+
         #region Properties
 
         /// <summary>
@@ -78,6 +86,27 @@ namespace Melanchall.DryWetMidi.Core
         /// </summary>
         public Encoding TextEncoding { get; set; } = SmfConstants.DefaultTextEncoding;
 
+        /// <summary>
+        /// Gets or sets the maximum number of chunks which can be serialized concurrently.
+        /// The default value is 1 which means all chunks will be written sequentially on the calling thread.
+        /// </summary>
+        /// <remarks>
+        /// <para>If the value is greater than 1, chunks are serialized to separate in-memory buffers in parallel
+        /// and then the buffers are written to the output in the order of chunks. The output is the same
+        /// as for sequential writing.</para>
+        /// </remarks>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="value"/> is zero or negative.</exception>
+        public int MaxDegreeOfParallelism
+        {
+            get { return _maxDegreeOfParallelism; }
+            set
+            {
+                ThrowIfArgument.IsNonpositive(nameof(value), value, "Value is zero or negative.");
+
+                _maxDegreeOfParallelism = value;
+            }
+        }
+
         /// <summary>
         /// Gets or sets settings according to which <see cref="MidiWriter"/> should write MIDI data.
         /// </summary>
@@ -176,6 +176,79 @@ namespace Melanchall.DryWetMidi.Interaction
                 settings);
         }
 
+        /// <summary>
+        /// Reads objects of the specified types from a MIDI file returning them as a lazy collection
+        /// without reading the whole file into memory.
+        /// </summary>
+        /// <param name="filePath">Path to the file to read objects from.</param>
+        /// <param name="objectType">Combination of desired objects types.</param>
+        /// <param name="settings">Settings according to which objects should be detected and built.</param>
+        /// <param name="readingSettings">Settings according to which the file must be read. Specify <c>null</c> to use
+        /// default settings.</param>
+        /// <returns>A lazy collection of objects of the specified types read from the file specified by
+        /// <paramref name="filePath"/>. Objects are ordered by time.</returns>
+        /// <remarks>
+        /// <para>
+        /// For a valid file the method returns the same objects as
+        /// <c>MidiFile.Read(filePath, readingSettings).GetObjects(objectType, settings)</c> but events are read
+        /// while the collection is being iterated. Chunks are processed according to <paramref name="readingSettings"/>
+        /// the same way as on reading of the whole file, but only headers of chunks are read to find track chunks.
+        /// Then events of track chunks are read simultaneously and objects of track chunks are merged by time,
+        /// so only objects being built (for example, notes without Note Off event read yet) are kept in memory.
+        /// </para>
+        /// <para>
+        /// Track chunks are located by the sizes declared in their headers. If events of a track chunk go beyond
+        /// the declared size and <see cref="ReadingSettings.InvalidChunkSizePolicy"/> is
+        /// <see cref="InvalidChunkSizePolicy.Ignore"/>, the result can differ from the one of reading the whole file.
+        /// </para>
+        /// <para>
+        /// The file is opened once. Each track chunk is read through its own buffer of
+        /// <see cref="ReaderSettings.BufferSize"/> bytes regardless of <see cref="ReaderSettings.BufferingPolicy"/>,
+        /// so <see cref="BufferingPolicy.UseCustomBuffer"/> can't be used. See
+        /// <see href="xref:a_file_lazy_reading_writing">Lazy reading/writing</see> article to learn more.
+        /// </para>
+        /// </remarks>
+        /// <exception cref="ArgumentNullException"><paramref name="filePath"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException"><see cref="ReaderSettings.BufferingPolicy"/> of
+        /// <paramref name="readingSettings"/> is <see cref="BufferingPolicy.UseCustomBuffer"/>.</exception>
+        public static IEnumerable<ITimedObject> ReadObjectsLazy(
+            string filePath,
+            ObjectType objectType,
+            ObjectDetectionSettings settings = null,
+            ReadingSettings readingSettings = null)
+        {
+            ThrowIfArgument.IsNull(nameof(filePath), filePath);
+
+            if (readingSettings?.ReaderSettings?.BufferingPolicy == BufferingPolicy.UseCustomBuffer)
+                throw new ArgumentException("Custom buffer can't be used since track chunks are read simultaneously.", nameof(readingSettings));
+
+            return ReadObjectsLazyInternal(filePath, objectType, settings, readingSettings);
+        }
+
+        private static IEnumerable<ITimedObject> ReadObjectsLazyInternal(
+            string filePath,
+            ObjectType objectType,
+            ObjectDetectionSettings settings,
+            ReadingSettings readingSettings)
+        {
+            readingSettings = MidiFile.PrepareReadingSettings(readingSettings);
+
+            using (var fileStream = FileUtilities.OpenFileForRead(filePath))
+            {
+                var objectsCollections = MidiFileReadingUtilities
+                    .GetTrackChunksEventsLazy(fileStream, readingSettings)
+                    .Select((events, i) => events
+                        .GetTimedEventsLazy(settings?.TimedEventDetectionSettings, i, false)
+                        .EnumerateSortedObjectsFromSortedTimedObjects(objectType, settings))
+                    .ToArray();
+
+                foreach (var timedObject in objectsCollections.MergeSortedObjectsCollections())
+                {
+                    yield return timedObject;
+                }
+            }
+        }
+
         private static bool TryProcessTimedEvent(TimedEvent timedEvent, List<ITimedObject> processedTimedObjects)
         {
             if (timedEvent == null)
@@ -240,11 +313,41 @@ namespace Melanchall.DryWetMidi.Interaction
                 : (ICollection<ITimedObject>)result);
         }
 
+        // Does the same as GetObjectsFromSortedTimedObjects but lazily. Timed events of a deconstructed
+        // note are returned by EnumerateObjectsFromSortedTimedObjects one after another, so Note Off
+        // events are delayed here until all objects preceding them are returned
+        private static IEnumerable<ITimedObject> EnumerateSortedObjectsFromSortedTimedObjects(
+            this IEnumerable<ITimedObject> processedTimedObjects,
+            ObjectType objectType,
+            ObjectDetectionSettings settings)
+        {
+            var delayedNoteOffEvents = new List<TimedEvent>();
+
+            foreach (var timedObject in processedTimedObjects.EnumerateObjectsFromSortedTimedObjects(objectType, settings, null, delayedNoteOffEvents))
+            {
+                var readyNoteOffEventsCount = 0;
+
+                while (readyNoteOffEventsCount < delayedNoteOffEvents.Count && delayedNoteOffEvents[readyNoteOffEventsCount].Time <= timedObject.Time)
+                {
+                    yield return delayedNoteOffEvents[readyNoteOffEventsCount++];
+                }
+
+                delayedNoteOffEvents.RemoveRange(0, readyNoteOffEventsCount);
+                yield return timedObject;
+            }
+
+            foreach (var noteOffEvent in delayedNoteOffEvents)
+            {
+                yield return noteOffEvent;
+            }
+        }
+
         private static IEnumerable<ITimedObject> EnumerateObjectsFromSortedTimedObjects(
             this IEnumerable<ITimedObject> processedTimedObjects,
             ObjectType objectType,
             ObjectDetectionSettings settings,
-            ObjectWrapper<bool> notesDeconstructed = null)
+            ObjectWrapper<bool> notesDeconstructed = null,
+            List<TimedEvent> delayedNoteOffEvents = null)
         {
             var getChords = objectType.HasFlag(ObjectType.Chord);
             var getNotes = objectType.HasFlag(ObjectType.Note);
@@ -299,13 +402,29 @@ namespace Melanchall.DryWetMidi.Interaction
                                 notesDeconstructed.Object = true;
 
                             yield return note.GetTimedNoteOnEvent();
-                            yield return note.GetTimedNoteOffEvent();
+
+                            var noteOffEvent = note.GetTimedNoteOffEvent();
+                            if (delayedNoteOffEvents == null)
+                                yield return noteOffEvent;
+                            else
+                                InsertDelayedNoteOffEvent(delayedNoteOffEvents, noteOffEvent);
                         }
                     }
                 }
             }
         }
 
+        private static void InsertDelayedNoteOffEvent(List<TimedEvent> delayedNoteOffEvents, TimedEvent noteOffEvent)
+        {
+            var index = delayedNoteOffEvents.Count;
+            while (index > 0 && delayedNoteOffEvents[index - 1].Time > noteOffEvent.Time)
+            {
+                index--;
+            }
+
+            delayedNoteOffEvents.Insert(index, noteOffEvent);
+        }
+
         #endregion
     }
 }
@@ -13,149 +13,217 @@ namespace Melanchall.DryWetMidi.Interaction
     {
         #region Nested classes
 
-        private abstract class NoteOnsHolderBase<TDescriptor> where TDescriptor : IObjectDescriptor
+        private sealed class NotesBuilder
         {
-            private const int DefaultCapacity = 2;
+            #region Nested types
 
-            private readonly NoteStartDetectionPolicy _noteStartDetectionPolicy;
+            private struct ObjectEntry
+            {
+                public ITimedObject Object;
+                public TimedEvent NoteOffTimedEvent;
+                public bool IsNoteOn;
+                public long NextNoteOnPosition;
+            }
+
+            #endregion
+
+            #region Constants
+
+            // Open Note On events are tracked per channel and note number
+            private const int NotesIdsCount = 16 * 128;
+
+            private const int DefaultCapacity = 64;
+            private const int MaxCachedCapacity = 4096;
+
+            private const long NoPosition = -1;
+
+            #endregion
 
-            private readonly Stack<LinkedListNode<TDescriptor>> _nodesStack;
-            private readonly Queue<LinkedListNode<TDescriptor>> _nodesQueue;
+            #region Fields
 
-            protected NoteOnsHolderBase(NoteStartDetectionPolicy noteStartDetectionPolicy)
+            [ThreadStatic]
+            private static NotesBuilder _cachedNotesBuilder;
+
+            // For each note ID these arrays hold positions of the first and the last open
+            // Note On events; the rest are chained via ObjectEntry.NextNoteOnPosition. For
+            // the FirstNoteOn policy the chain is a queue, for the LastNoteOn one it's a
+            // stack and only the first position is used
+            private readonly long[] _firstNoteOnsPositions = new long[NotesIdsCount];
+            private readonly long[] _lastNoteOnsPositions = new long[NotesIdsCount];
+
+            // Objects waiting for their turn to be returned stored in a ring buffer
+            // addressed by ever-increasing positions
+            private ObjectEntry[] _entries = new ObjectEntry[DefaultCapacity];
+            private long _firstPosition;
+            private long _nextPosition;
+
+            private NoteStartDetectionPolicy _noteStartDetectionPolicy;
+
+            #endregion
+
+            #region Constructor
+
+            private NotesBuilder()
             {
-                switch (noteStartDetectionPolicy)
-                {
-                    case NoteStartDetectionPolicy.LastNoteOn:
-                        _nodesStack = new Stack<LinkedListNode<TDescriptor>>(DefaultCapacity);
-                        break;
-                    case NoteStartDetectionPolicy.FirstNoteOn:
-                        _nodesQueue = new Queue<LinkedListNode<TDescriptor>>(DefaultCapacity);
-                        break;
-                }
+                Reset();
+            }
+
+            #endregion
 
-                _noteStartDetectionPolicy = noteStartDetectionPolicy;
+            #region Properties
+
+            public bool HasPendingObjects => _nextPosition > _firstPosition;
+
+            #endregion
+
+            #region Methods
+
+            public static NotesBuilder Acquire(NoteStartDetectionPolicy noteStartDetectionPolicy)
+            {
+                var notesBuilder = _cachedNotesBuilder ?? new NotesBuilder();
+                _cachedNotesBuilder = null;
+
+                notesBuilder._noteStartDetectionPolicy = noteStartDetectionPolicy;
+                return notesBuilder;
             }
 
-            public int Count
+            public static void Release(NotesBuilder notesBuilder)
             {
-                get
-                {
-                    switch (_noteStartDetectionPolicy)
-                    {
-                        case NoteStartDetectionPolicy.LastNoteOn:
-                            return _nodesStack.Count;
-                        case NoteStartDetectionPolicy.FirstNoteOn:
-                            return _nodesQueue.Count;
-                    }
+                notesBuilder.Reset();
+                _cachedNotesBuilder = notesBuilder;
+            }
 
-                    return -1;
-                }
+            public void AddObject(ITimedObject timedObject)
+            {
+                AddEntry(timedObject, false);
             }
 
-            public void Add(LinkedListNode<TDescriptor> noteOnNode)
+            public void AddNoteOn(TimedEvent noteOnTimedEvent, int noteId)
             {
+                var position = AddEntry(noteOnTimedEvent, true);
+
                 switch (_noteStartDetectionPolicy)
                 {
                     case NoteStartDetectionPolicy.LastNoteOn:
-                        _nodesStack.Push(noteOnNode);
+                        {
+                            _entries[GetIndex(position)].NextNoteOnPosition = _firstNoteOnsPositions[noteId];
+                            _firstNoteOnsPositions[noteId] = position;
+                        }
                         break;
                     case NoteStartDetectionPolicy.FirstNoteOn:
-                        _nodesQueue.Enqueue(noteOnNode);
+                        {
+                            var lastPosition = _lastNoteOnsPositions[noteId];
+                            if (lastPosition == NoPosition)
+                                _firstNoteOnsPositions[noteId] = position;
+                            else
+                                _entries[GetIndex(lastPosition)].NextNoteOnPosition = position;
+
+                            _lastNoteOnsPositions[noteId] = position;
+                        }
                         break;
                 }
             }
 
-            public LinkedListNode<TDescriptor> GetNext()
+            public bool TryAddNoteOff(TimedEvent noteOffTimedEvent, int noteId)
             {
-                switch (_noteStartDetectionPolicy)
-                {
-                    case NoteStartDetectionPolicy.LastNoteOn:
-                        return _nodesStack.Pop();
-                    case NoteStartDetectionPolicy.FirstNoteOn:
-                        return _nodesQueue.Dequeue();
-                }
+                var position = _firstNoteOnsPositions[noteId];
+                if (position == NoPosition)
+                    return false;
 
-                return null;
-            }
-        }
+                var index = GetIndex(position);
 
-        private sealed class NoteOnsHolder : NoteOnsHolderBase<IObjectDescriptor>
-        {
-            public NoteOnsHolder(NoteStartDetectionPolicy noteStartDetectionPolicy)
-                : base(noteStartDetectionPolicy)
-            {
+                var nextPosition = _entries[index].NextNoteOnPosition;
+                _firstNoteOnsPositions[noteId] = nextPosition;
+                if (nextPosition == NoPosition)
+                    _lastNoteOnsPositions[noteId] = NoPosition;
+
+                _entries[index].NoteOffTimedEvent = noteOffTimedEvent;
+                return true;
             }
-        }
 
-        private interface IObjectDescriptor
-        {
-            bool IsCompleted { get; }
+            public bool TryGetObject(Func<NoteData, Note> constructor, bool completedOnly, out ITimedObject timedObject)
+            {
+                timedObject = null;
 
-            ITimedObject GetObject(Func<NoteData, Note> constructor);
-        }
+                if (!HasPendingObjects)
+                    return false;
 
-        private class NoteDescriptor : IObjectDescriptor
-        {
-            private readonly TimedEvent _noteOnTimedEvent;
+                var index = GetIndex(_firstPosition);
+                var entry = _entries[index];
 
-            public NoteDescriptor(TimedEvent noteOnTimedEvent)
-            {
-                _noteOnTimedEvent = noteOnTimedEvent;
-            }
+                var noteOffTimedEvent = entry.NoteOffTimedEvent;
+                if (completedOnly && entry.IsNoteOn && noteOffTimedEvent == null)
+                    return false;
 
-            public TimedEvent NoteOffTimedEvent { get; set; }
+                _entries[index] = default(ObjectEntry);
+                _firstPosition++;
 
-            public bool IsCompleted => NoteOffTimedEvent != null;
-
-            public ITimedObject GetObject(Func<NoteData, Note> constructor)
-            {
-                if (!IsCompleted)
-                    return _noteOnTimedEvent;
+                if (noteOffTimedEvent == null)
+                {
+                    timedObject = entry.Object;
+                    return true;
+                }
 
+                var noteOnTimedEvent = (TimedEvent)entry.Object;
                 var note = constructor != null
-                    ? constructor(new NoteData(_noteOnTimedEvent, NoteOffTimedEvent))
+                    ? constructor(new NoteData(noteOnTimedEvent, noteOffTimedEvent))
                     : null;
 
-                if (note == null)
-                    note = new Note(_noteOnTimedEvent, NoteOffTimedEvent, false);
-
-                return note;
+                timedObject = note ?? new Note(noteOnTimedEvent, noteOffTimedEvent, false);
+                return true;
             }
-        }
-
-        private class CompleteObjectDescriptor : IObjectDescriptor
-        {
-            private readonly ITimedObject _timedObject;
 
-            public CompleteObjectDescriptor(ITimedObject timedObject)
+            private long AddEntry(ITimedObject timedObject, bool isNoteOn)
             {
-                _timedObject = timedObject;
-            }
+                if (_nextPosition - _firstPosition == _entries.Length)
+                    Grow();
 
-            public bool IsCompleted { get; } = true;
+                var position = _nextPosition++;
+                _entries[GetIndex(position)] = new ObjectEntry
+                {
+                    Object = timedObject,
+                    IsNoteOn = isNoteOn,
+                    NextNoteOnPosition = NoPosition
+                };
 
-            public ITimedObject GetObject(Func<NoteData, Note> constructor)
-            {
-                return _timedObject;
+                return position;
             }
-        }
 
-        private class TimedEventDescriptor : IObjectDescriptor
-        {
-            private readonly TimedEvent _timedEvent;
-
-            public TimedEventDescriptor(TimedEvent timedEvent)
+            private int GetIndex(long position)
             {
-                _timedEvent = timedEvent;
+                return (int)(position & (_entries.Length - 1));
             }
 
-            public bool IsCompleted { get; } = true;
+            private void Grow()
+            {
+                var entries = new ObjectEntry[_entries.Length * 2];
 
-            public ITimedObject GetObject(Func<NoteData, Note> constructor)
+                for (var position = _firstPosition; position < _nextPosition; position++)
+                {
+                    entries[position & (entries.Length - 1)] = _entries[GetIndex(position)];
+                }
+
+                _entries = entries;
+            }
+
+            private void Reset()
             {
-                return _timedEvent;
+                for (var i = 0; i < NotesIdsCount; i++)
+                {
+                    _firstNoteOnsPositions[i] = NoPosition;
+                    _lastNoteOnsPositions[i] = NoPosition;
+                }
+
+                if (_entries.Length > MaxCachedCapacity)
+                    _entries = new ObjectEntry[DefaultCapacity];
+                else if (HasPendingObjects)
+                    Array.Clear(_entries, 0, _entries.Length);
+
+                _firstPosition = 0;
+                _nextPosition = 0;
             }
+
+            #endregion
         }
 
         #endregion
@@ -1030,7 +1098,7 @@ namespace Melanchall.DryWetMidi.Interaction
 
         private static int GetNoteEventId(NoteEvent noteEvent)
         {
-            return noteEvent.Channel * 1000 + noteEvent.NoteNumber;
+            return (noteEvent.Channel << 7) | noteEvent.NoteNumber;
         }
 
         private static IEnumerable<ITimedObject> GetSortedNotesAndTimedEventsLazy(
@@ -1041,83 +1109,67 @@ namespace Melanchall.DryWetMidi.Interaction
             settings = settings ?? new NoteDetectionSettings();
             var constructor = settings?.Constructor;
 
-            var objectsDescriptors = new LinkedList<IObjectDescriptor>();
-            var notesDescriptorsNodes = new Dictionary<int, NoteOnsHolder>();
+            var notesBuilder = NotesBuilder.Acquire(settings.NoteStartDetectionPolicy);
+            ITimedObject readyObject;
 
-            foreach (var timedObject in timedObjects)
+            try
             {
-                if (completeObjectsAllowed && !(timedObject is TimedEvent))
+                foreach (var timedObject in timedObjects)
                 {
-                    if (objectsDescriptors.Count == 0)
-                        yield return timedObject;
-                    else
-                        objectsDescriptors.AddLast(new CompleteObjectDescriptor(timedObject));
-
-                    continue;
-                }
-
-                var timedEvent = (TimedEvent)timedObject;
-
-                switch (timedEvent.Event.EventType)
-                {
-                    case MidiEventType.NoteOn:
-                        {
-                            var noteId = GetNoteEventId((NoteOnEvent)timedEvent.Event);
-                            var node = objectsDescriptors.AddLast(new NoteDescriptor(timedEvent));
-
-                            NoteOnsHolder noteOnsHolder;
-                            if (!notesDescriptorsNodes.TryGetValue(noteId, out noteOnsHolder))
-                                notesDescriptorsNodes.Add(noteId, noteOnsHolder = new NoteOnsHolder(settings.NoteStartDetectionPolicy));
+                    if (completeObjectsAllowed && !(timedObject is TimedEvent))
+                    {
+                        if (!notesBuilder.HasPendingObjects)
+                            yield return timedObject;
+                        else
+                            notesBuilder.AddObject(timedObject);
 
-                            noteOnsHolder.Add(node);
-                        }
-                        break;
-                    case MidiEventType.NoteOff:
-                        {
-                            var noteId = GetNoteEventId((NoteOffEvent)timedEvent.Event);
+                        continue;
+                    }
 
-                            NoteOnsHolder noteOnsHolder;
-                            LinkedListNode<IObjectDescriptor> node;
+                    var timedEvent = (TimedEvent)timedObject;
 
-                            if (!notesDescriptorsNodes.TryGetValue(noteId, out noteOnsHolder) || noteOnsHolder.Count == 0 || (node = noteOnsHolder.GetNext()).List == null)
+                    switch (timedEvent.Event.EventType)
+                    {
+                        case MidiEventType.NoteOn:
+                            notesBuilder.AddNoteOn(timedEvent, GetNoteEventId((NoteOnEvent)timedEvent.Event));
+                            break;
+                        case MidiEventType.NoteOff:
                             {
-                                objectsDescriptors.AddLast(new TimedEventDescriptor(timedEvent));
-                                break;
-                            }
+                                if (!notesBuilder.TryAddNoteOff(timedEvent, GetNoteEventId((NoteOffEvent)timedEvent.Event)))
+                                {
+                                    if (!notesBuilder.HasPendingObjects)
+                                        yield return timedEvent;
+                                    else
+                                        notesBuilder.AddObject(timedEvent);
 
-                            ((NoteDescriptor)node.Value).NoteOffTimedEvent = timedEvent;
-
-                            var previousNode = node.Previous;
-                            if (previousNode != null)
-                                break;
-
-                            for (var n = node; n != null;)
-                            {
-                                if (!n.Value.IsCompleted)
                                     break;
+                                }
 
-                                yield return n.Value.GetObject(constructor);
-
-                                var next = n.Next;
-                                objectsDescriptors.Remove(n);
-                                n = next;
+                                while (notesBuilder.TryGetObject(constructor, true, out readyObject))
+                                {
+                                    yield return readyObject;
+                                }
                             }
-                        }
-                        break;
-                    default:
-                        {
-                            if (objectsDescriptors.Count == 0)
-                                yield return timedEvent;
-                            else
-                                objectsDescriptors.AddLast(new TimedEventDescriptor(timedEvent));
-                        }
-                        break;
+                            break;
+                        default:
+                            {
+                                if (!notesBuilder.HasPendingObjects)
+                                    yield return timedEvent;
+                                else
+                                    notesBuilder.AddObject(timedEvent);
+                            }
+                            break;
+                    }
                 }
-            }
 
-            foreach (var objectDescriptor in objectsDescriptors)
+                while (notesBuilder.TryGetObject(constructor, false, out readyObject))
+                {
+                    yield return readyObject;
+                }
+            }
+            finally
             {
-                yield return objectDescriptor.GetObject(constructor);
+                NotesBuilder.Release(notesBuilder);
             }
         }
 
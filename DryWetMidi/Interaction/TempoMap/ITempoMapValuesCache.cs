@@ -12,7 +12,9 @@ namespace Melanchall.DryWetMidi.Interaction
 
         #region Methods
 
-        void Invalidate(TempoMap tempoMap);
+        // Marks values depending on the changes of a tempo map line at the specified time and
+        // later as outdated
+        void Invalidate(TempoMap tempoMap, long time);
 
         #endregion
     }
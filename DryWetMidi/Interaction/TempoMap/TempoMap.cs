@@ -26,6 +26,7 @@ namespace Melanchall.DryWetMidi.Interaction
         private ValueLine<Tempo> _tempoLine;
 
         private MetricTempoMapValuesCache _metricValuesCache;
+        private BarBeatTempoMapValuesCache _barBeatValuesCache;
 
         private bool _isTempoMapReady = true;
 
@@ -68,6 +69,8 @@ namespace Melanchall.DryWetMidi.Interaction
 
                 _timeSignatureLine = value;
                 _timeSignatureLine.ValuesChanged += OnTimeSignatureChanged;
+
+                InvalidateCaches(TempoMapLine.TimeSignature, 0);
             }
         }
 
@@ -81,6 +84,8 @@ namespace Melanchall.DryWetMidi.Interaction
 
                 _tempoLine = value;
                 _tempoLine.ValuesChanged += OnTempoChanged;
+
+                InvalidateCaches(TempoMapLine.Tempo, 0);
             }
         }
 
@@ -96,8 +101,8 @@ namespace Melanchall.DryWetMidi.Interaction
                 
                 if (_isTempoMapReady)
                 {
-                    InvalidateCaches(TempoMapLine.Tempo);
-                    InvalidateCaches(TempoMapLine.TimeSignature);
+                    InvalidateCaches(TempoMapLine.Tempo, 0);
+                    InvalidateCaches(TempoMapLine.TimeSignature, 0);
                 }
             }
         }
@@ -349,14 +354,21 @@ namespace Melanchall.DryWetMidi.Interaction
         internal MetricTempoMapValuesCache GetMetricValuesCache()
         {
             if (_metricValuesCache == null)
-            {
                 _metricValuesCache = new MetricTempoMapValuesCache();
-                _metricValuesCache.Invalidate(this);
-            }
 
+            _metricValuesCache.Update(this);
             return _metricValuesCache;
         }
 
+        internal BarBeatTempoMapValuesCache GetBarBeatValuesCache()
+        {
+            if (_barBeatValuesCache == null)
+                _barBeatValuesCache = new BarBeatTempoMapValuesCache();
+
+            _barBeatValuesCache.Update(this);
+            return _barBeatValuesCache;
+        }
+
         private static void SetGlobalTempo(TempoMap tempoMap, Tempo tempo)
         {
             tempoMap.TempoLine.SetValue(0, tempo);
@@ -367,22 +379,29 @@ namespace Melanchall.DryWetMidi.Interaction
             tempoMap.TimeSignatureLine.SetValue(0, timeSignature);
         }
 
-        private void InvalidateCaches(TempoMapLine tempoMapLine)
+        private void InvalidateCaches(TempoMapLine tempoMapLine, long time)
         {
             if (!IsTempoMapReady)
                 return;
 
-            _metricValuesCache?.Invalidate(this);
+            InvalidateCache(_metricValuesCache, tempoMapLine, time);
+            InvalidateCache(_barBeatValuesCache, tempoMapLine, time);
+        }
+
+        private void InvalidateCache(ITempoMapValuesCache valuesCache, TempoMapLine tempoMapLine, long time)
+        {
+            if (valuesCache != null && valuesCache.InvalidateOnLines.Contains(tempoMapLine))
+                valuesCache.Invalidate(this, time);
         }
 
-        private void OnTimeSignatureChanged(object sender, EventArgs args)
+        private void OnTimeSignatureChanged(object sender, ValueLineChangedEventArgs args)
         {
-            InvalidateCaches(TempoMapLine.TimeSignature);
+            InvalidateCaches(TempoMapLine.TimeSignature, args.Time);
         }
 
-        private void OnTempoChanged(object sender, EventArgs args)
+        private void OnTempoChanged(object sender, ValueLineChangedEventArgs args)
         {
-            InvalidateCaches(TempoMapLine.Tempo);
+            InvalidateCaches(TempoMapLine.Tempo, args.Time);
         }
 
         #endregion
@@ -1,5 +1,4 @@
 ﻿using System;
-using System.Linq;
 using Melanchall.DryWetMidi.Common;
 using Melanchall.DryWetMidi.Core;
 
@@ -30,27 +29,23 @@ namespace Melanchall.DryWetMidi.Interaction
             //
 
             var timeSignatureLine = tempoMap.TimeSignatureLine;
-            var timeSignatureChanges = timeSignatureLine
-                .Where(v => v.Time > time && v.Time < endTime)
-                .ToList();
+            var valuesCache = tempoMap.GetBarBeatValuesCache();
+
+            var firstIndex = valuesCache.GetLastIndexAtOrBelow(time) + 1;
+            var lastIndex = valuesCache.GetLastIndexBelow(endTime);
+            var hasTimeSignatureChanges = firstIndex <= lastIndex;
 
             var bars = 0L;
 
             // Calculate count of complete bars between time signature changes
 
-            for (int i = 0; i < timeSignatureChanges.Count - 1; i++)
-            {
-                var timeSignatureChange = timeSignatureChanges[i];
-                var nextTime = timeSignatureChanges[i + 1].Time;
-
-                var barLength = BarBeatUtilities.GetBarLength(timeSignatureChange.Value, ticksPerQuarterNote);
-                bars += (nextTime - timeSignatureChange.Time) / barLength;
-            }
+            if (hasTimeSignatureChanges)
+                bars += valuesCache.GetBarsBetween(firstIndex, lastIndex);
 
             // Calculate components before first time signature change and after last time signature change
 
-            var firstTime = timeSignatureChanges.FirstOrDefault()?.Time ?? time;
-            var lastTime = timeSignatureChanges.LastOrDefault()?.Time ?? time;
+            var firstTime = hasTimeSignatureChanges ? valuesCache.GetTime(firstIndex) : time;
+            var lastTime = hasTimeSignatureChanges ? valuesCache.GetTime(lastIndex) : time;
 
             var firstTimeSignature = timeSignatureLine.GetValueAtTime(time);
             var lastTimeSignature = timeSignatureLine.GetValueAtTime(lastTime);
@@ -127,14 +122,16 @@ namespace Melanchall.DryWetMidi.Interaction
             var startBeatLength = BarBeatUtilities.GetBeatLength(startTimeSignature, ticksPerQuarterNote);
 
             var totalTicks = bars * startBarLength + beats * startBeatLength + ConvertFractionToTicks(fraction, startBeatLength);
-            var timeSignatureChanges = timeSignatureLine.Where(v => v.Time > time && v.Time < time + totalTicks).ToList();
+
+            var valuesCache = tempoMap.GetBarBeatValuesCache();
+            var firstIndex = valuesCache.GetLastIndexAtOrBelow(time) + 1;
+            var hasTimeSignatureChanges = firstIndex < valuesCache.Count && valuesCache.GetTime(firstIndex) < time + totalTicks;
 
             var lastBarLength = 0L;
             var lastBeatLength = 0L;
 
-            var firstTimeSignatureChange = timeSignatureChanges.FirstOrDefault();
-            var lastTimeSignature = firstTimeSignatureChange?.Value ?? startTimeSignature;
-            var lastTime = firstTimeSignatureChange?.Time ?? time;
+            var lastTimeSignature = hasTimeSignatureChanges ? valuesCache.GetTimeSignature(firstIndex) : startTimeSignature;
+            var lastTime = hasTimeSignatureChanges ? valuesCache.GetTime(firstIndex) : time;
 
             long barsBefore, beatsBefore;
             double fractionBefore;
@@ -152,9 +149,9 @@ namespace Melanchall.DryWetMidi.Interaction
 
             if (bars > 0)
             {
-                foreach (var timeSignatureChange in timeSignatureLine.Where(v => v.Time > lastTime).ToList())
+                for (var i = valuesCache.GetLastIndexAtOrBelow(lastTime) + 1; i < valuesCache.Count; i++)
                 {
-                    var deltaTime = timeSignatureChange.Time - lastTime;
+                    var deltaTime = valuesCache.GetTime(i) - lastTime;
 
                     lastBarLength = BarBeatUtilities.GetBarLength(lastTimeSignature, ticksPerQuarterNote);
                     lastBeatLength = BarBeatUtilities.GetBeatLength(lastTimeSignature, ticksPerQuarterNote);
@@ -166,7 +163,7 @@ namespace Melanchall.DryWetMidi.Interaction
                     if (bars == 0)
                         break;
 
-                    lastTimeSignature = timeSignatureChange.Value;
+                    lastTimeSignature = valuesCache.GetTimeSignature(i);
                 }
 
                 if (bars > 0)
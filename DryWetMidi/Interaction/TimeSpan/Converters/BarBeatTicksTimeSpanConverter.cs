@@ -1,5 +1,4 @@
 ﻿using System;
-using System.Linq;
 using Melanchall.DryWetMidi.Core;
 
 namespace Melanchall.DryWetMidi.Interaction
@@ -22,87 +21,20 @@ namespace Melanchall.DryWetMidi.Interaction
 
             //
 
-            var timeSignatureLine = tempoMap.TimeSignatureLine;
-
-            var bars = 0L;
-            var beats = 0L;
-            var ticks = 0L;
-
-            var timeSignatureChanges = timeSignatureLine.GetValueChanges(time, endTime);
-            if (timeSignatureChanges.Count == 0)
-            {
-                var timeSignatureAtTime = timeSignatureLine.GetValueAtTime(time);
-                CalculateComponents(
-                    endTime - time,
-                    timeSignatureAtTime,
-                    ticksPerQuarterNote,
-                    out bars,
-                    out beats,
-                    out ticks);
-
-                return new BarBeatTicksTimeSpan(bars, beats, ticks);
-            }
-
-            // Calculate count of complete bars between time signature changes
-
-            for (int i = 0; i < timeSignatureChanges.Count - 1; i++)
-            {
-                var timeSignatureChange = timeSignatureChanges[i];
-                var nextTime = timeSignatureChanges[i + 1].Time;
-
-                var barLength = BarBeatUtilities.GetBarLength(timeSignatureChange.Value, ticksPerQuarterNote);
-                bars += (nextTime - timeSignatureChange.Time) / barLength;
-            }
-
-            // Calculate components before first time signature change and after last time signature change
-
-            var firstTime = timeSignatureChanges.FirstOrDefault()?.Time ?? time;
-            var lastTime = timeSignatureChanges.LastOrDefault()?.Time ?? time;
-
-            var firstTimeSignature = timeSignatureLine.GetValueAtTime(time);
-            var lastTimeSignature = timeSignatureLine.GetValueAtTime(lastTime);
-
-            long barsBefore, beatsBefore, ticksBefore;
-            CalculateComponents(firstTime - time,
-                                firstTimeSignature,
-                                ticksPerQuarterNote,
-                                out barsBefore,
-                                out beatsBefore,
-                                out ticksBefore);
-
-            long barsAfter, beatsAfter, ticksAfter;
-            CalculateComponents(endTime - lastTime,
-                                lastTimeSignature,
-                                ticksPerQuarterNote,
-                                out barsAfter,
-                                out beatsAfter,
-                                out ticksAfter);
-
-            bars += barsBefore + barsAfter;
-
-            // Try to complete a bar
-
-            beats = beatsBefore + beatsAfter;
-            if (beats > 0 && beatsBefore > 0 && beats >= firstTimeSignature.Numerator)
-            {
-                bars++;
-                beats -= firstTimeSignature.Numerator;
-            }
-
-            // Try to complete a beat
-
-            ticks = ticksBefore + ticksAfter;
-            if (ticks > 0)
-            {
-                var beatLength = BarBeatUtilities.GetBeatLength(firstTimeSignature, ticksPerQuarterNote);
-                if (ticksBefore > 0 && ticks >= beatLength)
-                {
-                    beats++;
-                    ticks -= beatLength;
-                }
-            }
-
-            //
+            var valuesCache = tempoMap.GetBarBeatValuesCache();
+
+            long bars, beats, ticks;
+            ConvertTo(
+                time,
+                endTime,
+                tempoMap.TimeSignatureLine.GetValueAtTime(time),
+                valuesCache.GetLastIndexBelow(time) + 1,
+                valuesCache.GetLastIndexAtOrBelow(endTime),
+                valuesCache,
+                ticksPerQuarterNote,
+                out bars,
+                out beats,
+                out ticks);
 
             return new BarBeatTicksTimeSpan(bars, beats, ticks);
         }
@@ -134,14 +66,16 @@ namespace Melanchall.DryWetMidi.Interaction
             var startBeatLength = BarBeatUtilities.GetBeatLength(startTimeSignature, ticksPerQuarterNote);
 
             var totalTicks = bars * startBarLength + beats * startBeatLength + ticks;
-            var timeSignatureChanges = timeSignatureLine.Where(v => v.Time > time && v.Time < time + totalTicks).ToList();
+
+            var valuesCache = tempoMap.GetBarBeatValuesCache();
+            var firstIndex = valuesCache.GetLastIndexAtOrBelow(time) + 1;
+            var hasTimeSignatureChanges = firstIndex < valuesCache.Count && valuesCache.GetTime(firstIndex) < time + totalTicks;
 
             var lastBarLength = 0L;
             var lastBeatLength = 0L;
 
-            var firstTimeSignatureChange = timeSignatureChanges.FirstOrDefault();
-            var lastTimeSignature = firstTimeSignatureChange?.Value ?? startTimeSignature;
-            var lastTime = firstTimeSignatureChange?.Time ?? time;
+            var lastTimeSignature = hasTimeSignatureChanges ? valuesCache.GetTimeSignature(firstIndex) : startTimeSignature;
+            var lastTime = hasTimeSignatureChanges ? valuesCache.GetTime(firstIndex) : time;
 
             long barsBefore, beatsBefore, ticksBefore;
             CalculateComponents(lastTime - time,
@@ -155,9 +89,9 @@ namespace Melanchall.DryWetMidi.Interaction
 
             // Balance bars
 
-            foreach (var timeSignatureChange in timeSignatureLine.Where(v => v.Time > lastTime).ToList())
+            for (var i = valuesCache.GetLastIndexAtOrBelow(lastTime) + 1; i < valuesCache.Count; i++)
             {
-                var deltaTime = timeSignatureChange.Time - lastTime;
+                var deltaTime = valuesCache.GetTime(i) - lastTime;
 
                 lastBarLength = BarBeatUtilities.GetBarLength(lastTimeSignature, ticksPerQuarterNote);
                 lastBeatLength = BarBeatUtilities.GetBeatLength(lastTimeSignature, ticksPerQuarterNote);
@@ -169,7 +103,7 @@ namespace Melanchall.DryWetMidi.Interaction
                 if (bars == 0)
                     break;
 
-                lastTimeSignature = timeSignatureChange.Value;
+                lastTimeSignature = valuesCache.GetTimeSignature(i);
             }
 
             if (bars > 0)
@@ -216,6 +150,117 @@ namespace Melanchall.DryWetMidi.Interaction
 
         #region Methods
 
+        public static void ConvertTimes(long[] times, long[] bars, long[] beats, long[] ticks, TempoMap tempoMap)
+        {
+            var ticksPerQuarterNoteTimeDivision = tempoMap.TimeDivision as TicksPerQuarterNoteTimeDivision;
+            if (ticksPerQuarterNoteTimeDivision == null)
+                throw new ArgumentException("Time division is not supported for time span conversion.", nameof(tempoMap));
+
+            var ticksPerQuarterNote = ticksPerQuarterNoteTimeDivision.TicksPerQuarterNote;
+            var valuesCache = tempoMap.GetBarBeatValuesCache();
+            var startTimeSignature = tempoMap.TimeSignatureLine.GetValueAtTime(0);
+            var lastIndex = -1;
+
+            for (var i = 0; i < times.Length; i++)
+            {
+                var time = times[i];
+                if (time == 0)
+                {
+                    bars[i] = beats[i] = ticks[i] = 0;
+                    continue;
+                }
+
+                lastIndex = valuesCache.GetLastIndexAtOrBelow(time, lastIndex);
+                ConvertTo(
+                    0,
+                    time,
+                    startTimeSignature,
+                    0,
+                    lastIndex,
+                    valuesCache,
+                    ticksPerQuarterNote,
+                    out bars[i],
+                    out beats[i],
+                    out ticks[i]);
+            }
+        }
+
+        private static void ConvertTo(long time,
+                                      long endTime,
+                                      TimeSignature firstTimeSignature,
+                                      int firstIndex,
+                                      int lastIndex,
+                                      BarBeatTempoMapValuesCache valuesCache,
+                                      short ticksPerQuarterNote,
+                                      out long bars,
+                                      out long beats,
+                                      out long ticks)
+        {
+            if (firstIndex > lastIndex)
+            {
+                CalculateComponents(
+                    endTime - time,
+                    firstTimeSignature,
+                    ticksPerQuarterNote,
+                    out bars,
+                    out beats,
+                    out ticks);
+
+                return;
+            }
+
+            // Calculate count of complete bars between time signature changes
+
+            bars = valuesCache.GetBarsBetween(firstIndex, lastIndex);
+
+            // Calculate components before first time signature change and after last time signature change
+
+            var firstTime = valuesCache.GetTime(firstIndex);
+            var lastTime = valuesCache.GetTime(lastIndex);
+
+            var lastTimeSignature = valuesCache.GetTimeSignature(lastIndex);
+
+            long barsBefore, beatsBefore, ticksBefore;
+            CalculateComponents(firstTime - time,
+                                firstTimeSignature,
+                                ticksPerQuarterNote,
+                                out barsBefore,
+                                out beatsBefore,
+                                out ticksBefore);
+
+            long barsAfter, beatsAfter, ticksAfter;
+            CalculateComponents(endTime - lastTime,
+                                lastTimeSignature,
+                                ticksPerQuarterNote,
+                                out barsAfter,
+                                out beatsAfter,
+                                out ticksAfter);
+
+            bars += barsBefore + barsAfter;
+
+            // Try to complete a bar
+
+            beats = beatsBefore + beatsAfter;
+            if (beats > 0 && beatsBefore > 0 && beats >= firstTimeSignature.Numerator)
+            {
+                bars++;
+                beats -= firstTimeSignature.Numerator;
+            }
+
+            // Try to complete a beat
+
+            ticks = ticksBefore + ticksAfter;
+            if (ticks > 0)
+            {
+                var beatLength = BarBeatUtilities.GetBeatLength(firstTimeSignature, ticksPerQuarterNote);
+                if (ticksBefore > 0 && ticks >= beatLength)
+                {
+                    beats++;
+                    ticks -= beatLength;
+                }
+            }
+        }
+
         private static void CalculateComponents(long totalTicks,
                                                 TimeSignature timeSignature,
                                                 short ticksPerQuarterNote,
@@ -1,5 +1,4 @@
 ﻿using System;
-using System.Linq;
 using Melanchall.DryWetMidi.Common;
 using Melanchall.DryWetMidi.Core;
 
@@ -44,19 +43,40 @@ namespace Melanchall.DryWetMidi.Interaction
 
         #region Methods
 
-        private static long TicksToMicroseconds(long timeSpan, TempoMap tempoMap)
+        public static void ConvertTimes(long[] times, long[] microseconds, TempoMap tempoMap)
         {
-            if (timeSpan == 0)
-                return 0;
+            var ticksPerQuarterNoteTimeDivision = tempoMap.TimeDivision as TicksPerQuarterNoteTimeDivision;
+            if (ticksPerQuarterNoteTimeDivision == null)
+                throw new ArgumentException("Time division is not supported for time span conversion.", nameof(tempoMap));
 
             var valuesCache = tempoMap.GetMetricValuesCache();
-            var accumulatedMicroseconds = MathUtilities.GetLastElementBelowThreshold(valuesCache.Microseconds, timeSpan, m => m.Time);
+            var index = -1;
 
-            var lastAccumulatedMicroseconds = accumulatedMicroseconds?.Microseconds ?? 0;
-            var lastTime = accumulatedMicroseconds?.Time ?? 0;
-            var lastMicrosecondsPerTick = accumulatedMicroseconds?.MicrosecondsPerTick ?? valuesCache.DefaultMicrosecondsPerTick;
+            for (var i = 0; i < times.Length; i++)
+            {
+                var time = times[i];
+                if (time == 0)
+                {
+                    microseconds[i] = 0;
+                    continue;
+                }
 
-            var totalMicroseconds = lastAccumulatedMicroseconds + GetMicroseconds(timeSpan - lastTime, lastMicrosecondsPerTick);
+                index = valuesCache.GetLastIndexBelow(time, index);
+
+                var totalMicroseconds = valuesCache.TicksToMicroseconds(time, index);
+                if (totalMicroseconds > long.MaxValue)
+                    throw new InvalidOperationException("Time span is too big.");
+
+                microseconds[i] = RoundMicroseconds(totalMicroseconds);
+            }
+        }
+
+        private static long TicksToMicroseconds(long timeSpan, TempoMap tempoMap)
+        {
+            if (timeSpan == 0)
+                return 0;
+
+            var totalMicroseconds = tempoMap.GetMetricValuesCache().TicksToMicroseconds(timeSpan);
             if (totalMicroseconds > long.MaxValue)
                 throw new InvalidOperationException("Time span is too big.");
 
@@ -68,19 +88,7 @@ namespace Melanchall.DryWetMidi.Interaction
             if (timeMicroseconds == 0)
                 return 0;
 
-            var valuesCache = tempoMap.GetMetricValuesCache();
-            var accumulatedMicroseconds = valuesCache.Microseconds.TakeWhile(m => m.Microseconds < timeMicroseconds).LastOrDefault();
-
-            var lastAccumulatedMicroseconds = accumulatedMicroseconds?.Microseconds ?? 0;
-            var lastTime = accumulatedMicroseconds?.Time ?? 0;
-            var lastTicksPerMicrosecond = accumulatedMicroseconds?.TicksPerMicrosecond ?? valuesCache.DefaultTicksPerMicrosecond;
-
-            return RoundMicroseconds(lastTime + (timeMicroseconds - lastAccumulatedMicroseconds) * lastTicksPerMicrosecond);
-        }
-
-        private static double GetMicroseconds(long time, double microsecondsPerTick)
-        {
-            return time * microsecondsPerTick;
+            return RoundMicroseconds(tempoMap.GetMetricValuesCache().MicrosecondsToTicks(timeMicroseconds));
         }
 
         private static long RoundMicroseconds(double microseconds)
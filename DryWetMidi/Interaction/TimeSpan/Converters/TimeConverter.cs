@@ -162,6 +162,113 @@ namespace Melanchall.DryWetMidi.Interaction
             return TimeSpanConverter.ConvertFrom(time, 0, tempoMap);
         }
 
+        /// <summary>
+        /// Converts multiple times from <see cref="long"/> to microseconds.
+        /// </summary>
+        /// <param name="times">Times to convert.</param>
+        /// <param name="microseconds">Array to put converted times to. Element at the specified index
+        /// will hold the same value as <see cref="MetricTimeSpan.TotalMicroseconds"/> of
+        /// <c>ConvertTo&lt;MetricTimeSpan&gt;(times[index], tempoMap)</c>.</param>
+        /// <param name="tempoMap">Tempo map used to convert <paramref name="times"/>.</param>
+        /// <remarks>
+        /// The method doesn't create an instance of <see cref="MetricTimeSpan"/> per time. If times
+        /// are sorted in ascending order, all of them are converted with a single pass over tempo changes,
+        /// so the method is the fastest way to convert many times of a MIDI file.
+        /// </remarks>
+        /// <exception cref="ArgumentNullException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><paramref name="times"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="microseconds"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="tempoMap"/> is <c>null</c>.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="times"/> contains negative time.</exception>
+        /// <exception cref="ArgumentException"><paramref name="microseconds"/> is shorter than <paramref name="times"/>.</exception>
+        public static void ConvertToMicroseconds(long[] times, long[] microseconds, TempoMap tempoMap)
+        {
+            ThrowIfArgument.IsNull(nameof(times), times);
+            ThrowIfArgument.IsNull(nameof(microseconds), microseconds);
+            ThrowIfArgument.IsNull(nameof(tempoMap), tempoMap);
+            ThrowIfTimesArgumentIsInvalid(times);
+            ThrowIfOutputArgumentIsTooShort(nameof(microseconds), microseconds, times);
+
+            MetricTimeSpanConverter.ConvertTimes(times, microseconds, tempoMap);
+        }
+
+        /// <summary>
+        /// Converts multiple times from <see cref="long"/> to bars, beats and ticks.
+        /// </summary>
+        /// <param name="times">Times to convert.</param>
+        /// <param name="bars">Array to put bars of converted times to.</param>
+        /// <param name="beats">Array to put beats of converted times to.</param>
+        /// <param name="ticks">Array to put ticks of converted times to.</param>
+        /// <param name="tempoMap">Tempo map used to convert <paramref name="times"/>.</param>
+        /// <remarks>
+        /// <para>Elements of <paramref name="bars"/>, <paramref name="beats"/> and <paramref name="ticks"/>
+        /// at an index will hold the same values as the corresponding properties of
+        /// <c>ConvertTo&lt;BarBeatTicksTimeSpan&gt;(times[index], tempoMap)</c>.</para>
+        /// <para>The method doesn't create an instance of <see cref="BarBeatTicksTimeSpan"/> per time. If times
+        /// are sorted in ascending order, all of them are converted with a single pass over time signature
+        /// changes, so the method is the fastest way to convert many times of a MIDI file.</para>
+        /// </remarks>
+        /// <exception cref="ArgumentNullException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><paramref name="times"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="bars"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="beats"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="ticks"/> is <c>null</c>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="tempoMap"/> is <c>null</c>.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="times"/> contains negative time.</exception>
+        /// <exception cref="ArgumentException">One of the output arrays is shorter than <paramref name="times"/>.</exception>
+        public static void ConvertToBarBeatTicks(long[] times, long[] bars, long[] beats, long[] ticks, TempoMap tempoMap)
+        {
+            ThrowIfArgument.IsNull(nameof(times), times);
+            ThrowIfArgument.IsNull(nameof(bars), bars);
+            ThrowIfArgument.IsNull(nameof(beats), beats);
+            ThrowIfArgument.IsNull(nameof(ticks), ticks);
+            ThrowIfArgument.IsNull(nameof(tempoMap), tempoMap);
+            ThrowIfTimesArgumentIsInvalid(times);
+            ThrowIfOutputArgumentIsTooShort(nameof(bars), bars, times);
+            ThrowIfOutputArgumentIsTooShort(nameof(beats), beats, times);
+            ThrowIfOutputArgumentIsTooShort(nameof(ticks), ticks, times);
+
+            BarBeatTicksTimeSpanConverter.ConvertTimes(times, bars, beats, ticks, tempoMap);
+        }
+
+        private static void ThrowIfTimesArgumentIsInvalid(long[] times)
+        {
+            foreach (var time in times)
+            {
+                ThrowIfTimeArgument.IsNegative(nameof(times), time);
+            }
+        }
+
+        private static void ThrowIfOutputArgumentIsTooShort(string parameterName, long[] output, long[] times)
+        {
+            if (output.Length < times.Length)
+                throw new ArgumentException("Array is shorter than the array of times.", parameterName);
+        }
+
         #endregion
     }
 }
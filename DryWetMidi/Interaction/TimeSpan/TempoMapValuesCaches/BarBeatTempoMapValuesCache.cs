@@ -0,0 +1,101 @@
+﻿using System;
+
+namespace Melanchall.DryWetMidi.Interaction
+{
+    internal sealed class BarBeatTempoMapValuesCache : TempoMapValuesCache<TimeSignature>
+    {
+        #region Constants
+
+        private const int DefaultCapacity = 4;
+
+        // Bars count can't be calculated in advance if some time signature gives bar of zero length
+        private const long UnknownBars = -1;
+
+        #endregion
+
+        #region Fields
+
+        private TimeSignature[] _timeSignatures = new TimeSignature[DefaultCapacity];
+        private long[] _bars = new long[DefaultCapacity];
+        private short _ticksPerQuarterNote;
+
+        #endregion
+
+        #region Constructor
+
+        public BarBeatTempoMapValuesCache()
+            : base(TempoMapLine.TimeSignature)
+        {
+        }
+
+        #endregion
+
+        #region Methods
+
+        public TimeSignature GetTimeSignature(int index)
+        {
+            return _timeSignatures[index];
+        }
+
+        // Returns the sum of complete bars between each pair of adjacent time signature changes
+        // from the first index to the last one
+        public long GetBarsBetween(int firstIndex, int lastIndex)
+        {
+            if (lastIndex <= firstIndex)
+                return 0;
+
+            if (_bars[lastIndex] != UnknownBars)
+                return _bars[lastIndex] - _bars[firstIndex];
+
+            var result = 0L;
+
+            for (var i = firstIndex; i < lastIndex; i++)
+            {
+                var barLength = BarBeatUtilities.GetBarLength(_timeSignatures[i], _ticksPerQuarterNote);
+                result += (GetTime(i + 1) - GetTime(i)) / barLength;
+            }
+
+            return result;
+        }
+
+        #endregion
+
+        #region Overrides
+
+        protected override ValueLine<TimeSignature> GetValueLine(TempoMap tempoMap)
+        {
+            return tempoMap.TimeSignatureLine;
+        }
+
+        protected override void ResizeValues(int capacity)
+        {
+            Array.Resize(ref _timeSignatures, capacity);
+            Array.Resize(ref _bars, capacity);
+        }
+
+        protected override void PrepareValues(short ticksPerQuarterNote)
+        {
+            _ticksPerQuarterNote = ticksPerQuarterNote;
+        }
+
+        protected override void CalculateValues(int index, TimeSignature value, short ticksPerQuarterNote)
+        {
+            _timeSignatures[index] = value;
+
+            if (index == 0)
+            {
+                _bars[index] = 0;
+                return;
+            }
+
+            var lastBars = _bars[index - 1];
+            var lastBarLength = BarBeatUtilities.GetBarLength(_timeSignatures[index - 1], ticksPerQuarterNote);
+
+            _bars[index] = lastBars != UnknownBars && lastBarLength != 0
+                ? lastBars + (GetTime(index) - GetTime(index - 1)) / lastBarLength
+                : UnknownBars;
+        }
+
+        #endregion
+    }
+}
@@ -1,45 +1,36 @@
-﻿using System.Collections.Generic;
+﻿using System;
 using Melanchall.DryWetMidi.Core;
 
 namespace Melanchall.DryWetMidi.Interaction
 {
-    internal sealed class MetricTempoMapValuesCache : ITempoMapValuesCache
+    internal sealed class MetricTempoMapValuesCache : TempoMapValuesCache<Tempo>
     {
-        #region Nested classes
+        #region Constants
 
-        internal sealed class AccumulatedMicroseconds
-        {
-            #region Constructor
-
-            public AccumulatedMicroseconds(long time, double microseconds, double microsecondsPerTick)
-            {
-                Time = time;
-                Microseconds = microseconds;
-                MicrosecondsPerTick = microsecondsPerTick;
-                TicksPerMicrosecond = 1.0 / microsecondsPerTick;
-            }
-
-            #endregion
+        private const int DefaultCapacity = 4;
 
-            #region Properties
+        #endregion
 
-            public long Time { get; }
+        #region Fields
 
-            public double Microseconds { get; }
+        private double[] _microseconds = new double[DefaultCapacity];
+        private double[] _microsecondsPerTick = new double[DefaultCapacity];
+        private double[] _ticksPerMicrosecond = new double[DefaultCapacity];
+        private long[] _microsecondsPerQuarterNote = new long[DefaultCapacity];
 
-            public double MicrosecondsPerTick { get; }
+        #endregion
 
-            public double TicksPerMicrosecond { get; }
+        #region Constructor
 
-            #endregion
+        public MetricTempoMapValuesCache()
+            : base(TempoMapLine.Tempo)
+        {
         }
 
         #endregion
 
         #region Properties
 
-        public AccumulatedMicroseconds[] Microseconds { get; private set; }
-
         public double DefaultMicrosecondsPerTick { get; private set; }
 
         public double DefaultTicksPerMicrosecond { get; private set; }
@@ -48,44 +39,70 @@ namespace Melanchall.DryWetMidi.Interaction
 
         #region Methods
 
-        private static double GetMicroseconds(long time, Tempo tempo, short ticksPerQuarterNote)
+        public double TicksToMicroseconds(long ticks)
         {
-            return time * tempo.MicrosecondsPerQuarterNote / (double)ticksPerQuarterNote;
+            return TicksToMicroseconds(ticks, GetLastIndexBelow(ticks));
         }
 
-        #endregion
-
-        #region ITempoMapValuesCache
+        // Index must be the one returned by GetLastIndexBelow for the ticks
+        public double TicksToMicroseconds(long ticks, int index)
+        {
+            var lastAccumulatedMicroseconds = index >= 0 ? _microseconds[index] : 0;
+            var lastTime = index >= 0 ? GetTime(index) : 0;
+            var lastMicrosecondsPerTick = index >= 0 ? _microsecondsPerTick[index] : DefaultMicrosecondsPerTick;
 
-        public IEnumerable<TempoMapLine> InvalidateOnLines { get; } = new[] { TempoMapLine.Tempo };
+            return lastAccumulatedMicroseconds + (ticks - lastTime) * lastMicrosecondsPerTick;
+        }
 
-        public void Invalidate(TempoMap tempoMap)
+        public double MicrosecondsToTicks(long microseconds)
         {
-            var microseconds = new List<AccumulatedMicroseconds>();
+            var index = GetLastIndexBelow(_microseconds, Count, microseconds);
 
-            var ticksPerQuarterNote = ((TicksPerQuarterNoteTimeDivision)tempoMap.TimeDivision).TicksPerQuarterNote;
+            var lastAccumulatedMicroseconds = index >= 0 ? _microseconds[index] : 0;
+            var lastTime = index >= 0 ? GetTime(index) : 0;
+            var lastTicksPerMicrosecond = index >= 0 ? _ticksPerMicrosecond[index] : DefaultTicksPerMicrosecond;
 
-            var accumulatedMicroseconds = 0d;
-            var lastTime = 0L;
-            var lastTempo = Tempo.Default;
+            return lastTime + (microseconds - lastAccumulatedMicroseconds) * lastTicksPerMicrosecond;
+        }
 
-            foreach (var tempoChange in tempoMap.TempoLine)
-            {
-                var tempoChangeTime = tempoChange.Time;
+        #endregion
 
-                accumulatedMicroseconds += GetMicroseconds(tempoChangeTime - lastTime, lastTempo, ticksPerQuarterNote);
+        #region Overrides
 
-                lastTempo = tempoChange.Value;
-                lastTime = tempoChangeTime;
+        protected override ValueLine<Tempo> GetValueLine(TempoMap tempoMap)
+        {
+            return tempoMap.TempoLine;
+        }
 
-                microseconds.Add(new AccumulatedMicroseconds(tempoChangeTime, accumulatedMicroseconds, lastTempo.MicrosecondsPerQuarterNote / (double)ticksPerQuarterNote));
-            }
+        protected override void ResizeValues(int capacity)
+        {
+            Array.Resize(ref _microseconds, capacity);
+            Array.Resize(ref _microsecondsPerTick, capacity);
+            Array.Resize(ref _ticksPerMicrosecond, capacity);
+            Array.Resize(ref _microsecondsPerQuarterNote, capacity);
+        }
 
-            Microseconds = microseconds.ToArray();
+        protected override void PrepareValues(short ticksPerQuarterNote)
+        {
             DefaultMicrosecondsPerTick = Tempo.Default.MicrosecondsPerQuarterNote / (double)ticksPerQuarterNote;
             DefaultTicksPerMicrosecond = 1.0 / DefaultMicrosecondsPerTick;
         }
 
+        protected override void CalculateValues(int index, Tempo value, short ticksPerQuarterNote)
+        {
+            var time = GetTime(index);
+            var lastTime = index > 0 ? GetTime(index - 1) : 0;
+            var lastAccumulatedMicroseconds = index > 0 ? _microseconds[index - 1] : 0;
+            var lastMicrosecondsPerQuarterNote = index > 0 ? _microsecondsPerQuarterNote[index - 1] : Tempo.Default.MicrosecondsPerQuarterNote;
+
+            var microsecondsPerTick = value.MicrosecondsPerQuarterNote / (double)ticksPerQuarterNote;
+
+            _microseconds[index] = lastAccumulatedMicroseconds + (time - lastTime) * lastMicrosecondsPerQuarterNote / (double)ticksPerQuarterNote;
+            _microsecondsPerTick[index] = microsecondsPerTick;
+            _ticksPerMicrosecond[index] = 1.0 / microsecondsPerTick;
+            _microsecondsPerQuarterNote[index] = value.MicrosecondsPerQuarterNote;
+        }
+
         #endregion
     }
 }
@@ -0,0 +1,191 @@
+﻿using System;
+using System.Collections.Generic;
+using Melanchall.DryWetMidi.Core;
+
+namespace Melanchall.DryWetMidi.Interaction
+{
+    // Holds values calculated for each change of a tempo map line where a value at a change
+    // depends on previous changes only. So when the line is changed at some time, values at
+    // the changes before that time are kept and the rest ones are recalculated on next access
+    internal abstract class TempoMapValuesCache<TValue> : ITempoMapValuesCache
+    {
+        #region Constants
+
+        private const int DefaultCapacity = 4;
+
+        #endregion
+
+        #region Fields
+
+        private readonly object _updateLock = new object();
+
+        private long[] _times = new long[DefaultCapacity];
+        private int _count;
+        private int _validCount;
+        private short _ticksPerQuarterNote;
+        private volatile bool _isUpToDate;
+
+        #endregion
+
+        #region Constructor
+
+        protected TempoMapValuesCache(TempoMapLine tempoMapLine)
+        {
+            InvalidateOnLines = new[] { tempoMapLine };
+        }
+
+        #endregion
+
+        #region Properties
+
+        public int Count => _count;
+
+        #endregion
+
+        #region Methods
+
+        public void Update(TempoMap tempoMap)
+        {
+            var ticksPerQuarterNote = ((TicksPerQuarterNoteTimeDivision)tempoMap.TimeDivision).TicksPerQuarterNote;
+            if (_isUpToDate && ticksPerQuarterNote == _ticksPerQuarterNote)
+                return;
+
+            lock (_updateLock)
+            {
+                if (_isUpToDate && ticksPerQuarterNote == _ticksPerQuarterNote)
+                    return;
+
+                if (ticksPerQuarterNote != _ticksPerQuarterNote)
+                    _validCount = 0;
+
+                PrepareValues(ticksPerQuarterNote);
+
+                var valueLine = GetValueLine(tempoMap);
+                var count = valueLine.ValueChangesCount;
+
+                if (count > _times.Length)
+                {
+                    var capacity = Math.Max(count, _times.Length * 2);
+                    Array.Resize(ref _times, capacity);
+                    ResizeValues(capacity);
+                }
+
+                for (var i = _validCount; i < count; i++)
+                {
+                    var valueChange = valueLine[i];
+                    _times[i] = valueChange.Time;
+                    CalculateValues(i, valueChange.Value, ticksPerQuarterNote);
+                }
+
+                _count = count;
+                _validCount = count;
+                _ticksPerQuarterNote = ticksPerQuarterNote;
+                _isUpToDate = true;
+            }
+        }
+
+        public long GetTime(int index)
+        {
+            return _times[index];
+        }
+
+        // Returns index of the last change with time less than the specified one or -1 if there is no such change
+        public int GetLastIndexBelow(long time)
+        {
+            return GetLastIndexBelow(_times, _count, time);
+        }
+
+        // Returns index of the last change with time less than or equal to the specified one or -1 if there is no such change
+        public int GetLastIndexAtOrBelow(long time)
+        {
+            return time < long.MaxValue
+                ? GetLastIndexBelow(time + 1)
+                : _count - 1;
+        }
+
+        // Does the same as GetLastIndexBelow(time) but starts from the index returned for a previous
+        // time, so increasing times are processed with a single pass over changes
+        public int GetLastIndexBelow(long time, int previousIndex)
+        {
+            if (previousIndex >= 0 && _times[previousIndex] >= time)
+                return GetLastIndexBelow(time);
+
+            var index = previousIndex;
+            while (index + 1 < _count && _times[index + 1] < time)
+            {
+                index++;
+            }
+
+            return index;
+        }
+
+        public int GetLastIndexAtOrBelow(long time, int previousIndex)
+        {
+            return time < long.MaxValue
+                ? GetLastIndexBelow(time + 1, previousIndex)
+                : _count - 1;
+        }
+
+        protected static int GetLastIndexBelow(double[] values, int count, double value)
+        {
+            var firstIndex = 0;
+            var lastIndex = count - 1;
+
+            while (firstIndex <= lastIndex)
+            {
+                var middleIndex = (firstIndex + lastIndex) / 2;
+                if (values[middleIndex] >= value)
+                    lastIndex = middleIndex - 1;
+                else
+                    firstIndex = middleIndex + 1;
+            }
+
+            return firstIndex - 1;
+        }
+
+        protected abstract ValueLine<TValue> GetValueLine(TempoMap tempoMap);
+
+        protected abstract void ResizeValues(int capacity);
+
+        protected virtual void PrepareValues(short ticksPerQuarterNote)
+        {
+        }
+
+        // Values of previous changes (with indices less than the specified one) are already calculated
+        protected abstract void CalculateValues(int index, TValue value, short ticksPerQuarterNote);
+
+        private static int GetLastIndexBelow(long[] times, int count, long time)
+        {
+            var firstIndex = 0;
+            var lastIndex = count - 1;
+
+            while (firstIndex <= lastIndex)
+            {
+                var middleIndex = (firstIndex + lastIndex) / 2;
+                if (times[middleIndex] >= time)
+                    lastIndex = middleIndex - 1;
+                else
+                    firstIndex = middleIndex + 1;
+            }
+
+            return firstIndex - 1;
+        }
+
+        #endregion
+
+        #region ITempoMapValuesCache
+
+        public IEnumerable<TempoMapLine> InvalidateOnLines { get; }
+
+        public void Invalidate(TempoMap tempoMap, long time)
+        {
+            lock (_updateLock)
+            {
+                _validCount = GetLastIndexBelow(_times, _validCount, time) + 1;
+                _isUpToDate = false;
+            }
+        }
+
+        #endregion
+    }
+}
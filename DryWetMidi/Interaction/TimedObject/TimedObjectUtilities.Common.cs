@@ -274,6 +274,9 @@ namespace Melanchall.DryWetMidi.Interaction
             return obj;
         }
 
+        // Merges collections with a binary min-heap of their enumerators ordered by the time of the
+        // current object and then by the index of a collection, so objects with the same time are
+        // returned in the order of collections and each next object is found in O(log K) time
         internal static IEnumerable<TObject> MergeSortedObjectsCollections<TObject>(
             this IEnumerable<IEnumerable<TObject>> sortedObjectsCollections)
             where TObject : ITimedObject
@@ -284,52 +287,75 @@ namespace Melanchall.DryWetMidi.Interaction
 
             var enumeratorsLength = enumerators.Length;
 
+            var heap = new int[enumeratorsLength];
+            var heapSize = 0;
+            var times = new long[enumeratorsLength];
+
             for (var i = 0; i < enumeratorsLength; i++)
             {
-                if (!enumerators[i].MoveNext())
-                    enumerators[i] = null;
+                var enumerator = enumerators[i];
+                if (!enumerator.MoveNext())
+                    continue;
+
+                times[i] = enumerator.Current.Time;
+                heap[heapSize++] = i;
+            }
+
+            for (var i = heapSize / 2 - 1; i >= 0; i--)
+            {
+                SiftDown(heap, heapSize, times, i);
             }
 
-            var lastTime = -1L;
+            while (heapSize > 0)
+            {
+                var enumeratorIndex = heap[0];
+                var enumerator = enumerators[enumeratorIndex];
+                yield return enumerator.Current;
+
+                if (enumerator.MoveNext())
+                    times[enumeratorIndex] = enumerator.Current.Time;
+                else
+                    heap[0] = heap[--heapSize];
+
+                SiftDown(heap, heapSize, times, 0);
+            }
+        }
+
+        private static void SiftDown(int[] heap, int heapSize, long[] times, int position)
+        {
+            var index = heap[position];
 
             while (true)
             {
-                var minTime = long.MaxValue;
-                var minTimeEnumeratorIndex = -1;
+                var childPosition = 2 * position + 1;
+                if (childPosition >= heapSize)
+                    break;
+
+                var childIndex = heap[childPosition];
 
-                for (var i = 0; i < enumeratorsLength; i++)
+                var rightChildPosition = childPosition + 1;
+                if (rightChildPosition < heapSize && IsLess(heap[rightChildPosition], childIndex, times))
                 {
-                    var enumerator = enumerators[i];
-                    if (enumerator == null)
-                        continue;
-
-                    var time = enumerator.Current.Time;
-                    if (time == lastTime)
-                    {
-                        minTimeEnumeratorIndex = i;
-                        break;
-                    }
-
-                    if (time < minTime)
-                    {
-                        minTime = time;
-                        minTimeEnumeratorIndex = i;
-                    }
+                    childPosition = rightChildPosition;
+                    childIndex = heap[rightChildPosition];
                 }
 
-                if (minTimeEnumeratorIndex < 0)
+                if (!IsLess(childIndex, index, times))
                     break;
 
-                var minTimeEnumerator = enumerators[minTimeEnumeratorIndex];
-                yield return minTimeEnumerator.Current;
+                heap[position] = childIndex;
+                position = childPosition;
+            }
+
+            heap[position] = index;
+        }
 
-                lastTime = minTimeEnumerator.Current.Time;
+        private static bool IsLess(int index1, int index2, long[] times)
+        {
+            var time1 = times[index1];
+            var time2 = times[index2];
 
-                if (!minTimeEnumerator.MoveNext())
-                {
-                    enumerators[minTimeEnumeratorIndex] = null;
-                }
-            }
+            return time1 < time2 || (time1 == time2 && index1 < index2);
         }
 
         private static void AddTimedEventsToEventsCollection(EventsCollection eventsCollection, IEnumerable<ITimedObject> timedObjects)
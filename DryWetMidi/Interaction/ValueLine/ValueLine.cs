@@ -10,7 +10,7 @@ namespace Melanchall.DryWetMidi.Interaction
     {
         #region Events
 
-        internal event EventHandler ValuesChanged;
+        internal event EventHandler<ValueLineChangedEventArgs> ValuesChanged;
 
         #endregion
 
@@ -40,6 +40,14 @@ namespace Melanchall.DryWetMidi.Interaction
             }
         }
 
+        public ValueChange<TValue> this[int index]
+        {
+            get
+            {
+                return _valueChanges[index];
+            }
+        }
+
         #endregion
 
         #region Methods
@@ -99,7 +107,7 @@ namespace Melanchall.DryWetMidi.Interaction
         {
             var result = SetValueInternal(time, value);
             if (result)
-                OnValuesChanged();
+                OnValuesChanged(time);
             
             return result;
         }
@@ -144,7 +152,7 @@ namespace Melanchall.DryWetMidi.Interaction
                 return false;
 
             _valueChanges.RemoveRange(startIndex, count);
-            OnValuesChanged();
+            OnValuesChanged(startTime);
 
             return true;
         }
@@ -155,14 +163,14 @@ namespace Melanchall.DryWetMidi.Interaction
             _valueChanges.Clear();
 
             if (count > 0)
-                OnValuesChanged();
+                OnValuesChanged(0);
         }
 
         public void ReplaceValues(ValueLine<TValue> valueLine)
         {
             _defaultValue = valueLine._defaultValue;
             _valueChanges = valueLine.ToList();
-            OnValuesChanged();
+            OnValuesChanged(0);
         }
 
         public ValueLine<TValue> Reverse(long centerTime)
@@ -183,9 +191,9 @@ namespace Melanchall.DryWetMidi.Interaction
             return result;
         }
 
-        private void OnValuesChanged()
+        private void OnValuesChanged(long time)
         {
-            ValuesChanged?.Invoke(this, EventArgs.Empty);
+            ValuesChanged?.Invoke(this, new ValueLineChangedEventArgs(time));
         }
 
         public bool SetValueInternal(long time, TValue value)
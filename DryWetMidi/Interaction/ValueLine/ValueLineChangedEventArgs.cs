@@ -0,0 +1,23 @@
+﻿using System;
+
+namespace Melanchall.DryWetMidi.Interaction
+{
+    internal sealed class ValueLineChangedEventArgs : EventArgs
+    {
+        #region Constructor
+
+        public ValueLineChangedEventArgs(long time)
+        {
+            Time = time;
+        }
+
+        #endregion
+
+        #region Properties
+
+        // Values are the same as before the change at times less than this one
+        public long Time { get; }
+
+        #endregion
+    }
+}
@@ -38,6 +38,7 @@ namespace Melanchall.DryWetMidi.Multimedia
         private double _speed = DefaultSpeed;
 
         private readonly TickGenerator _tickGenerator;
+        private readonly MidiClockTickingMode _tickingMode;
 
         #endregion
 
@@ -52,10 +53,24 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// immediately after clock started.</param>
         /// <param name="tickGenerator">Tick generator used as timer firing at the specified interval. Null for
         /// no tick generator.</param>
-        /// <param name="interval">Interval of clock's ticking.</param>
+        /// <param name="interval">Interval of clock's ticking. Intervals less than
+        /// <see cref="HighPrecisionTickGenerator.MinInterval"/> (down to <see cref="HighPrecisionTickGenerator.MinSubMillisecondInterval"/>)
+        /// are supported by <see cref="HighPrecisionTickGenerator"/> on Linux only; other tick generators
+        /// reject such intervals when the clock is started.</param>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="interval"/> is less than
+        /// <see cref="HighPrecisionTickGenerator.MinSubMillisecondInterval"/>.</exception>
         public MidiClock(bool startImmediately, TickGenerator tickGenerator, TimeSpan interval)
+            : this(startImmediately, tickGenerator, interval, MidiClockTickingMode.FixedInterval)
         {
-            ThrowIfArgument.IsLessThan(nameof(interval), interval, TimeSpan.FromMilliseconds(1), "Interval is less than 1 ms.");
+        }
+
+        internal MidiClock(bool startImmediately, TickGenerator tickGenerator, TimeSpan interval, MidiClockTickingMode tickingMode)
+        {
+            ThrowIfArgument.IsLessThan(
+                nameof(interval),
+                interval,
+                HighPrecisionTickGenerator.MinSubMillisecondInterval,
+                $"Interval is less than {HighPrecisionTickGenerator.MinSubMillisecondInterval}.");
 
             _startImmediately = startImmediately;
 
@@ -64,6 +79,7 @@ namespace Melanchall.DryWetMidi.Multimedia
                 _tickGenerator.TickGenerated += OnTickGenerated;
 
             Interval = interval;
+            _tickingMode = tickingMode;
         }
 
         #endregion
@@ -141,6 +157,12 @@ namespace Melanchall.DryWetMidi.Multimedia
             }
         }
 
+        internal bool CanScheduleTicks => _tickGenerator != null && (_tickGenerator.CanScheduleTicks || TicksOneShot);
+
+        // In deadline mode the tick generator doesn't tick by itself, so ticks must
+        // be scheduled by the clock driven object
+        private bool TicksOneShot => _tickingMode == MidiClockTickingMode.Deadline && _tickGenerator != null && _tickGenerator.CanTickOneShot;
+
 #if TRACE
         internal MidiClockTracer Tracer { get; set; } = new MidiClockTracer();
 #endif
@@ -153,6 +175,8 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// Starts/resumes the clock.
         /// </summary>
         /// <exception cref="ObjectDisposedException">The current <see cref="MidiClock"/> is disposed.</exception>
+        /// <exception cref="ArgumentOutOfRangeException"><see cref="Interval"/> is not supported by
+        /// the tick generator on the current platform.</exception>
         public void Start()
         {
             EnsureIsNotDisposed();
@@ -160,7 +184,11 @@ namespace Melanchall.DryWetMidi.Multimedia
             if (IsRunning)
                 return;
 
-            _tickGenerator?.TryStart(Interval);
+            if (TicksOneShot)
+                _tickGenerator.TryStartOneShot();
+            else
+                _tickGenerator?.TryStart(Interval);
+
             _stopwatch.Start();
             StartTracing();
 
@@ -231,6 +259,39 @@ namespace Melanchall.DryWetMidi.Multimedia
             OnTicked();
         }
 
+        // Asks tick generator to generate the next tick at the specified clock's time
+        // taking the current speed into account
+        internal void ScheduleTick(TimeSpan time)
+        {
+            if (_disposed || !CanScheduleTicks)
+                return;
+
+            TimeSpan currentTime;
+
+            lock (_lockObject)
+            {
+                if (!_stopwatch.IsRunning)
+                    return;
+
+                currentTime = GetCurrentTime();
+            }
+
+            var speed = Speed;
+            if (speed <= 0)
+                return;
+
+            // Tick is requested as soon as possible if the time has passed already, tick
+            // generators clamp the delay to the minimum one they support
+            var delayTicks = Math.Ceiling((time - currentTime).Ticks / speed);
+            var delay = delayTicks <= 0
+                ? TimeSpan.Zero
+                : (delayTicks >= HighPrecisionTickGenerator.MaxInterval.Ticks
+                    ? HighPrecisionTickGenerator.MaxInterval
+                    : TimeSpan.FromTicks((long)delayTicks));
+
+            _tickGenerator.ScheduleTick(delay);
+        }
+
         internal void StopInternally()
         {
             if (_disposed)
@@ -31,6 +31,19 @@ namespace Melanchall.DryWetMidi.Multimedia
             }
         }
 
+        /// <summary>
+        /// Gets or sets the mode of clock's ticking. The default value is
+        /// <see cref="MidiClockTickingMode.FixedInterval"/>.
+        /// </summary>
+        /// <remarks>
+        /// <see cref="MidiClockTickingMode.Deadline"/> mode is supported by <see cref="HighPrecisionTickGenerator"/>,
+        /// <see cref="RegularPrecisionTickGenerator"/> and tick generators created by <see cref="PlaybackScheduler"/>,
+        /// and used by <see cref="Playback"/> only. Clocks of other objects (for example,
+        /// <see cref="PlaybackCurrentTimeWatcher"/>) and clocks with custom tick generators always tick
+        /// at the fixed interval.
+        /// </remarks>
+        public MidiClockTickingMode TickingMode { get; set; } = MidiClockTickingMode.FixedInterval;
+
         #endregion
     }
 }
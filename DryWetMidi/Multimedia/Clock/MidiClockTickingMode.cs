@@ -0,0 +1,23 @@
+﻿namespace Melanchall.DryWetMidi.Multimedia
+{
+    /// <summary>
+    /// Specifies how <see cref="MidiClock"/> of a clock driven object generates ticks.
+    /// </summary>
+    /// <seealso cref="MidiClockSettings.TickingMode"/>
+    public enum MidiClockTickingMode
+    {
+        /// <summary>
+        /// Clock ticks at the fixed interval regardless of whether there is something
+        /// to do on a tick. This is the default mode.
+        /// </summary>
+        FixedInterval = 0,
+
+        /// <summary>
+        /// Clock ticks only at the times requested by the clock driven object, for example,
+        /// at the time of the next event to play. The tick generator is rearmed for a new
+        /// deadline on every tick, and also on changing speed and position. If the tick generator
+        /// doesn't support this mode, ticks are generated at the fixed interval.
+        /// </summary>
+        Deadline = 1,
+    }
+}
@@ -5,7 +5,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 {
     /// <summary>
     /// Tick generator providing most accurate ticking, allowing firing intervals of 1 ms which
-    /// is the smallest possible one.
+    /// is the smallest possible one. On Linux intervals down to <see cref="MinSubMillisecondInterval"/>
+    /// are supported.
     /// </summary>
     public sealed class HighPrecisionTickGenerator : TickGenerator
     {
@@ -16,6 +17,12 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         public static readonly TimeSpan MinInterval = TimeSpan.FromMilliseconds(1);
 
+        /// <summary>
+        /// The smallest possible interval on Linux where ticking is driven by absolute
+        /// deadlines rather than by a millisecond timer.
+        /// </summary>
+        public static readonly TimeSpan MinSubMillisecondInterval = TimeSpan.FromTicks(TimeSpan.TicksPerMillisecond / 10);
+
         /// <summary>
         /// The largest possible interval.
         /// </summary>
@@ -29,6 +36,7 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private TickGeneratorApi.TimerCallback_Win _tickCallback_Win;
         private TickGeneratorApi.TimerCallback_Mac _tickCallback_Mac;
+        private TickGeneratorApi.TimerCallback_Linux _tickCallback_Linux;
         private IntPtr _tickGeneratorInfo;
 
         private readonly object _lockObject = new object();
@@ -54,21 +62,30 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         /// <param name="interval">Interval between ticks.</param>
         /// <exception cref="ArgumentOutOfRangeException"><paramref name="interval"/> is out of
-        /// [<see cref="MinInterval"/>; <see cref="MaxInterval"/>] range.</exception>
+        /// [<see cref="MinInterval"/>; <see cref="MaxInterval"/>] range (or out of
+        /// [<see cref="MinSubMillisecondInterval"/>; <see cref="MaxInterval"/>] range on Linux).</exception>
         protected override void Start(TimeSpan interval)
         {
             ThrowIfArgument.IsOutOfRange(
                 nameof(interval),
                 interval,
-                MinInterval,
+                MinSubMillisecondInterval,
                 MaxInterval,
-                $"Interval is out of [{MinInterval}, {MaxInterval}] range.");
+                $"Interval is out of [{MinSubMillisecondInterval}, {MaxInterval}] range.");
+
+            var apiType = CommonApiProvider.Api.Api_GetApiType();
+            if (apiType != CommonApi.API_TYPE.API_TYPE_LINUX)
+                ThrowIfArgument.IsOutOfRange(
+                    nameof(interval),
+                    interval,
+                    MinInterval,
+                    MaxInterval,
+                    $"Interval is out of [{MinInterval}, {MaxInterval}] range.");
+
             EnsureSessionIsCreated();
 
             var intervalInMilliseconds = (int)interval.TotalMilliseconds;
-
-            var apiType = CommonApiProvider.Api.Api_GetApiType();
-            var sessionHandle = TickGeneratorSession.GetSessionHandle();
+            var intervalInMicroseconds = interval.Ticks / (TimeSpan.TicksPerMillisecond / 1000);
 
             switch (apiType)
             {
@@ -80,6 +97,10 @@ namespace Melanchall.DryWetMidi.Multimedia
                     NativeApiUtilities.HandleTickGeneratorNativeApiResult(
                         StartHighPrecisionTickGenerator_Mac(intervalInMilliseconds, out _tickGeneratorInfo));
                     break;
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
+                    NativeApiUtilities.HandleTickGeneratorNativeApiResult(
+                        StartHighPrecisionTickGenerator_Linux(intervalInMicroseconds, out _tickGeneratorInfo));
+                    break;
             }
         }
 
@@ -92,6 +113,49 @@ namespace Melanchall.DryWetMidi.Multimedia
                 StopInternal());
         }
 
+        internal override bool CanTickOneShot => true;
+
+        internal override void StartOneShot()
+        {
+            EnsureSessionIsCreated();
+
+            var sessionHandle = TickGeneratorSession.GetSessionHandle();
+
+            switch (CommonApiProvider.Api.Api_GetApiType())
+            {
+                case CommonApi.API_TYPE.API_TYPE_WIN:
+                    _tickCallback_Win = OnTick_Win;
+                    NativeApiUtilities.HandleTickGeneratorNativeApiResult(
+                        TickGeneratorApiProvider.Api.Api_StartOneShotHighPrecisionTickGenerator_Win(sessionHandle, _tickCallback_Win, out _tickGeneratorInfo));
+                    break;
+                case CommonApi.API_TYPE.API_TYPE_MAC:
+                    _tickCallback_Mac = OnTick_Mac;
+                    NativeApiUtilities.HandleTickGeneratorNativeApiResult(
+                        TickGeneratorApiProvider.Api.Api_StartOneShotHighPrecisionTickGenerator_Mac(sessionHandle, _tickCallback_Mac, out _tickGeneratorInfo));
+                    break;
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
+                    _tickCallback_Linux = OnTick_Linux;
+                    NativeApiUtilities.HandleTickGeneratorNativeApiResult(
+                        TickGeneratorApiProvider.Api.Api_StartOneShotHighPrecisionTickGenerator_Linux(sessionHandle, _tickCallback_Linux, out _tickGeneratorInfo));
+                    break;
+            }
+        }
+
+        internal override void ScheduleTick(TimeSpan delay)
+        {
+            lock (_lockObject)
+            {
+                if (_tickGeneratorInfo == IntPtr.Zero)
+                    return;
+
+                var ticksPerMicrosecond = TimeSpan.TicksPerMillisecond / 1000;
+                var delayInMicroseconds = (delay.Ticks + ticksPerMicrosecond - 1) / ticksPerMicrosecond;
+
+                NativeApiUtilities.HandleTickGeneratorNativeApiResult(
+                    TickGeneratorApiProvider.Api.Api_ScheduleHighPrecisionTickGeneratorTick(TickGeneratorSession.GetSessionHandle(), _tickGeneratorInfo, delayInMicroseconds));
+            }
+        }
+
         #endregion
 
         #region Methods
@@ -106,6 +170,11 @@ namespace Melanchall.DryWetMidi.Multimedia
             OnTick();
         }
 
+        private void OnTick_Linux()
+        {
+            OnTick();
+        }
+
         private void OnTick()
         {
             if (!IsRunning || _disposed)
@@ -119,15 +188,20 @@ namespace Melanchall.DryWetMidi.Multimedia
             if (_tickGeneratorInfo == IntPtr.Zero)
                 return TickGeneratorApi.TG_STOPRESULT.TG_STOPRESULT_OK;
 
+            IntPtr tickGeneratorInfo;
+
             lock (_lockObject)
             {
-                if (_tickGeneratorInfo == IntPtr.Zero)
-                    return TickGeneratorApi.TG_STOPRESULT.TG_STOPRESULT_OK;
-
-                var result = TickGeneratorApiProvider.Api.Api_StopHighPrecisionTickGenerator(TickGeneratorSession.GetSessionHandle(), _tickGeneratorInfo);
+                tickGeneratorInfo = _tickGeneratorInfo;
                 _tickGeneratorInfo = IntPtr.Zero;
-                return result;
             }
+
+            if (tickGeneratorInfo == IntPtr.Zero)
+                return TickGeneratorApi.TG_STOPRESULT.TG_STOPRESULT_OK;
+
+            // Native generator is stopped outside of the lock since stopping waits for
+            // the current tick which can schedule the next one
+            return TickGeneratorApiProvider.Api.Api_StopHighPrecisionTickGenerator(TickGeneratorSession.GetSessionHandle(), tickGeneratorInfo);
         }
 
         private TickGeneratorApi.TG_STARTRESULT StartHighPrecisionTickGenerator_Win(int intervalInMilliseconds, out IntPtr tickGeneratorInfo)
@@ -150,6 +224,16 @@ namespace Melanchall.DryWetMidi.Multimedia
                 out tickGeneratorInfo);
         }
 
+        private TickGeneratorApi.TG_STARTRESULT StartHighPrecisionTickGenerator_Linux(long intervalInMicroseconds, out IntPtr tickGeneratorInfo)
+        {
+            _tickCallback_Linux = OnTick_Linux;
+            return TickGeneratorApiProvider.Api.Api_StartHighPrecisionTickGenerator_Linux(
+                intervalInMicroseconds,
+                TickGeneratorSession.GetSessionHandle(),
+                _tickCallback_Linux,
+                out tickGeneratorInfo);
+        }
+
         private void EnsureSessionIsCreated()
         {
             TickGeneratorSession.GetSessionHandle();
@@ -25,6 +25,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         #region Fields
 
+        private readonly object _timerLockObject = new object();
+
         private Timer _timer;
         private bool _disposed = false;
 
@@ -47,9 +49,11 @@ namespace Melanchall.DryWetMidi.Multimedia
                 MaxInterval,
                 $"Interval is out of [{MinInterval}, {MaxInterval}] range.");
 
-            _timer = new Timer(interval.TotalMilliseconds);
-            _timer.Elapsed += OnElapsed;
-            _timer.Start();
+            lock (_timerLockObject)
+            {
+                CreateTimer(new Timer(interval.TotalMilliseconds));
+                _timer.Start();
+            }
         }
 
         /// <summary>
@@ -57,7 +61,36 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         protected override void Stop()
         {
-            _timer.Stop();
+            lock (_timerLockObject)
+            {
+                DisposeTimer();
+            }
+        }
+
+        internal override bool CanTickOneShot => true;
+
+        internal override void StartOneShot()
+        {
+            lock (_timerLockObject)
+            {
+                CreateTimer(new Timer { AutoReset = false });
+            }
+        }
+
+        internal override void ScheduleTick(TimeSpan delay)
+        {
+            lock (_timerLockObject)
+            {
+                // Timer is disposed on stop, so a tick scheduled after that doesn't restart it
+                if (!IsRunning || _timer == null || _timer.AutoReset)
+                    return;
+
+                // Setting the interval restarts the timer if it's already enabled
+                _timer.Interval = Math.Min(
+                    Math.Max(Math.Ceiling(delay.TotalMilliseconds), MinInterval.TotalMilliseconds),
+                    MaxInterval.TotalMilliseconds);
+                _timer.Start();
+            }
         }
 
         #endregion
@@ -66,12 +99,32 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private void OnElapsed(object sender, ElapsedEventArgs e)
         {
-            if (!IsRunning || _disposed)
+            // Elapsed event of a replaced timer can be raised after the replacement
+            if (!IsRunning || _disposed || sender != _timer)
                 return;
 
             GenerateTick();
         }
 
+        private void CreateTimer(Timer timer)
+        {
+            DisposeTimer();
+
+            _timer = timer;
+            _timer.Elapsed += OnElapsed;
+        }
+
+        private void DisposeTimer()
+        {
+            if (_timer == null)
+                return;
+
+            _timer.Stop();
+            _timer.Elapsed -= OnElapsed;
+            _timer.Dispose();
+            _timer = null;
+        }
+
         #endregion
 
         #region IDisposable
@@ -84,11 +137,12 @@ namespace Melanchall.DryWetMidi.Multimedia
             if (_disposed)
                 return;
 
-            if (disposing && IsRunning)
+            if (disposing)
             {
-                _timer.Stop();
-                _timer.Elapsed -= OnElapsed;
-                _timer.Dispose();
+                lock (_timerLockObject)
+                {
+                    DisposeTimer();
+                }
             }
 
             _disposed = true;
@@ -29,6 +29,14 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         protected bool IsRunning { get; private set; }
 
+        // Tick generator able to tick at specified deadlines lets a clock driven object
+        // request the next tick right at the time it's needed instead of ticking at the interval
+        internal virtual bool CanScheduleTicks => false;
+
+        // Tick generator started in one-shot mode doesn't tick by itself, it generates a single
+        // tick for every ScheduleTick call
+        internal virtual bool CanTickOneShot => false;
+
         #endregion
 
         #region Methods
@@ -42,6 +50,15 @@ namespace Melanchall.DryWetMidi.Multimedia
             IsRunning = true;
         }
 
+        internal void TryStartOneShot()
+        {
+            if (IsRunning)
+                return;
+
+            StartOneShot();
+            IsRunning = true;
+        }
+
         internal void TryStop()
         {
             if (!IsRunning)
@@ -51,6 +68,17 @@ namespace Melanchall.DryWetMidi.Multimedia
             IsRunning = false;
         }
 
+        // Replaces the time of the next tick; subsequent ticks are generated at the interval
+        // (or are not generated at all in one-shot mode) until the next call
+        internal virtual void ScheduleTick(TimeSpan delay)
+        {
+        }
+
+        internal virtual void StartOneShot()
+        {
+            throw new NotSupportedException("Tick generator doesn't support one-shot mode.");
+        }
+
         /// <summary>
         /// Generates a tick firing the <see cref="TickGenerated"/> event.
         /// </summary>
@@ -15,6 +15,7 @@ namespace Melanchall.DryWetMidi.Multimedia
 
             TG_STARTRESULT_NORESOURCES = 101,
             TG_STARTRESULT_BADTHREADATTRIBUTE = 102,
+            TG_STARTRESULT_CANTCREATETIMER = 103,
             TG_STARTRESULT_UNKNOWNERROR = 199
         }
 
@@ -26,6 +27,15 @@ namespace Melanchall.DryWetMidi.Multimedia
             TG_STOPRESULT_CANTKILLEVENT = 2
         }
 
+        public enum TG_SCHEDULERESULT
+        {
+            TG_SCHEDULERESULT_OK = 0,
+
+            TG_SCHEDULERESULT_CANTSETTIMERCALLBACK = 1,
+
+            TG_SCHEDULERESULT_CANTSETTIMERTIME = 101
+        }
+
         #endregion
 
         #region Delegates
@@ -34,6 +44,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public delegate void TimerCallback_Mac();
 
+        public delegate void TimerCallback_Linux();
+
         #endregion
 
         #region Methods
@@ -42,8 +54,22 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public abstract TG_STARTRESULT Api_StartHighPrecisionTickGenerator_Mac(int interval, IntPtr sessionHandle, TimerCallback_Mac callback, out IntPtr info);
 
+        public abstract TG_STARTRESULT Api_StartHighPrecisionTickGenerator_Linux(long intervalInMicroseconds, IntPtr sessionHandle, TimerCallback_Linux callback, out IntPtr info);
+
+        public abstract TG_STARTRESULT Api_StartOneShotHighPrecisionTickGenerator_Win(IntPtr sessionHandle, TimerCallback_Win callback, out IntPtr info);
+
+        public abstract TG_STARTRESULT Api_StartOneShotHighPrecisionTickGenerator_Mac(IntPtr sessionHandle, TimerCallback_Mac callback, out IntPtr info);
+
+        public abstract TG_STARTRESULT Api_StartOneShotHighPrecisionTickGenerator_Linux(IntPtr sessionHandle, TimerCallback_Linux callback, out IntPtr info);
+
+        public abstract TG_SCHEDULERESULT Api_ScheduleHighPrecisionTickGeneratorTick(IntPtr sessionHandle, IntPtr info, long delayInMicroseconds);
+
         public abstract TG_STOPRESULT Api_StopHighPrecisionTickGenerator(IntPtr sessionHandle, IntPtr info);
 
+        public abstract TG_STARTRESULT Api_BeginTimerPeriod_Win(out uint period);
+
+        public abstract TG_STOPRESULT Api_EndTimerPeriod_Win(uint period);
+
         #endregion
     }
 }
@@ -19,9 +19,30 @@ namespace Melanchall.DryWetMidi.Multimedia
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         public static extern TG_STARTRESULT StartHighPrecisionTickGenerator_Mac(int interval, IntPtr sessionHandle, TimerCallback_Mac callback, out IntPtr info);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_STARTRESULT StartHighPrecisionTickGenerator_Linux(long intervalInMicroseconds, IntPtr sessionHandle, TimerCallback_Linux callback, out IntPtr info);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_STARTRESULT StartOneShotHighPrecisionTickGenerator_Win(IntPtr sessionHandle, TimerCallback_Win callback, out IntPtr info);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_STARTRESULT StartOneShotHighPrecisionTickGenerator_Mac(IntPtr sessionHandle, TimerCallback_Mac callback, out IntPtr info);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_STARTRESULT StartOneShotHighPrecisionTickGenerator_Linux(IntPtr sessionHandle, TimerCallback_Linux callback, out IntPtr info);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_SCHEDULERESULT ScheduleHighPrecisionTickGeneratorTick(IntPtr sessionHandle, IntPtr info, long delayInMicroseconds);
+
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         public static extern TG_STOPRESULT StopHighPrecisionTickGenerator(IntPtr sessionHandle, IntPtr info);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_STARTRESULT BeginTimerPeriod_Win(out uint period);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        public static extern TG_STOPRESULT EndTimerPeriod_Win(uint period);
+
         #endregion
 
         #region Methods
@@ -36,11 +57,46 @@ namespace Melanchall.DryWetMidi.Multimedia
             return StartHighPrecisionTickGenerator_Mac(interval, sessionHandle, callback, out info);
         }
 
+        public override TG_STARTRESULT Api_StartHighPrecisionTickGenerator_Linux(long intervalInMicroseconds, IntPtr sessionHandle, TimerCallback_Linux callback, out IntPtr info)
+        {
+            return StartHighPrecisionTickGenerator_Linux(intervalInMicroseconds, sessionHandle, callback, out info);
+        }
+
+        public override TG_STARTRESULT Api_StartOneShotHighPrecisionTickGenerator_Win(IntPtr sessionHandle, TimerCallback_Win callback, out IntPtr info)
+        {
+            return StartOneShotHighPrecisionTickGenerator_Win(sessionHandle, callback, out info);
+        }
+
+        public override TG_STARTRESULT Api_StartOneShotHighPrecisionTickGenerator_Mac(IntPtr sessionHandle, TimerCallback_Mac callback, out IntPtr info)
+        {
+            return StartOneShotHighPrecisionTickGenerator_Mac(sessionHandle, callback, out info);
+        }
+
+        public override TG_STARTRESULT Api_StartOneShotHighPrecisionTickGenerator_Linux(IntPtr sessionHandle, TimerCallback_Linux callback, out IntPtr info)
+        {
+            return StartOneShotHighPrecisionTickGenerator_Linux(sessionHandle, callback, out info);
+        }
+
+        public override TG_SCHEDULERESULT Api_ScheduleHighPrecisionTickGeneratorTick(IntPtr sessionHandle, IntPtr info, long delayInMicroseconds)
+        {
+            return ScheduleHighPrecisionTickGeneratorTick(sessionHandle, info, delayInMicroseconds);
+        }
+
         public override TG_STOPRESULT Api_StopHighPrecisionTickGenerator(IntPtr sessionHandle, IntPtr info)
         {
             return StopHighPrecisionTickGenerator(sessionHandle, info);
         }
 
+        public override TG_STARTRESULT Api_BeginTimerPeriod_Win(out uint period)
+        {
+            return BeginTimerPeriod_Win(out period);
+        }
+
+        public override TG_STOPRESULT Api_EndTimerPeriod_Win(uint period)
+        {
+            return EndTimerPeriod_Win(period);
+        }
+
         #endregion
     }
 }
@@ -7,7 +7,8 @@
         public enum API_TYPE
         {
             API_TYPE_WIN = 0,
-            API_TYPE_MAC = 1
+            API_TYPE_MAC = 1,
+            API_TYPE_LINUX = 2
         }
 
         #endregion
@@ -18,6 +19,8 @@
 
         public abstract bool Api_CanCompareDevices();
 
+        public abstract long Api_GetMonotonicTimestamp();
+
         #endregion
     }
 }
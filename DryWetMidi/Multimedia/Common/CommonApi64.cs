@@ -18,6 +18,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern bool CanCompareDevices();
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern long GetMonotonicTimestamp();
+
         #endregion
 
         #region Methods
@@ -32,6 +35,11 @@ namespace Melanchall.DryWetMidi.Multimedia
             return CanCompareDevices();
         }
 
+        public override long Api_GetMonotonicTimestamp()
+        {
+            return GetMonotonicTimestamp();
+        }
+
         #endregion
     }
 }
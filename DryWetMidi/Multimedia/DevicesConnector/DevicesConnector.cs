@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Collections.Generic;
 using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
 
 namespace Melanchall.DryWetMidi.Multimedia
 {
@@ -11,6 +12,13 @@ namespace Melanchall.DryWetMidi.Multimedia
     /// </summary>
     public sealed class DevicesConnector
     {
+        #region Fields
+
+        private DevicesConnectorNativeRoutingSettings _nativeRoutingSettings;
+        private readonly List<int> _nativeRoutesIds = new List<int>();
+
+        #endregion
+
         #region Constructor
 
         /// <summary>
@@ -73,6 +81,32 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         public DevicesConnectorEventCallback EventCallback { get; set; }
 
+        /// <summary>
+        /// Gets or sets settings of native routing. The default value is <c>null</c> which means
+        /// events are redirected by managed code. More info in the
+        /// <see href="xref:a_dev_connector#native-routing">Devices connector: Native routing</see> article.
+        /// </summary>
+        /// <remarks>
+        /// If the property is set, <see cref="Connect"/> instructs the native library to forward
+        /// messages from <see cref="InputDevice"/> to <see cref="OutputDevices"/> right in the
+        /// callback of the input device, so received events are not converted to <see cref="MidiEvent"/>
+        /// and back. Such routing requires <see cref="InputDevice"/> to be an instance of
+        /// <see cref="Multimedia.InputDevice"/> and <see cref="OutputDevices"/> to be instances of
+        /// <see cref="OutputDevice"/>, and <see cref="EventCallback"/> to be <c>null</c>.
+        /// </remarks>
+        /// <exception cref="InvalidOperationException">Devices are connected.</exception>
+        public DevicesConnectorNativeRoutingSettings NativeRoutingSettings
+        {
+            get { return _nativeRoutingSettings; }
+            set
+            {
+                if (AreDevicesConnected)
+                    throw new InvalidOperationException("Native routing settings can't be changed while devices are connected.");
+
+                _nativeRoutingSettings = value;
+            }
+        }
+
         #endregion
 
         #region Methods
@@ -81,12 +115,19 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// Connects <see cref="InputDevice"/> to <see cref="OutputDevices"/> so all events coming from
         /// the input device will be redirected to the output ones.
         /// </summary>
+        /// <exception cref="InvalidOperationException"><see cref="NativeRoutingSettings"/> is set but
+        /// native routing can't be used for the devices or settings.</exception>
+        /// <exception cref="MidiDeviceException">An error occurred on device.</exception>
         public void Connect()
         {
             if (AreDevicesConnected)
                 return;
 
-            InputDevice.EventReceived += OnEventReceived;
+            if (_nativeRoutingSettings != null)
+                AddNativeRoutes();
+            else
+                InputDevice.EventReceived += OnEventReceived;
+
             AreDevicesConnected = true;
         }
 
@@ -98,6 +139,59 @@ namespace Melanchall.DryWetMidi.Multimedia
         {
             AreDevicesConnected = false;
             InputDevice.EventReceived -= OnEventReceived;
+
+            RemoveNativeRoutes();
+        }
+
+        private void AddNativeRoutes()
+        {
+            var inputDevice = InputDevice as InputDevice;
+            if (inputDevice == null)
+                throw new InvalidOperationException($"Native routing requires input device to be an instance of {typeof(InputDevice).Name}.");
+
+            var outputDevices = new List<OutputDevice>();
+
+            foreach (var outputDevice in OutputDevices)
+            {
+                var device = outputDevice as OutputDevice;
+                if (device == null)
+                    throw new InvalidOperationException($"Native routing requires output devices to be instances of {typeof(OutputDevice).Name}.");
+
+                outputDevices.Add(device);
+            }
+
+            if (EventCallback != null)
+                throw new InvalidOperationException("Native routing can't be used along with events callback.");
+
+            var statusesMap = _nativeRoutingSettings.GetStatusesMap();
+            var notesMap = _nativeRoutingSettings.GetNotesMap();
+
+            try
+            {
+                foreach (var outputDevice in outputDevices)
+                {
+                    _nativeRoutesIds.Add(inputDevice.AddThruRoute(outputDevice, statusesMap, notesMap));
+                }
+            }
+            catch
+            {
+                RemoveNativeRoutes();
+                throw;
+            }
+        }
+
+        private void RemoveNativeRoutes()
+        {
+            var inputDevice = InputDevice as InputDevice;
+            if (inputDevice == null)
+                return;
+
+            foreach (var routeId in _nativeRoutesIds)
+            {
+                inputDevice.RemoveThruRoute(routeId);
+            }
+
+            _nativeRoutesIds.Clear();
         }
 
         private void OnEventReceived(object sender, MidiEventReceivedEventArgs e)
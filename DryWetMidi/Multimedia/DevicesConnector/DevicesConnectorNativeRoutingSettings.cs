@@ -0,0 +1,168 @@
+﻿using System;
+using System.Collections.Generic;
+using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    /// <summary>
+    /// Holds settings of native routing used by <see cref="DevicesConnector"/> to redirect events
+    /// from an input device to output ones without managed code involved. More info in the
+    /// <see href="xref:a_dev_connector#native-routing">Devices connector: Native routing</see> article.
+    /// </summary>
+    /// <remarks>
+    /// All filters and transformations are expressed as data which is passed to the native side
+    /// on <see cref="DevicesConnector.Connect"/>, so changes made after devices are connected
+    /// don't affect the connection. Only channel and system common/real-time messages are routed,
+    /// system exclusive ones are not.
+    /// </remarks>
+    public sealed class DevicesConnectorNativeRoutingSettings
+    {
+        #region Constants
+
+        private const int StatusesMapSize = 256;
+        private const byte DroppedNote = 0xFF;
+
+        private static readonly Dictionary<MidiEventType, byte> ChannelEventsStatuses = new Dictionary<MidiEventType, byte>
+        {
+            [MidiEventType.NoteOff] = EventStatusBytes.Channel.NoteOff,
+            [MidiEventType.NoteOn] = EventStatusBytes.Channel.NoteOn,
+            [MidiEventType.NoteAftertouch] = EventStatusBytes.Channel.NoteAftertouch,
+            [MidiEventType.ControlChange] = EventStatusBytes.Channel.ControlChange,
+            [MidiEventType.ProgramChange] = EventStatusBytes.Channel.ProgramChange,
+            [MidiEventType.ChannelAftertouch] = EventStatusBytes.Channel.ChannelAftertouch,
+            [MidiEventType.PitchBend] = EventStatusBytes.Channel.PitchBend
+        };
+
+        private static readonly Dictionary<MidiEventType, byte> SystemEventsStatuses = new Dictionary<MidiEventType, byte>
+        {
+            [MidiEventType.MidiTimeCode] = EventStatusBytes.SystemCommon.MtcQuarterFrame,
+            [MidiEventType.SongPositionPointer] = EventStatusBytes.SystemCommon.SongPositionPointer,
+            [MidiEventType.SongSelect] = EventStatusBytes.SystemCommon.SongSelect,
+            [MidiEventType.TuneRequest] = EventStatusBytes.SystemCommon.TuneRequest,
+            [MidiEventType.TimingClock] = EventStatusBytes.SystemRealTime.TimingClock,
+            [MidiEventType.Start] = EventStatusBytes.SystemRealTime.Start,
+            [MidiEventType.Continue] = EventStatusBytes.SystemRealTime.Continue,
+            [MidiEventType.Stop] = EventStatusBytes.SystemRealTime.Stop,
+            [MidiEventType.ActiveSensing] = EventStatusBytes.SystemRealTime.ActiveSensing,
+            [MidiEventType.Reset] = EventStatusBytes.SystemRealTime.Reset
+        };
+
+        #endregion
+
+        #region Properties
+
+        /// <summary>
+        /// Gets or sets channels which channel events should be routed for. The default value is
+        /// <c>null</c> which means events of all channels will be routed.
+        /// </summary>
+        public ICollection<FourBitNumber> Channels { get; set; }
+
+        /// <summary>
+        /// Gets or sets types of events to route. The default value is <c>null</c> which means
+        /// all channel and system common/real-time events will be routed.
+        /// </summary>
+        /// <remarks>
+        /// Only types of channel, system common and system real-time events can be specified.
+        /// An unsupported type will cause <see cref="DevicesConnector.Connect"/> to
+        /// throw <see cref="InvalidOperationException"/>.
+        /// </remarks>
+        public ICollection<MidiEventType> EventTypes { get; set; }
+
+        /// <summary>
+        /// Gets or sets mapping of channels of incoming channel events to channels of events sent
+        /// to output devices. Channels not presented in the mapping are left unchanged. The default
+        /// value is <c>null</c> which means channels are not changed.
+        /// </summary>
+        /// <remarks>
+        /// <see cref="Channels"/> filter is applied to channels of incoming events, i.e. before
+        /// the mapping.
+        /// </remarks>
+        public IDictionary<FourBitNumber, FourBitNumber> ChannelsMapping { get; set; }
+
+        /// <summary>
+        /// Gets or sets mapping of note numbers of incoming Note On, Note Off and Note Aftertouch
+        /// events to note numbers of events sent to output devices. Note numbers not presented in
+        /// the mapping are left unchanged. The default value is <c>null</c> which means note numbers
+        /// are not remapped.
+        /// </summary>
+        public IDictionary<SevenBitNumber, SevenBitNumber> NotesMapping { get; set; }
+
+        /// <summary>
+        /// Gets or sets the number of semitones to transpose Note On, Note Off and Note Aftertouch
+        /// events by. The value is applied after <see cref="NotesMapping"/>. Events whose note number
+        /// gets out of the [0; 127] range are not sent. The default value is 0.
+        /// </summary>
+        public int Transpose { get; set; }
+
+        #endregion
+
+        #region Methods
+
+        internal byte[] GetStatusesMap()
+        {
+            if (EventTypes != null)
+            {
+                foreach (var eventType in EventTypes)
+                {
+                    if (!ChannelEventsStatuses.ContainsKey(eventType) && !SystemEventsStatuses.ContainsKey(eventType))
+                        throw new InvalidOperationException($"Events of {eventType} type can't be routed natively.");
+                }
+            }
+
+            var statusesMap = new byte[StatusesMapSize];
+
+            foreach (var eventTypeStatus in ChannelEventsStatuses)
+            {
+                if (!IsEventTypeRouted(eventTypeStatus.Key))
+                    continue;
+
+                foreach (var channel in FourBitNumber.Values)
+                {
+                    if (Channels != null && !Channels.Contains(channel))
+                        continue;
+
+                    FourBitNumber outputChannel;
+                    if (ChannelsMapping == null || !ChannelsMapping.TryGetValue(channel, out outputChannel))
+                        outputChannel = channel;
+
+                    statusesMap[(eventTypeStatus.Value << 4) | channel] = (byte)((eventTypeStatus.Value << 4) | outputChannel);
+                }
+            }
+
+            foreach (var eventTypeStatus in SystemEventsStatuses)
+            {
+                if (IsEventTypeRouted(eventTypeStatus.Key))
+                    statusesMap[eventTypeStatus.Value] = eventTypeStatus.Value;
+            }
+
+            return statusesMap;
+        }
+
+        internal byte[] GetNotesMap()
+        {
+            var notesMap = new byte[SevenBitNumber.Values.Length];
+
+            foreach (var noteNumber in SevenBitNumber.Values)
+            {
+                SevenBitNumber outputNoteNumber;
+                if (NotesMapping == null || !NotesMapping.TryGetValue(noteNumber, out outputNoteNumber))
+                    outputNoteNumber = noteNumber;
+
+                var transposedNoteNumber = outputNoteNumber + Transpose;
+                notesMap[noteNumber] = transposedNoteNumber >= SevenBitNumber.MinValue && transposedNoteNumber <= SevenBitNumber.MaxValue
+                    ? (byte)transposedNoteNumber
+                    : DroppedNote;
+            }
+
+            return notesMap;
+        }
+
+        private bool IsEventTypeRouted(MidiEventType eventType)
+        {
+            return EventTypes == null || EventTypes.Contains(eventType);
+        }
+
+        #endregion
+    }
+}
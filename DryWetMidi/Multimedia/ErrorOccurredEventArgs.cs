@@ -3,7 +3,7 @@
 namespace Melanchall.DryWetMidi.Multimedia
 {
     /// <summary>
-    /// Provides data for an event indicating an error occurred on a device.
+    /// Provides data for an event indicating an error occurred on a device or in a playback scheduler.
     /// </summary>
     public sealed class ErrorOccurredEventArgs : EventArgs
     {
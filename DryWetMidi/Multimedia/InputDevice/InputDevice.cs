@@ -4,6 +4,7 @@ using System.ComponentModel;
 using System.IO;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Melanchall.DryWetMidi.Common;
 using Melanchall.DryWetMidi.Core;
 
@@ -66,7 +67,17 @@ namespace Melanchall.DryWetMidi.Multimedia
         #region Constants
 
         private const int SysExBufferSize = 2048;
+        private const int DefaultReceivingBufferSize = 64 * 1024;
+        private const int MinReceivingBufferSize = 1024;
+        private const int MaxReceivingBufferSize = 64 * 1024 * 1024;
+        private const int BufferRecordHeaderSize = 16;
+        private const int BufferRecordAlignment = 8;
+        private const int InvalidShortEventRecordFlag = 1;
+        private const int InvalidSysExEventRecordFlag = 2;
+        private const int InfiniteTimeout = -1;
         private const int ChannelParametersBufferSize = 2;
+        private const int PacketsBufferSize = 16;
+        private static readonly byte[] SysExStatusByteBuffer = { EventStatusBytes.Global.NormalSysEx };
         private static readonly int MidiTimeCodeComponentsCount = Enum.GetValues(typeof(MidiTimeCodeComponent)).Length;
 
         #endregion
@@ -96,11 +107,23 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private InputDeviceApi.Callback_Win _callback_Win;
         private InputDeviceApi.Callback_Mac _callback_Mac;
+        private InputDeviceApi.Callback_Linux _callback_Linux;
 
         private readonly byte[] _channelParametersBuffer = new byte[ChannelParametersBufferSize];
 
         private readonly Dictionary<MidiTimeCodeComponent, FourBitNumber> _midiTimeCodeComponents = new Dictionary<MidiTimeCodeComponent, FourBitNumber>();
-        private readonly List<byte[]> _sysExParts = new List<byte[]>();
+
+        private byte[] _messageBuffer;
+        private byte[] _sysExBuffer;
+        private int _sysExLength;
+        private bool _isSysExInProgress;
+        private long _sysExTimestamp;
+
+        private long _messageTimestamp;
+
+        private int[] _packetsOffsets = new int[PacketsBufferSize];
+        private int[] _packetsLengths = new int[PacketsBufferSize];
+        private long[] _packetsTimestamps = new long[PacketsBufferSize];
 
         private readonly CommonApi.API_TYPE _apiType;
         private readonly int _hashCode;
@@ -108,6 +131,15 @@ namespace Melanchall.DryWetMidi.Multimedia
         private readonly IntPtr _info = IntPtr.Zero;
         private InputDeviceHandle _handle = null;
 
+        private InputDeviceReceivingMode _receivingMode = InputDeviceReceivingMode.Direct;
+        private int _receivingBufferSize = DefaultReceivingBufferSize;
+        private byte[] _receivingBuffer;
+        private readonly object _receivingBufferLock = new object();
+        private readonly Queue<MidiEvent> _readEvents = new Queue<MidiEvent>();
+
+        private Thread _dispatchThread;
+        private volatile bool _stopDispatchThread;
+
         #endregion
 
         #region Constructor
@@ -208,6 +240,80 @@ namespace Melanchall.DryWetMidi.Multimedia
             }
         }
 
+        /// <summary>
+        /// Gets or sets a value defining how incoming MIDI data is taken from the native side.
+        /// The default is <see cref="InputDeviceReceivingMode.Direct"/>.
+        /// </summary>
+        /// <remarks>
+        /// The property can be changed only before the first call of <see cref="StartEventsListening"/>. See
+        /// <see cref="InputDeviceReceivingMode"/> to learn more about available modes.
+        /// </remarks>
+        /// <exception cref="InvalidEnumArgumentException"><paramref name="value"/> specified an invalid value.</exception>
+        /// <exception cref="InvalidOperationException">The device has already started listening for events.</exception>
+        public InputDeviceReceivingMode ReceivingMode
+        {
+            get { return _receivingMode; }
+            set
+            {
+                ThrowIfArgument.IsInvalidEnumValue(nameof(value), value);
+
+                if (_receivingMode == value)
+                    return;
+
+                EnsureReceivingSettingsCanBeChanged();
+                _receivingMode = value;
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets the size (in bytes) of the native ring buffer used to pass incoming MIDI data
+        /// to the managed code if <see cref="ReceivingMode"/> is other than <see cref="InputDeviceReceivingMode.Direct"/>.
+        /// The default is 65536.
+        /// </summary>
+        /// <remarks>
+        /// The actual size of the buffer is the value rounded up to the nearest power of two. Every message takes
+        /// its length plus 16 bytes rounded up to the multiple of 8. Messages which don't fit into the
+        /// buffer are dropped and counted by <see cref="BufferOverflowsCount"/>. The property can be changed
+        /// only before the first call of <see cref="StartEventsListening"/>.
+        /// </remarks>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="value"/> is less than 1024 or
+        /// greater than 67108864.</exception>
+        /// <exception cref="InvalidOperationException">The device has already started listening for events.</exception>
+        public int ReceivingBufferSize
+        {
+            get { return _receivingBufferSize; }
+            set
+            {
+                ThrowIfArgument.IsOutOfRange(
+                    nameof(value),
+                    value,
+                    MinReceivingBufferSize,
+                    MaxReceivingBufferSize,
+                    $"Buffer size is out of [{MinReceivingBufferSize}; {MaxReceivingBufferSize}] range.");
+
+                if (_receivingBufferSize == value)
+                    return;
+
+                EnsureReceivingSettingsCanBeChanged();
+                _receivingBufferSize = value;
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of incoming messages dropped because the native ring buffer (see <see cref="ReceivingBufferSize"/>) was full. The value is
+        /// always zero if <see cref="ReceivingMode"/> is <see cref="InputDeviceReceivingMode.Direct"/>.
+        /// </summary>
+        public long BufferOverflowsCount
+        {
+            get
+            {
+                var handle = _handle;
+                return handle == null || handle.IsClosed || _receivingMode == InputDeviceReceivingMode.Direct
+                    ? 0
+                    : InputDeviceApiProvider.Api.Api_GetBufferOverflowsCount(handle.DeviceHandle);
+            }
+        }
+
         #endregion
 
         #region Methods
@@ -229,9 +335,112 @@ namespace Melanchall.DryWetMidi.Multimedia
             EnsureSessionIsCreated();
             EnsureHandleIsCreated();
 
+            if (_receivingMode != InputDeviceReceivingMode.Direct)
+                DiscardReceivingBuffer();
+
             NativeApiUtilities.HandleDevicesNativeApiResult(
                 InputDeviceApiProvider.Api.Api_Connect(_handle.DeviceHandle));
             IsListeningForEvents = true;
+
+            if (_receivingMode == InputDeviceReceivingMode.DispatchThread)
+                StartDispatchThread();
+        }
+
+        /// <summary>
+        /// Reads MIDI events received by the device to the specified array. The method can be used only
+        /// if <see cref="ReceivingMode"/> is set to <see cref="InputDeviceReceivingMode.Polling"/>.
+        /// </summary>
+        /// <remarks>
+        /// All messages accumulated in the native ring buffer are taken by a single call to the native side,
+        /// so the method is intended to be called periodically (for example, on every frame update) to take
+        /// events in batches. Events which don't fit into the <paramref name="events"/> are kept and returned by
+        /// subsequent calls.
+        /// </remarks>
+        /// <param name="events">The array to put received events to.</param>
+        /// <param name="index">The index within <paramref name="events"/> to start putting events at.</param>
+        /// <param name="count">The maximum number of events to read.</param>
+        /// <returns>The number of events put to <paramref name="events"/>.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="events"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><paramref name="index"/> is out of range of <paramref name="events"/>.</description>
+        /// </item>
+        /// <item>
+        /// <description><paramref name="count"/> is negative or exceeds the number of elements
+        /// from <paramref name="index"/> to the end of <paramref name="events"/>.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        /// <exception cref="ObjectDisposedException">The current <see cref="InputDevice"/> is disposed.</exception>
+        /// <exception cref="MidiDeviceException">An error occurred on device.</exception>
+        /// <exception cref="InvalidOperationException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><see cref="ReceivingMode"/> is not <see cref="InputDeviceReceivingMode.Polling"/>.</description>
+        /// </item>
+        /// <item>
+        /// <description>The current <see cref="InputDevice"/> instance is created by
+        /// <see cref="DevicesWatcher.DeviceRemoved"/> event and thus considered as removed so you cannot interact with it.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        public int ReadEvents(MidiEvent[] events, int index, int count)
+        {
+            ThrowIfArgument.IsNull(nameof(events), events);
+            ThrowIfArgument.IsOutOfRange(nameof(index), index, 0, events.Length, "Index is out of range of the array.");
+            ThrowIfArgument.IsOutOfRange(nameof(count), count, 0, events.Length - index, "Count is negative or exceeds the array's bounds.");
+
+            EnsureDeviceIsNotDisposed();
+            EnsureDeviceIsNotRemoved();
+
+            if (_receivingMode != InputDeviceReceivingMode.Polling)
+                throw new InvalidOperationException($"Events can be read only in {InputDeviceReceivingMode.Polling} receiving mode.");
+
+            lock (_receivingBufferLock)
+            {
+                if (_readEvents.Count < count && IsListeningForEvents)
+                    ReadReceivingBuffer();
+
+                var eventsCount = 0;
+
+                while (eventsCount < count && _readEvents.Count > 0)
+                {
+                    events[index + eventsCount++] = _readEvents.Dequeue();
+                }
+
+                return eventsCount;
+            }
+        }
+
+        /// <summary>
+        /// Reads MIDI events received by the device to the specified array. The method can be used only
+        /// if <see cref="ReceivingMode"/> is set to <see cref="InputDeviceReceivingMode.Polling"/>.
+        /// </summary>
+        /// <param name="events">The array to put received events to.</param>
+        /// <returns>The number of events put to <paramref name="events"/>.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="events"/> is <c>null</c>.</exception>
+        /// <exception cref="ObjectDisposedException">The current <see cref="InputDevice"/> is disposed.</exception>
+        /// <exception cref="MidiDeviceException">An error occurred on device.</exception>
+        /// <exception cref="InvalidOperationException">
+        /// <para>One of the following errors occurred:</para>
+        /// <list type="bullet">
+        /// <item>
+        /// <description><see cref="ReceivingMode"/> is not <see cref="InputDeviceReceivingMode.Polling"/>.</description>
+        /// </item>
+        /// <item>
+        /// <description>The current <see cref="InputDevice"/> instance is created by
+        /// <see cref="DevicesWatcher.DeviceRemoved"/> event and thus considered as removed so you cannot interact with it.</description>
+        /// </item>
+        /// </list>
+        /// </exception>
+        public int ReadEvents(MidiEvent[] events)
+        {
+            ThrowIfArgument.IsNull(nameof(events), events);
+
+            return ReadEvents(events, 0, events.Length);
         }
 
         /// <summary>
@@ -449,6 +658,32 @@ namespace Melanchall.DryWetMidi.Multimedia
             return device;
         }
 
+        internal int AddThruRoute(OutputDevice outputDevice, byte[] statusesMap, byte[] notesMap)
+        {
+            EnsureDeviceIsNotDisposed();
+            EnsureDeviceIsNotRemoved();
+            EnsureSessionIsCreated();
+            EnsureHandleIsCreated();
+
+            var outputHandle = outputDevice.GetDeviceHandle();
+
+            int routeId;
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                InputDeviceApiProvider.Api.Api_AddThruRoute(_handle.DeviceHandle, outputHandle, statusesMap, notesMap, out routeId));
+
+            return routeId;
+        }
+
+        internal void RemoveThruRoute(int routeId)
+        {
+            // Routes are removed on the native side when either device is closed
+            // so there is nothing to remove for a disposed device
+            if (_disposed)
+                return;
+
+            InputDeviceApiProvider.Api.Api_RemoveThruRoute(routeId);
+        }
+
         private static IEnumerable<InputDevice> GetAllLazy()
         {
             var devicesCount = GetDevicesCount();
@@ -461,7 +696,15 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private void OnEventReceived(MidiEvent midiEvent)
         {
-            EventReceived?.Invoke(this, new MidiEventReceivedEventArgs(midiEvent));
+            OnEventReceived(midiEvent, _messageTimestamp);
+        }
+
+        private void OnEventReceived(MidiEvent midiEvent, long timestamp)
+        {
+            if (_receivingMode == InputDeviceReceivingMode.Polling)
+                _readEvents.Enqueue(midiEvent);
+            else
+                EventReceived?.Invoke(this, new MidiEventReceivedEventArgs(midiEvent, timestamp));
 
             if (RaiseMidiTimeCodeReceived)
             {
@@ -482,6 +725,19 @@ namespace Melanchall.DryWetMidi.Multimedia
                 return;
 
             var sessionHandle = MidiDevicesSession.GetSessionHandle();
+            var deviceHandle = _receivingMode == InputDeviceReceivingMode.Direct
+                ? OpenDevice(sessionHandle)
+                : OpenDeviceBuffered(sessionHandle);
+
+#if TEST
+            _handle = new InputDeviceHandle(deviceHandle, TestCheckpoints);
+#else
+            _handle = new InputDeviceHandle(deviceHandle);
+#endif
+        }
+
+        private IntPtr OpenDevice(IntPtr sessionHandle)
+        {
             var deviceHandle = IntPtr.Zero;
 
             switch (_apiType)
@@ -500,21 +756,178 @@ namespace Melanchall.DryWetMidi.Multimedia
                             InputDeviceApiProvider.Api.Api_OpenDevice_Mac(_info, sessionHandle, _callback_Mac, out deviceHandle));
                     }
                     break;
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
+                    {
+                        _callback_Linux = OnMessage_Linux;
+                        NativeApiUtilities.HandleDevicesNativeApiResult(
+                            InputDeviceApiProvider.Api.Api_OpenDevice_Linux(_info, sessionHandle, _callback_Linux, out deviceHandle));
+                    }
+                    break;
                 default:
                     throw new NotSupportedException($"{_apiType} API is not supported.");
             }
 
-#if TEST
-            _handle = new InputDeviceHandle(deviceHandle, TestCheckpoints);
-#else
-            _handle = new InputDeviceHandle(deviceHandle);
-#endif
+            return deviceHandle;
+        }
+
+        private IntPtr OpenDeviceBuffered(IntPtr sessionHandle)
+        {
+            var deviceHandle = IntPtr.Zero;
+
+            switch (_apiType)
+            {
+                case CommonApi.API_TYPE.API_TYPE_WIN:
+                    NativeApiUtilities.HandleDevicesNativeApiResult(
+                        InputDeviceApiProvider.Api.Api_OpenDeviceBuffered_Win(_info, sessionHandle, SysExBufferSize, _receivingBufferSize, out deviceHandle));
+                    break;
+                case CommonApi.API_TYPE.API_TYPE_MAC:
+                    NativeApiUtilities.HandleDevicesNativeApiResult(
+                        InputDeviceApiProvider.Api.Api_OpenDeviceBuffered_Mac(_info, sessionHandle, _receivingBufferSize, out deviceHandle));
+                    break;
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
+                    NativeApiUtilities.HandleDevicesNativeApiResult(
+                        InputDeviceApiProvider.Api.Api_OpenDeviceBuffered_Linux(_info, sessionHandle, _receivingBufferSize, out deviceHandle));
+                    break;
+                default:
+                    throw new NotSupportedException($"{_apiType} API is not supported.");
+            }
+
+            // Native buffer capacity is the requested size rounded up to a power of two,
+            // so a managed buffer of the same capacity can take any record
+            var capacity = MinReceivingBufferSize;
+            while (capacity < _receivingBufferSize)
+            {
+                capacity <<= 1;
+            }
+
+            _receivingBuffer = new byte[capacity];
+            return deviceHandle;
+        }
+
+        private void EnsureReceivingSettingsCanBeChanged()
+        {
+            // Native handle is opened for specific receiving settings and owns device info
+            // so it can't be reopened
+            if (_handle != null)
+                throw new InvalidOperationException("Receiving settings can't be changed after the device has started listening for events.");
+        }
+
+        private void StartDispatchThread()
+        {
+            _stopDispatchThread = false;
+            _dispatchThread = new Thread(DispatchEvents)
+            {
+                Name = "DryWetMIDI input device dispatcher",
+                IsBackground = true
+            };
+            _dispatchThread.Start(_handle.DeviceHandle);
+        }
+
+        private void StopDispatchThread()
+        {
+            var dispatchThread = _dispatchThread;
+            if (dispatchThread == null)
+                return;
+
+            _dispatchThread = null;
+            _stopDispatchThread = true;
+            InputDeviceApiProvider.Api.Api_InterruptBufferWaiting(_handle.DeviceHandle);
+
+            // Stopping can be requested from an EventReceived handler, i.e. on the dispatch thread itself
+            if (Thread.CurrentThread != dispatchThread)
+                dispatchThread.Join();
+        }
+
+        private void DispatchEvents(object deviceHandle)
+        {
+            var handle = (IntPtr)deviceHandle;
+
+            while (!_stopDispatchThread)
+            {
+                try
+                {
+                    var waitResult = InputDeviceApiProvider.Api.Api_WaitForBuffer(handle, InfiniteTimeout);
+                    if (waitResult == InputDeviceApi.IN_WAITBUFFERRESULT.IN_WAITBUFFERRESULT_TIMEOUT)
+                        continue;
+
+                    NativeApiUtilities.HandleDevicesNativeApiResult(waitResult);
+                    if (_stopDispatchThread)
+                        break;
+
+                    lock (_receivingBufferLock)
+                    {
+                        ReadReceivingBuffer(handle);
+                    }
+                }
+                catch (Exception ex)
+                {
+                    OnError(new MidiDeviceException("Failed to dispatch received data.", ex));
+                    break;
+                }
+            }
+        }
+
+        private void DiscardReceivingBuffer()
+        {
+            lock (_receivingBufferLock)
+            {
+                _readEvents.Clear();
+
+                int bytesRead;
+                NativeApiUtilities.HandleDevicesNativeApiResult(
+                    InputDeviceApiProvider.Api.Api_ReadBuffer(_handle.DeviceHandle, _receivingBuffer, _receivingBuffer.Length, out bytesRead));
+            }
+        }
+
+        private void ReadReceivingBuffer()
+        {
+            ReadReceivingBuffer(_handle.DeviceHandle);
+        }
+
+        private void ReadReceivingBuffer(IntPtr deviceHandle)
+        {
+            int bytesRead;
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                InputDeviceApiProvider.Api.Api_ReadBuffer(deviceHandle, _receivingBuffer, _receivingBuffer.Length, out bytesRead));
+
+            var position = 0;
+
+            while (position < bytesRead)
+            {
+                var timestamp = BitConverter.ToInt64(_receivingBuffer, position);
+                var length = BitConverter.ToInt32(_receivingBuffer, position + 8);
+                var flags = BitConverter.ToInt32(_receivingBuffer, position + 12);
+                var dataOffset = position + BufferRecordHeaderSize;
+
+                position += (BufferRecordHeaderSize + length + BufferRecordAlignment - 1) & ~(BufferRecordAlignment - 1);
+
+                if (!IsEnabled || length == 0)
+                    continue;
+
+                _messageTimestamp = timestamp;
+
+                if ((flags & InvalidShortEventRecordFlag) != 0)
+                    OnInvalidShortEvent(BitConverter.ToInt32(_receivingBuffer, dataOffset));
+                else if ((flags & InvalidSysExEventRecordFlag) != 0)
+                    OnInvalidSysExEvent(GetDataCopy(_receivingBuffer, dataOffset, length));
+                else
+                    OnData(_receivingBuffer, dataOffset, length);
+            }
         }
 
         private void OnMessage_Win(IntPtr hMidi, NativeApi.MidiMessage wMsg, IntPtr dwInstance, IntPtr dwParam1, IntPtr dwParam2)
         {
             if (!IsListeningForEvents || !IsEnabled)
+            {
+                // Ignored SysEx buffers still must be handed back to the driver,
+                // otherwise SysEx receiving stalls once all of them are filled
+                if (wMsg == NativeApi.MidiMessage.MIM_LONGDATA || wMsg == NativeApi.MidiMessage.MIM_LONGERROR)
+                    TryRenewSysExBuffer(dwParam1);
+
                 return;
+            }
+
+            _messageTimestamp = GetMessageTimestamp_Win(dwParam2);
 
             switch (wMsg)
             {
@@ -538,6 +951,16 @@ namespace Melanchall.DryWetMidi.Multimedia
         }
 
         private void OnMessage_Mac(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon)
+        {
+            OnPacketList(pktlist);
+        }
+
+        private void OnMessage_Linux(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon)
+        {
+            OnPacketList(pktlist);
+        }
+
+        private void OnPacketList(IntPtr pktlist)
         {
             if (!IsListeningForEvents || !IsEnabled)
                 return;
@@ -546,97 +969,153 @@ namespace Melanchall.DryWetMidi.Multimedia
             TestCheckpoints?.SetCheckpointReached(InputDeviceCheckpointsNames.MessageDataReceived, null);
 #endif
 
-            int packetsCount = 1;
+            var packetsCount = 0;
 
-            for (var i = 0; i < packetsCount; i++)
+            try
             {
-                OnPacket_Mac(pktlist, i, out packetsCount);
-            }
-        }
+                var dataSize = 0;
 
-        private void OnPacket_Mac(IntPtr pktlist, int packetIndex, out int packetsCount)
-        {
-            packetsCount = 0;
-            byte[] data = null;
+                // Native side walks the packet list once filling offsets, lengths and timestamps
+                // of all packets, so the list costs single interop call and single copying
+                var result = GetEventsData(pktlist, out packetsCount, out dataSize);
+                if (result == InputDeviceApi.IN_GETEVENTDATARESULT.IN_GETEVENTDATARESULT_BUFFERTOOSMALL)
+                {
+                    var packetsBufferSize = Math.Max(packetsCount, _packetsOffsets.Length * 2);
+                    _packetsOffsets = new int[packetsBufferSize];
+                    _packetsLengths = new int[packetsBufferSize];
+                    _packetsTimestamps = new long[packetsBufferSize];
 
-            try
-            {
-                IntPtr dataPtr;
-                int length;
+                    result = GetEventsData(pktlist, out packetsCount, out dataSize);
+                }
 
-                NativeApiUtilities.HandleDevicesNativeApiResult(
-                    InputDeviceApiProvider.Api.Api_GetEventData(pktlist, packetIndex, out dataPtr, out length, out packetsCount));
+                NativeApiUtilities.HandleDevicesNativeApiResult(result);
 
-                data = new byte[length];
-                Marshal.Copy(dataPtr, data, 0, length);
+                _messageBuffer = EnsureBufferCapacity(_messageBuffer, dataSize, 0);
+                Marshal.Copy(pktlist, _messageBuffer, 0, dataSize);
+            }
+            catch (Exception ex)
+            {
+                OnError(new MidiDeviceException("Failed to parse message.", ex));
+                return;
+            }
+
+            for (var i = 0; i < packetsCount; i++)
+            {
+                var offset = _packetsOffsets[i];
+                var length = _packetsLengths[i];
+                _messageTimestamp = _packetsTimestamps[i];
 
 #if TEST
-                TestCheckpoints?.SetCheckpointReached(InputDeviceCheckpointsNames.MessageDataReceived, data);
+                TestCheckpoints?.SetCheckpointReached(InputDeviceCheckpointsNames.MessageDataReceived, GetDataCopy(_messageBuffer, offset, length));
 #endif
 
-                if (data[0] == EventStatusBytes.Global.NormalSysEx)
+                OnData(_messageBuffer, offset, length);
+            }
+        }
+
+        private InputDeviceApi.IN_GETEVENTDATARESULT GetEventsData(IntPtr pktlist, out int packetsCount, out int dataSize)
+        {
+            return InputDeviceApiProvider.Api.Api_GetEventsData(
+                pktlist,
+                _packetsOffsets.Length,
+                _packetsOffsets,
+                _packetsLengths,
+                _packetsTimestamps,
+                out packetsCount,
+                out dataSize);
+        }
+
+        private void OnData(byte[] data, int offset, int length)
+        {
+            try
+            {
+                if (data[offset] == EventStatusBytes.Global.NormalSysEx)
                 {
-                    HandleSysExStartPart(data);
+                    HandleSysExStartPart(data, offset, length);
                     return;
                 }
-                else if (_sysExParts.Any())
+                else if (_isSysExInProgress)
                 {
-                    HandleSysExSubsequentPart(data);
+                    HandleSysExSubsequentPart(data, offset, length);
                     return;
                 }
 
-                HandleEvents(data);
+                HandleEvents(data, offset, length);
             }
             catch (Exception ex)
             {
                 var exception = new MidiDeviceException("Failed to parse message.", ex);
-                exception.Data.Add("Data", data);
+                exception.Data.Add("Data", GetDataCopy(data, offset, length));
                 OnError(exception);
             }
         }
 
-        private void HandleSysExStartPart(byte[] data)
+        private static byte[] GetDataCopy(byte[] data, int offset, int length)
+        {
+            var result = new byte[length];
+            Buffer.BlockCopy(data, offset, result, 0, length);
+            return result;
+        }
+
+        private static byte[] EnsureBufferCapacity(byte[] buffer, int capacity, int usedLength)
+        {
+            if (buffer != null && buffer.Length >= capacity)
+                return buffer;
+
+            var newBuffer = new byte[Math.Max(Math.Max(capacity, SysExBufferSize), buffer != null ? buffer.Length * 2 : 0)];
+            if (usedLength > 0)
+                Buffer.BlockCopy(buffer, 0, newBuffer, 0, usedLength);
+
+            return newBuffer;
+        }
+
+        private void AppendSysExPart(byte[] data, int offset, int length)
         {
-            var sysExData = new byte[data.Length - 1];
-            Buffer.BlockCopy(data, 1, sysExData, 0, sysExData.Length);
+            // Assembled event is stamped with the time its first part was received
+            if (!_isSysExInProgress)
+                _sysExTimestamp = _messageTimestamp;
 
-            if (data[data.Length - 1] == SysExEvent.EndOfEventByte || !WaitForCompleteSysExEvent)
+            _sysExBuffer = EnsureBufferCapacity(_sysExBuffer, _sysExLength + length, _sysExLength);
+            Buffer.BlockCopy(data, offset, _sysExBuffer, _sysExLength, length);
+
+            _sysExLength += length;
+            _isSysExInProgress = true;
+        }
+
+        private void HandleSysExStartPart(byte[] data, int offset, int length)
+        {
+            if (data[offset + length - 1] == SysExEvent.EndOfEventByte || !WaitForCompleteSysExEvent)
             {
-                var midiEvent = new NormalSysExEvent(sysExData);
+                var midiEvent = new NormalSysExEvent(GetDataCopy(data, offset + 1, length - 1));
                 OnEventReceived(midiEvent);
             }
             else
-                _sysExParts.Add(sysExData);
+                AppendSysExPart(data, offset + 1, length - 1);
         }
 
-        private void HandleSysExSubsequentPart(byte[] data)
+        private void HandleSysExSubsequentPart(byte[] data, int offset, int length)
         {
-            _sysExParts.Add(data);
+            // Parts are accumulated in the buffer reused between events so the only
+            // allocation per event is the data of the resulting event
+            AppendSysExPart(data, offset, length);
 
-            if (data[data.Length - 1] == SysExEvent.EndOfEventByte)
+            if (data[offset + length - 1] == SysExEvent.EndOfEventByte)
             {
-                var sysExData = new byte[_sysExParts.Sum(p => p.Length)];
-                var i = 0;
+                var sysExData = GetDataCopy(_sysExBuffer, 0, _sysExLength);
 
-                foreach (var p in _sysExParts)
-                {
-                    Buffer.BlockCopy(p, 0, sysExData, i, p.Length);
-                    i += p.Length;
-                }
-
-                _sysExParts.Clear();
+                _sysExLength = 0;
+                _isSysExInProgress = false;
 
                 var midiEvent = new NormalSysExEvent(sysExData);
-                OnEventReceived(midiEvent);
+                OnEventReceived(midiEvent, _sysExTimestamp);
             }
         }
 
-        private void HandleEvents(byte[] data)
+        private void HandleEvents(byte[] data, int offset, int length)
         {
             byte? runningStatusByte = null;
-            var length = data.Length;
 
-            using (var stream = new MemoryStream(data))
+            using (var stream = new MemoryStream(data, offset, length, false))
             using (var midiReader = new MidiReader(stream, new ReaderSettings()))
             {
                 midiReader.Position = 0;
@@ -665,10 +1144,8 @@ namespace Melanchall.DryWetMidi.Multimedia
                             OnEventReceived(midiEvent);
                         else
                         {
-                            var buffer = new byte[sysExEvent.Data.Length + 1];
-                            buffer[0] = statusByte;
-                            Buffer.BlockCopy(sysExEvent.Data, 0, buffer, 1, sysExEvent.Data.Length);
-                            _sysExParts.Add(buffer);
+                            AppendSysExPart(SysExStatusByteBuffer, 0, SysExStatusByteBuffer.Length);
+                            AppendSysExPart(sysExEvent.Data, 0, sysExEvent.Data.Length);
                         }
                     }
                     else
@@ -698,6 +1175,12 @@ namespace Melanchall.DryWetMidi.Multimedia
             var data = new byte[size];
             Marshal.Copy(dataPointer, data, 0, size);
 
+            RenewSysExBuffer(headerPointer);
+            OnInvalidSysExEvent(data);
+        }
+
+        private void OnInvalidSysExEvent(byte[] data)
+        {
             var exception = new MidiDeviceException("Invalid system exclusive event received.");
             exception.Data.Add("Data", data);
             OnError(exception);
@@ -725,42 +1208,76 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private void OnSysExMessage(IntPtr sysExHeaderPointer)
         {
-            byte[] data = null;
+            var size = 0;
 
             try
             {
                 IntPtr dataPointer;
-                int size;
 
                 NativeApiUtilities.HandleDevicesNativeApiResult(
                     InputDeviceApiProvider.Api.Api_GetSysExBufferData(sysExHeaderPointer, out dataPointer, out size));
 
+                // Empty buffers come back from the driver on reset, for example, and still must be
+                // handed back to it, otherwise the buffer is lost for further SysEx messages
+                // (renewing is skipped by the native side if the device is being closed)
                 if (size <= 0)
+                {
+                    RenewSysExBuffer(sysExHeaderPointer);
                     return;
+                }
 
-                data = new byte[size];
-                Marshal.Copy(dataPointer, data, 0, data.Length);
+                _messageBuffer = EnsureBufferCapacity(_messageBuffer, size, 0);
+                Marshal.Copy(dataPointer, _messageBuffer, 0, size);
+
+                // Data is copied so the buffer can be handed back to the driver
+                // before the data is processed
+                RenewSysExBuffer(sysExHeaderPointer);
 
 #if TEST
-                TestCheckpoints?.SetCheckpointReached(InputDeviceCheckpointsNames.MessageDataReceived, data);
+                TestCheckpoints?.SetCheckpointReached(InputDeviceCheckpointsNames.MessageDataReceived, GetDataCopy(_messageBuffer, 0, size));
 #endif
 
-                if (data[0] == EventStatusBytes.Global.NormalSysEx)
-                    HandleSysExStartPart(data);
-                else if (_sysExParts.Any())
-                    HandleSysExSubsequentPart(data);
-
-                NativeApiUtilities.HandleDevicesNativeApiResult(
-                    InputDeviceApiProvider.Api.Api_RenewSysExBuffer(_handle.DeviceHandle, SysExBufferSize));
+                if (_messageBuffer[0] == EventStatusBytes.Global.NormalSysEx)
+                    HandleSysExStartPart(_messageBuffer, 0, size);
+                else if (_isSysExInProgress)
+                    HandleSysExSubsequentPart(_messageBuffer, 0, size);
             }
             catch (Exception ex)
             {
                 var exception = new MidiDeviceException("Failed to parse system exclusive message.", ex);
-                exception.Data.Add("Data", data);
+                exception.Data.Add("Data", _messageBuffer != null ? GetDataCopy(_messageBuffer, 0, Math.Min(size, _messageBuffer.Length)) : null);
                 OnError(exception);
             }
         }
 
+        private long GetMessageTimestamp_Win(IntPtr time)
+        {
+            var handle = _handle;
+            return handle != null
+                ? InputDeviceApiProvider.Api.Api_GetMessageTimestamp_Win(handle.DeviceHandle, time)
+                : 0;
+        }
+
+        private void RenewSysExBuffer(IntPtr sysExHeaderPointer)
+        {
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                InputDeviceApiProvider.Api.Api_RenewSysExBuffer(_handle.DeviceHandle, sysExHeaderPointer));
+        }
+
+        private void TryRenewSysExBuffer(IntPtr sysExHeaderPointer)
+        {
+            try
+            {
+                var handle = _handle;
+                if (handle != null)
+                    InputDeviceApiProvider.Api.Api_RenewSysExBuffer(handle.DeviceHandle, sysExHeaderPointer);
+            }
+            catch (Exception ex)
+            {
+                OnError(new MidiDeviceException("Failed to renew system exclusive buffer.", ex));
+            }
+        }
+
         private void TryRaiseMidiTimeCodeReceived(MidiTimeCodeEvent midiTimeCodeEvent)
         {
             var component = midiTimeCodeEvent.Component;
@@ -791,7 +1308,10 @@ namespace Melanchall.DryWetMidi.Multimedia
         private InputDeviceApi.IN_DISCONNECTRESULT StopEventsListeningSilently()
         {
             IsListeningForEvents = false;
-            return InputDeviceApiProvider.Api.Api_Disconnect(_handle.DeviceHandle);
+            var result = InputDeviceApiProvider.Api.Api_Disconnect(_handle.DeviceHandle);
+
+            StopDispatchThread();
+            return result;
         }
 
 #endregion
@@ -891,6 +1411,9 @@ namespace Melanchall.DryWetMidi.Multimedia
 
             if (disposing)
             {
+                if (_handle != null && !_handle.IsClosed)
+                    StopDispatchThread();
+
                 _bytesToMidiEventConverter.Dispose();
                 _handle?.Dispose();
             }
@@ -114,7 +114,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public enum IN_GETEVENTDATARESULT
         {
-            IN_GETEVENTDATARESULT_OK = 0
+            IN_GETEVENTDATARESULT_OK = 0,
+            IN_GETEVENTDATARESULT_BUFFERTOOSMALL = 1
         }
 
         public enum IN_GETSYSEXDATARESULT
@@ -122,6 +123,27 @@ namespace Melanchall.DryWetMidi.Multimedia
             IN_GETSYSEXDATARESULT_OK = 0
         }
 
+        public enum IN_READBUFFERRESULT
+        {
+            IN_READBUFFERRESULT_OK = 0,
+            IN_READBUFFERRESULT_NOBUFFER = 1
+        }
+
+        public enum IN_WAITBUFFERRESULT
+        {
+            IN_WAITBUFFERRESULT_OK = 0,
+            IN_WAITBUFFERRESULT_TIMEOUT = 1,
+            IN_WAITBUFFERRESULT_NOBUFFER = 2,
+            IN_WAITBUFFERRESULT_UNKNOWNERROR = 1000
+        }
+
+        public enum IN_ADDTHRUROUTERESULT
+        {
+            IN_ADDTHRUROUTERESULT_OK = 0,
+            [NativeErrorType(NativeErrorType.NoMemory)]
+            IN_ADDTHRUROUTERESULT_NOMEMORY = 1
+        }
+
         public enum IN_GETPROPERTYRESULT
         {
             IN_GETPROPERTYRESULT_OK = 0,
@@ -137,6 +159,7 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public delegate void Callback_Win(IntPtr hMidi, MidiMessage wMsg, IntPtr dwInstance, IntPtr dwParam1, IntPtr dwParam2);
         public delegate void Callback_Mac(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon);
+        public delegate void Callback_Linux(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon);
 
         #endregion
 
@@ -154,18 +177,40 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public abstract IN_OPENRESULT Api_OpenDevice_Mac(IntPtr info, IntPtr sessionHandle, Callback_Mac callback, out IntPtr handle);
 
+        public abstract IN_OPENRESULT Api_OpenDevice_Linux(IntPtr info, IntPtr sessionHandle, Callback_Linux callback, out IntPtr handle);
+
+        public abstract IN_OPENRESULT Api_OpenDeviceBuffered_Win(IntPtr info, IntPtr sessionHandle, int sysExBufferSize, int bufferSize, out IntPtr handle);
+
+        public abstract IN_OPENRESULT Api_OpenDeviceBuffered_Mac(IntPtr info, IntPtr sessionHandle, int bufferSize, out IntPtr handle);
+
+        public abstract IN_OPENRESULT Api_OpenDeviceBuffered_Linux(IntPtr info, IntPtr sessionHandle, int bufferSize, out IntPtr handle);
+
         public abstract IN_CLOSERESULT Api_CloseDevice(IntPtr handle);
 
-        public abstract IN_RENEWSYSEXBUFFERRESULT Api_RenewSysExBuffer(IntPtr handle, int size);
+        public abstract IN_RENEWSYSEXBUFFERRESULT Api_RenewSysExBuffer(IntPtr handle, IntPtr header);
 
         public abstract IN_CONNECTRESULT Api_Connect(IntPtr handle);
 
         public abstract IN_DISCONNECTRESULT Api_Disconnect(IntPtr handle);
 
-        public abstract IN_GETEVENTDATARESULT Api_GetEventData(IntPtr packetList, int packetIndex, out IntPtr data, out int length, out int packetsCount);
+        public abstract IN_GETEVENTDATARESULT Api_GetEventsData(IntPtr packetList, int maxPacketsCount, int[] offsets, int[] lengths, long[] timestamps, out int packetsCount, out int dataSize);
+
+        public abstract long Api_GetMessageTimestamp_Win(IntPtr handle, IntPtr time);
 
         public abstract IN_GETSYSEXDATARESULT Api_GetSysExBufferData(IntPtr header, out IntPtr data, out int size);
 
+        public abstract IN_READBUFFERRESULT Api_ReadBuffer(IntPtr handle, byte[] data, int size, out int bytesRead);
+
+        public abstract IN_WAITBUFFERRESULT Api_WaitForBuffer(IntPtr handle, int timeout);
+
+        public abstract void Api_InterruptBufferWaiting(IntPtr handle);
+
+        public abstract long Api_GetBufferOverflowsCount(IntPtr handle);
+
+        public abstract IN_ADDTHRUROUTERESULT Api_AddThruRoute(IntPtr handle, IntPtr outputHandle, byte[] statusesMap, byte[] notesMap, out int routeId);
+
+        public abstract void Api_RemoveThruRoute(int routeId);
+
         public abstract bool Api_IsPropertySupported(InputDeviceProperty property);
 
         public abstract IN_GETPROPERTYRESULT Api_GetDeviceName(IntPtr info, out string name);
@@ -43,11 +43,23 @@ namespace Melanchall.DryWetMidi.Multimedia
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern IN_OPENRESULT OpenInputDevice_Mac(IntPtr info, IntPtr sessionHandle, Callback_Mac callback, out IntPtr handle);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_OPENRESULT OpenInputDevice_Linux(IntPtr info, IntPtr sessionHandle, Callback_Linux callback, out IntPtr handle);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_OPENRESULT OpenInputDeviceBuffered_Win(IntPtr info, IntPtr sessionHandle, int sysExBufferSize, int bufferSize, out IntPtr handle);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_OPENRESULT OpenInputDeviceBuffered_Mac(IntPtr info, IntPtr sessionHandle, int bufferSize, out IntPtr handle);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_OPENRESULT OpenInputDeviceBuffered_Linux(IntPtr info, IntPtr sessionHandle, int bufferSize, out IntPtr handle);
+
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern IN_CLOSERESULT CloseInputDevice(IntPtr handle);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
-        private static extern IN_RENEWSYSEXBUFFERRESULT RenewInputDeviceSysExBuffer(IntPtr handle, int size);
+        private static extern IN_RENEWSYSEXBUFFERRESULT RenewInputDeviceSysExBuffer(IntPtr handle, IntPtr header);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern IN_CONNECTRESULT ConnectToInputDevice(IntPtr handle);
@@ -56,11 +68,32 @@ namespace Melanchall.DryWetMidi.Multimedia
         private static extern IN_DISCONNECTRESULT DisconnectFromInputDevice(IntPtr handle);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
-        private static extern IN_GETEVENTDATARESULT GetEventDataFromInputDevice(IntPtr packetList, int packetIndex, out IntPtr data, out int length, out int packetsCount);
+        private static extern IN_GETEVENTDATARESULT GetEventsDataFromInputDevice(IntPtr packetList, int maxPacketsCount, int[] offsets, int[] lengths, long[] timestamps, out int packetsCount, out int dataSize);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern long GetInputDeviceMessageTimestamp_Win(IntPtr handle, IntPtr time);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern IN_GETSYSEXDATARESULT GetInputDeviceSysExBufferData(IntPtr header, out IntPtr data, out int size);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_READBUFFERRESULT ReadInputDeviceBuffer(IntPtr handle, [Out] byte[] data, int size, out int bytesRead);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_WAITBUFFERRESULT WaitForInputDeviceBuffer(IntPtr handle, int timeout);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern void InterruptInputDeviceBufferWaiting(IntPtr handle);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern long GetInputDeviceBufferOverflowsCount(IntPtr handle);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern IN_ADDTHRUROUTERESULT AddInputDeviceThruRoute(IntPtr handle, IntPtr outputHandle, byte[] statusesMap, byte[] notesMap, out int routeId);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern void RemoveInputDeviceThruRoute(int routeId);
+
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern bool IsInputDevicePropertySupported(InputDeviceProperty property);
 
@@ -104,14 +137,34 @@ namespace Melanchall.DryWetMidi.Multimedia
             return OpenInputDevice_Mac(info, sessionHandle, callback, out handle);
         }
 
+        public override IN_OPENRESULT Api_OpenDevice_Linux(IntPtr info, IntPtr sessionHandle, Callback_Linux callback, out IntPtr handle)
+        {
+            return OpenInputDevice_Linux(info, sessionHandle, callback, out handle);
+        }
+
+        public override IN_OPENRESULT Api_OpenDeviceBuffered_Win(IntPtr info, IntPtr sessionHandle, int sysExBufferSize, int bufferSize, out IntPtr handle)
+        {
+            return OpenInputDeviceBuffered_Win(info, sessionHandle, sysExBufferSize, bufferSize, out handle);
+        }
+
+        public override IN_OPENRESULT Api_OpenDeviceBuffered_Mac(IntPtr info, IntPtr sessionHandle, int bufferSize, out IntPtr handle)
+        {
+            return OpenInputDeviceBuffered_Mac(info, sessionHandle, bufferSize, out handle);
+        }
+
+        public override IN_OPENRESULT Api_OpenDeviceBuffered_Linux(IntPtr info, IntPtr sessionHandle, int bufferSize, out IntPtr handle)
+        {
+            return OpenInputDeviceBuffered_Linux(info, sessionHandle, bufferSize, out handle);
+        }
+
         public override IN_CLOSERESULT Api_CloseDevice(IntPtr handle)
         {
             return CloseInputDevice(handle);
         }
 
-        public override IN_RENEWSYSEXBUFFERRESULT Api_RenewSysExBuffer(IntPtr handle, int size)
+        public override IN_RENEWSYSEXBUFFERRESULT Api_RenewSysExBuffer(IntPtr handle, IntPtr header)
         {
-            return RenewInputDeviceSysExBuffer(handle, size);
+            return RenewInputDeviceSysExBuffer(handle, header);
         }
 
         public override IN_CONNECTRESULT Api_Connect(IntPtr handle)
@@ -124,9 +177,14 @@ namespace Melanchall.DryWetMidi.Multimedia
             return DisconnectFromInputDevice(handle);
         }
 
-        public override IN_GETEVENTDATARESULT Api_GetEventData(IntPtr packetList, int packetIndex, out IntPtr data, out int length, out int packetsCount)
+        public override IN_GETEVENTDATARESULT Api_GetEventsData(IntPtr packetList, int maxPacketsCount, int[] offsets, int[] lengths, long[] timestamps, out int packetsCount, out int dataSize)
+        {
+            return GetEventsDataFromInputDevice(packetList, maxPacketsCount, offsets, lengths, timestamps, out packetsCount, out dataSize);
+        }
+
+        public override long Api_GetMessageTimestamp_Win(IntPtr handle, IntPtr time)
         {
-            return GetEventDataFromInputDevice(packetList, packetIndex, out data, out length, out packetsCount);
+            return GetInputDeviceMessageTimestamp_Win(handle, time);
         }
 
         public override IN_GETSYSEXDATARESULT Api_GetSysExBufferData(IntPtr header, out IntPtr data, out int size)
@@ -134,6 +192,36 @@ namespace Melanchall.DryWetMidi.Multimedia
             return GetInputDeviceSysExBufferData(header, out data, out size);
         }
 
+        public override IN_READBUFFERRESULT Api_ReadBuffer(IntPtr handle, byte[] data, int size, out int bytesRead)
+        {
+            return ReadInputDeviceBuffer(handle, data, size, out bytesRead);
+        }
+
+        public override IN_WAITBUFFERRESULT Api_WaitForBuffer(IntPtr handle, int timeout)
+        {
+            return WaitForInputDeviceBuffer(handle, timeout);
+        }
+
+        public override void Api_InterruptBufferWaiting(IntPtr handle)
+        {
+            InterruptInputDeviceBufferWaiting(handle);
+        }
+
+        public override long Api_GetBufferOverflowsCount(IntPtr handle)
+        {
+            return GetInputDeviceBufferOverflowsCount(handle);
+        }
+
+        public override IN_ADDTHRUROUTERESULT Api_AddThruRoute(IntPtr handle, IntPtr outputHandle, byte[] statusesMap, byte[] notesMap, out int routeId)
+        {
+            return AddInputDeviceThruRoute(handle, outputHandle, statusesMap, notesMap, out routeId);
+        }
+
+        public override void Api_RemoveThruRoute(int routeId)
+        {
+            RemoveInputDeviceThruRoute(routeId);
+        }
+
         public override bool Api_IsPropertySupported(InputDeviceProperty property)
         {
             return IsInputDevicePropertySupported(property);
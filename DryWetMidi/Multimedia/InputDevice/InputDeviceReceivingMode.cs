@@ -0,0 +1,34 @@
+﻿using Melanchall.DryWetMidi.Core;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    /// <summary>
+    /// Defines how an <see cref="InputDevice"/> takes incoming MIDI data from the native side. The default is
+    /// <see cref="Direct"/>.
+    /// </summary>
+    /// <seealso cref="InputDevice"/>
+    public enum InputDeviceReceivingMode
+    {
+        /// <summary>
+        /// Every incoming message is passed to the managed code right from the callback of the operating
+        /// system's MIDI API and <see cref="InputDevice.EventReceived"/> is raised on the thread of that callback.
+        /// </summary>
+        Direct = 0,
+
+        /// <summary>
+        /// Incoming messages are put by the native code into a lock-free ring buffer (its size is defined by
+        /// <see cref="InputDevice.ReceivingBufferSize"/>) and drained in batches by a dedicated thread which
+        /// raises <see cref="InputDevice.EventReceived"/>. The thread of the operating system's MIDI API never
+        /// waits for the managed code.
+        /// </summary>
+        DispatchThread = 1,
+
+        /// <summary>
+        /// Incoming messages are put by the native code into a lock-free ring buffer (its size is defined by
+        /// <see cref="InputDevice.ReceivingBufferSize"/>) and can be taken in batches via the
+        /// <see cref="InputDevice.ReadEvents(MidiEvent[], int, int)"/> method. <see cref="InputDevice.EventReceived"/>
+        /// is not raised in this mode.
+        /// </summary>
+        Polling = 2
+    }
+}
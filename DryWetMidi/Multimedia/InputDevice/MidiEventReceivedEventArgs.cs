@@ -24,6 +24,12 @@ namespace Melanchall.DryWetMidi.Multimedia
             Event = midiEvent;
         }
 
+        internal MidiEventReceivedEventArgs(MidiEvent midiEvent, long timestamp)
+            : this(midiEvent)
+        {
+            Timestamp = timestamp;
+        }
+
         #endregion
 
         #region Properties
@@ -33,6 +39,20 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         public MidiEvent Event { get; }
 
+        /// <summary>
+        /// Gets the time when the event was received by the device, in nanoseconds of the system
+        /// monotonic clock, or <c>null</c> if the time is unknown.
+        /// </summary>
+        /// <remarks>
+        /// <para>The time is taken by the native MIDI API when the data arrives, before it is passed
+        /// to managed code, so it's not affected by delays of events processing. All platforms use
+        /// the same units so only difference between two timestamps is meaningful. Current time of the clock
+        /// can be obtained with the <see cref="MidiDevice.GetCurrentTimestamp"/> method.</para>
+        /// <para>The property is set for events received by <see cref="InputDevice"/>. For events raised
+        /// by custom implementations of <see cref="IInputDevice"/> it's <c>null</c>.</para>
+        /// </remarks>
+        public long? Timestamp { get; }
+
         #endregion
     }
 }
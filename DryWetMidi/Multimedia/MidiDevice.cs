@@ -1,4 +1,5 @@
 ﻿using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
 using System;
 using System.Collections.Generic;
 
@@ -94,6 +95,20 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         #region Methods
 
+        /// <summary>
+        /// Gets the current time of the system monotonic clock used by MIDI devices, in nanoseconds.
+        /// </summary>
+        /// <remarks>
+        /// The value is in the same units as <see cref="MidiEventReceivedEventArgs.Timestamp"/> and
+        /// timestamps accepted by <see cref="OutputDevice.ScheduleEvent(MidiEvent, long)"/>. Only
+        /// difference between two values is meaningful.
+        /// </remarks>
+        /// <returns>The current time of the monotonic clock in nanoseconds.</returns>
+        public static long GetCurrentTimestamp()
+        {
+            return CommonApiProvider.Api.Api_GetMonotonicTimestamp();
+        }
+
         /// <summary>
         /// Checks that current instance of MIDI device class is not disposed and throws
         /// <see cref="ObjectDisposedException"/> if it is.
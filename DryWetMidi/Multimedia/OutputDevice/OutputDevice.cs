@@ -3,6 +3,7 @@ using System.Collections.Generic;
 using System.ComponentModel;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Melanchall.DryWetMidi.Common;
 using Melanchall.DryWetMidi.Core;
 
@@ -57,6 +58,11 @@ namespace Melanchall.DryWetMidi.Multimedia
         #region Constants
 
         private const int ShortEventBufferSize = 3;
+        private const int ShortEventsBatchSize = 256;
+
+        // Token of events scheduled via the public API; playbacks use their own tokens so
+        // cancelling events of one party doesn't drop events of other ones
+        private const long UserScheduledEventsToken = 0;
 
         private static readonly IEventWriter ChannelEventWriter = new ChannelEventWriter();
         private static readonly IEventWriter SystemRealTimeEventWriter = new SystemRealTimeEventWriter();
@@ -74,6 +80,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         #region Fields
 
+        private static long _lastScheduledEventsToken = UserScheduledEventsToken;
+
         private static OutputDeviceProperty[] _supportedProperties;
 
         private readonly MidiEventToBytesConverter _midiEventToBytesConverter = new MidiEventToBytesConverter(ShortEventBufferSize) { BytesFormat = BytesFormat.Device };
@@ -87,6 +95,11 @@ namespace Melanchall.DryWetMidi.Multimedia
         private readonly IntPtr _info = IntPtr.Zero;
         private OutputDeviceHandle _handle = null;
 
+        // Batch buffers are taken by a SendEvents call for its duration, so concurrent (or
+        // reentrant) calls allocate their own ones instead of overwriting each other's data
+        private int[] _shortEventsMessages;
+        private MidiEvent[] _shortEventsBatch;
+
         #endregion
 
         #region Constructor
@@ -144,7 +157,7 @@ namespace Melanchall.DryWetMidi.Multimedia
             EnsureSessionIsCreated();
             EnsureHandleIsCreated();
 
-            if (midiEvent is ChannelEvent || midiEvent is SystemCommonEvent || midiEvent is SystemRealTimeEvent)
+            if (IsShortEvent(midiEvent))
             {
                 var message = PackShortEvent(midiEvent);
                 NativeApiUtilities.HandleDevicesNativeApiResult(
@@ -159,6 +172,154 @@ namespace Melanchall.DryWetMidi.Multimedia
             }
         }
 
+        /// <summary>
+        /// Sends MIDI events to the current output device.
+        /// </summary>
+        /// <remarks>
+        /// Consecutive channel, system common and system real-time events are packed into batches
+        /// and each batch is passed to the operating system by a single call (one packet list on
+        /// macOS and Linux) rather than event by event. <see cref="EventSent"/> is raised for every
+        /// event of a batch after the batch has been sent. System exclusive events are sent in the
+        /// same way as <see cref="SendEvent(MidiEvent)"/> does it, preserving the order of events.
+        /// </remarks>
+        /// <param name="midiEvents">MIDI events to send.</param>
+        /// <exception cref="ObjectDisposedException">The current <see cref="OutputDevice"/> is disposed.</exception>
+        /// <exception cref="ArgumentNullException"><paramref name="midiEvents"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException"><paramref name="midiEvents"/> contains <c>null</c>.</exception>
+        /// <exception cref="MidiDeviceException">An error occurred on device.</exception>
+        public void SendEvents(IEnumerable<MidiEvent> midiEvents)
+        {
+            ThrowIfArgument.IsNull(nameof(midiEvents), midiEvents);
+
+            if (!IsEnabled)
+                return;
+
+            EnsureDeviceIsNotDisposed();
+            EnsureDeviceIsNotRemoved();
+            EnsureSessionIsCreated();
+            EnsureHandleIsCreated();
+
+            var shortEventsMessages = Interlocked.Exchange(ref _shortEventsMessages, null) ?? new int[ShortEventsBatchSize];
+            var shortEventsBatch = Interlocked.Exchange(ref _shortEventsBatch, null) ?? new MidiEvent[ShortEventsBatchSize];
+
+            var shortEventsCount = 0;
+
+            try
+            {
+                foreach (var midiEvent in midiEvents)
+                {
+                    if (midiEvent == null)
+                        throw new ArgumentException("Events collection contains null.", nameof(midiEvents));
+
+                    if (IsShortEvent(midiEvent))
+                    {
+                        shortEventsMessages[shortEventsCount] = PackShortEvent(midiEvent);
+                        shortEventsBatch[shortEventsCount] = midiEvent;
+
+                        if (++shortEventsCount == ShortEventsBatchSize)
+                            SendShortEventsBatch(shortEventsMessages, shortEventsBatch, ref shortEventsCount);
+                    }
+                    else
+                    {
+                        var sysExEvent = midiEvent as SysExEvent;
+                        if (sysExEvent == null)
+                            continue;
+
+                        SendShortEventsBatch(shortEventsMessages, shortEventsBatch, ref shortEventsCount);
+                        SendSysExEvent(sysExEvent);
+                    }
+                }
+
+                SendShortEventsBatch(shortEventsMessages, shortEventsBatch, ref shortEventsCount);
+            }
+            finally
+            {
+                Array.Clear(shortEventsBatch, 0, ShortEventsBatchSize);
+
+                _shortEventsMessages = shortEventsMessages;
+                _shortEventsBatch = shortEventsBatch;
+            }
+        }
+
+        /// <summary>
+        /// Schedules a MIDI event to be sent to the current output device at the specified time.
+        /// </summary>
+        /// <remarks>
+        /// <para>The event is handed to the native library right away and sent by its high-priority
+        /// scheduler thread at the specified time, so timing of sending doesn't depend on managed code.
+        /// If the time has already passed, the event is sent immediately. Events scheduled for the
+        /// same time are sent in order of scheduling.</para>
+        /// <para><see cref="EventSent"/> is raised when the event is scheduled, not when it's sent.
+        /// Pending events can be cancelled with the <see cref="CancelScheduledEvents"/> method.</para>
+        /// <para>Only channel, system common and system real-time events can be scheduled.</para>
+        /// </remarks>
+        /// <param name="midiEvent">MIDI event to send.</param>
+        /// <param name="timestamp">Time to send <paramref name="midiEvent"/> at, in nanoseconds of the
+        /// clock returned by <see cref="MidiDevice.GetCurrentTimestamp"/>.</param>
+        /// <exception cref="ObjectDisposedException">The current <see cref="OutputDevice"/> is disposed.</exception>
+        /// <exception cref="ArgumentNullException"><paramref name="midiEvent"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException"><paramref name="midiEvent"/> is neither channel, system common
+        /// nor system real-time event.</exception>
+        /// <exception cref="MidiDeviceException">An error occurred on device.</exception>
+        public void ScheduleEvent(MidiEvent midiEvent, long timestamp)
+        {
+            ScheduleEvent(midiEvent, timestamp, UserScheduledEventsToken);
+        }
+
+        /// <summary>
+        /// Cancels sending of all events scheduled with <see cref="ScheduleEvent(MidiEvent, long)"/>
+        /// whose time hasn't come yet.
+        /// </summary>
+        /// <remarks>
+        /// Events scheduled by playbacks using the current device are not cancelled.
+        /// </remarks>
+        /// <exception cref="ObjectDisposedException">The current <see cref="OutputDevice"/> is disposed.</exception>
+        /// <exception cref="MidiDeviceException">An error occurred on device.</exception>
+        public void CancelScheduledEvents()
+        {
+            CancelScheduledEvents(UserScheduledEventsToken);
+        }
+
+        internal static long GetNewScheduledEventsToken()
+        {
+            return Interlocked.Increment(ref _lastScheduledEventsToken);
+        }
+
+        internal void ScheduleEvent(MidiEvent midiEvent, long timestamp, long token)
+        {
+            ThrowIfArgument.IsNull(nameof(midiEvent), midiEvent);
+
+            if (!IsShortEvent(midiEvent))
+                throw new ArgumentException("Only channel, system common and system real-time events can be scheduled.", nameof(midiEvent));
+
+            if (!IsEnabled)
+                return;
+
+            EnsureDeviceIsNotDisposed();
+            EnsureDeviceIsNotRemoved();
+            EnsureSessionIsCreated();
+            EnsureHandleIsCreated();
+
+            var messages = new[] { PackShortEvent(midiEvent) };
+            var timestamps = new[] { timestamp };
+
+            int sentCount;
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                OutputDeviceApiProvider.Api.Api_SendShortEvents(_handle.DeviceHandle, messages, timestamps, token, 1, out sentCount));
+            OnEventSent(midiEvent);
+        }
+
+        internal void CancelScheduledEvents(long token)
+        {
+            EnsureDeviceIsNotDisposed();
+
+            if (_handle == null)
+                return;
+
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                OutputDeviceApiProvider.Api.Api_CancelScheduledEvents(_handle.DeviceHandle, token));
+        }
+
         /// <summary>
         /// Turns off all notes that were turned on by sending Note On events, and which haven't
         /// yet been turned off by respective Note Off events.
@@ -176,10 +337,7 @@ namespace Melanchall.DryWetMidi.Multimedia
                                     from noteNumber in SevenBitNumber.Values
                                     select new NoteOffEvent(noteNumber, SevenBitNumber.MinValue) { Channel = channel };
 
-            foreach (var noteOffEvent in allNotesOffEvents)
-            {
-                SendEvent(noteOffEvent);
-            }
+            SendEvents(allNotesOffEvents);
         }
 
         /// <summary>
@@ -457,12 +615,54 @@ namespace Melanchall.DryWetMidi.Multimedia
             EnsureSessionIsCreated();
             EnsureHandleIsCreated();
 
-            var bufferLength = data.Length;
-            var bufferPointer = Marshal.AllocHGlobal(bufferLength);
-            Marshal.Copy(data, 0, bufferPointer, data.Length);
+            SendSysExData(data, false);
+        }
 
-            NativeApiUtilities.HandleDevicesNativeApiResult(
-                OutputDeviceApiProvider.Api.Api_SendSysExEvent_Win(_handle.DeviceHandle, bufferPointer, bufferLength));
+        internal void GetSysExBufferPoolCounters(out long acquisitionsCount, out long reusesCount, out long exhaustionsCount)
+        {
+            acquisitionsCount = 0;
+            reusesCount = 0;
+            exhaustionsCount = 0;
+
+            if (_handle == null)
+                return;
+
+            OutputDeviceApiProvider.Api.Api_GetSysExBufferPoolCounters(_handle.DeviceHandle, out acquisitionsCount, out reusesCount, out exhaustionsCount);
+        }
+
+        internal void SendShortEvents(int[] messages, MidiEvent[] midiEvents, int count, out int sentCount)
+        {
+            sentCount = 0;
+
+            if (!IsEnabled)
+            {
+                sentCount = count;
+                return;
+            }
+
+            EnsureDeviceIsNotDisposed();
+            EnsureDeviceIsNotRemoved();
+            EnsureSessionIsCreated();
+            EnsureHandleIsCreated();
+
+            var result = OutputDeviceApiProvider.Api.Api_SendShortEvents(_handle.DeviceHandle, messages, null, UserScheduledEventsToken, count, out sentCount);
+
+            for (var i = 0; i < sentCount; i++)
+            {
+                OnEventSent(midiEvents[i]);
+            }
+
+            NativeApiUtilities.HandleDevicesNativeApiResult(result);
+        }
+
+        internal IntPtr GetDeviceHandle()
+        {
+            EnsureDeviceIsNotDisposed();
+            EnsureDeviceIsNotRemoved();
+            EnsureSessionIsCreated();
+            EnsureHandleIsCreated();
+
+            return _handle.DeviceHandle;
         }
 
         private static IEnumerable<OutputDevice> GetAllLazy()
@@ -498,6 +698,12 @@ namespace Melanchall.DryWetMidi.Multimedia
                             OutputDeviceApiProvider.Api.Api_OpenDevice_Mac(_info, sessionHandle, out deviceHandle));
                     }
                     break;
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
+                    {
+                        NativeApiUtilities.HandleDevicesNativeApiResult(
+                            OutputDeviceApiProvider.Api.Api_OpenDevice_Linux(_info, sessionHandle, out deviceHandle));
+                    }
+                    break;
                 default:
                     throw new NotSupportedException($"{_apiType} API is not supported.");
             }
@@ -512,16 +718,17 @@ namespace Melanchall.DryWetMidi.Multimedia
         private void SendSysExEvent(SysExEvent sysExEvent)
         {
             var data = sysExEvent.Data;
-            if (data == null || !data.Any())
+            if (data == null || data.Length == 0)
                 return;
 
+            SendSysExData(data, true);
+
             switch (_apiType)
             {
                 case CommonApi.API_TYPE.API_TYPE_WIN:
-                    SendSysExEventData_Win(data);
                     break;
                 case CommonApi.API_TYPE.API_TYPE_MAC:
-                    SendSysExEventData_Mac(data);
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
                     OnEventSent(sysExEvent);
                     break;
                 default:
@@ -529,28 +736,63 @@ namespace Melanchall.DryWetMidi.Multimedia
             }
         }
 
-        private void SendSysExEventData_Win(byte[] data)
+        private void SendSysExData(byte[] data, bool writeStatusByte)
         {
-            var bufferLength = data.Length + 1;
-            var bufferPointer = Marshal.AllocHGlobal(bufferLength);
-            Marshal.WriteByte(bufferPointer, EventStatusBytes.Global.NormalSysEx);
-            Marshal.Copy(data, 0, IntPtr.Add(bufferPointer, 1), data.Length);
+            var api = OutputDeviceApiProvider.Api;
+            var statusByteLength = writeStatusByte ? 1 : 0;
+            var size = data.Length + statusByteLength;
 
+            // Data is written right into a native buffer taken from the device's pool,
+            // the buffer is returned to the pool by the native side once sent
+            IntPtr buffer;
+            IntPtr bufferData;
             NativeApiUtilities.HandleDevicesNativeApiResult(
-                OutputDeviceApiProvider.Api.Api_SendSysExEvent_Win(_handle.DeviceHandle, bufferPointer, bufferLength));
+                api.Api_AcquireSysExBuffer(_handle.DeviceHandle, size, out buffer, out bufferData));
+
+            try
+            {
+                if (writeStatusByte)
+                    Marshal.WriteByte(bufferData, EventStatusBytes.Global.NormalSysEx);
+
+                Marshal.Copy(data, 0, IntPtr.Add(bufferData, statusByteLength), data.Length);
+            }
+            catch
+            {
+                api.Api_ReleaseSysExBuffer(_handle.DeviceHandle, buffer);
+                throw;
+            }
+
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                api.Api_SendSysExBuffer(_handle.DeviceHandle, buffer, size));
         }
 
-        private void SendSysExEventData_Mac(byte[] data)
+        private void SendShortEventsBatch(int[] shortEventsMessages, MidiEvent[] shortEventsBatch, ref int shortEventsCount)
         {
-            var buffer = new byte[data.Length + 1];
-            buffer[0] = EventStatusBytes.Global.NormalSysEx;
-            Buffer.BlockCopy(data, 0, buffer, 1, data.Length);
+            if (shortEventsCount == 0)
+                return;
 
-            NativeApiUtilities.HandleDevicesNativeApiResult(
-                OutputDeviceApiProvider.Api.Api_SendSysExEvent_Mac(_handle.DeviceHandle, buffer, (ushort)buffer.Length));
+            var count = shortEventsCount;
+            shortEventsCount = 0;
+
+            int sentCount;
+            var result = OutputDeviceApiProvider.Api.Api_SendShortEvents(_handle.DeviceHandle, shortEventsMessages, null, UserScheduledEventsToken, count, out sentCount);
+
+            for (var i = 0; i < sentCount; i++)
+            {
+                OnEventSent(shortEventsBatch[i]);
+            }
+
+            NativeApiUtilities.HandleDevicesNativeApiResult(result);
         }
 
-        private int PackShortEvent(MidiEvent midiEvent)
+        internal static bool IsShortEvent(MidiEvent midiEvent)
+        {
+            return midiEvent is ChannelEvent || midiEvent is SystemCommonEvent || midiEvent is SystemRealTimeEvent;
+        }
+
+        // Returns zero for events which can't be packed without a converter
+        // (status byte of a short message is never zero)
+        internal static int GetShortEventMessage(MidiEvent midiEvent)
         {
             var channelEvent = midiEvent as ChannelEvent;
             if (channelEvent != null)
@@ -560,6 +802,15 @@ namespace Melanchall.DryWetMidi.Multimedia
             if (systemRealTimeEvent != null)
                 return SystemRealTimeEventWriter.GetStatusByte(systemRealTimeEvent);
 
+            return 0;
+        }
+
+        private int PackShortEvent(MidiEvent midiEvent)
+        {
+            var message = GetShortEventMessage(midiEvent);
+            if (message != 0)
+                return message;
+
             var bytes = _midiEventToBytesConverter.Convert(midiEvent, ShortEventBufferSize);
             return bytes[0] + (bytes[1] << 8) + (bytes[2] << 16);
         }
@@ -582,13 +833,20 @@ namespace Melanchall.DryWetMidi.Multimedia
             {
                 IntPtr dataPointer;
                 int size;
+                IntPtr buffer;
 
                 NativeApiUtilities.HandleDevicesNativeApiResult(
-                    OutputDeviceApiProvider.Api.Api_GetSysExBufferData(_handle.DeviceHandle, sysExHeaderPointer, out dataPointer,  out size));
-
-                data = new byte[size - 1];
-                Marshal.Copy(IntPtr.Add(dataPointer, 1), data, 0, data.Length);
-                Marshal.FreeHGlobal(dataPointer);
+                    OutputDeviceApiProvider.Api.Api_GetSysExBufferData(_handle.DeviceHandle, sysExHeaderPointer, out dataPointer, out size, out buffer));
+
+                try
+                {
+                    data = new byte[size - 1];
+                    Marshal.Copy(IntPtr.Add(dataPointer, 1), data, 0, data.Length);
+                }
+                finally
+                {
+                    OutputDeviceApiProvider.Api.Api_ReleaseSysExBuffer(_handle.DeviceHandle, buffer);
+                }
 
                 var midiEvent = new NormalSysExEvent(data);
                 OnEventSent(midiEvent);
@@ -63,7 +63,9 @@ namespace Melanchall.DryWetMidi.Multimedia
             OUT_SENDSHORTRESULT_WRONGTHREAD = 107,
             [NativeErrorType(NativeErrorType.NotPermitted)]
             OUT_SENDSHORTRESULT_NOTPERMITTED = 108,
-            OUT_SENDSHORTRESULT_UNKNOWNERROR = 109
+            OUT_SENDSHORTRESULT_UNKNOWNERROR = 109,
+            [NativeErrorType(NativeErrorType.NoMemory)]
+            OUT_SENDSHORTRESULT_NOMEMORY = 110
         }
 
         public enum OUT_SENDSYSEXRESULT
@@ -91,6 +93,19 @@ namespace Melanchall.DryWetMidi.Multimedia
             OUT_SENDSYSEXRESULT_UNKNOWNERROR = 109
         }
 
+        public enum OUT_ACQUIRESYSEXBUFFERRESULT
+        {
+            OUT_ACQUIRESYSEXBUFFERRESULT_OK = 0,
+            [NativeErrorType(NativeErrorType.NoMemory)]
+            OUT_ACQUIRESYSEXBUFFERRESULT_NOMEMORY = 1
+        }
+
+        public enum OUT_CANCELSCHEDULEDRESULT
+        {
+            OUT_CANCELSCHEDULEDRESULT_OK = 0,
+            OUT_CANCELSCHEDULEDRESULT_UNKNOWNERROR = 1
+        }
+
         public enum OUT_GETSYSEXDATARESULT
         {
             OUT_GETSYSEXDATARESULT_OK = 0,
@@ -131,15 +146,25 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public abstract OUT_OPENRESULT Api_OpenDevice_Mac(IntPtr info, IntPtr sessionHandle, out IntPtr handle);
 
+        public abstract OUT_OPENRESULT Api_OpenDevice_Linux(IntPtr info, IntPtr sessionHandle, out IntPtr handle);
+
         public abstract OUT_CLOSERESULT Api_CloseDevice(IntPtr handle);
 
         public abstract OUT_SENDSHORTRESULT Api_SendShortEvent(IntPtr handle, int message);
 
-        public abstract OUT_SENDSYSEXRESULT Api_SendSysExEvent_Mac(IntPtr handle, byte[] data, ushort dataSize);
+        public abstract OUT_SENDSHORTRESULT Api_SendShortEvents(IntPtr handle, int[] messages, long[] timestamps, long token, int count, out int sentCount);
+
+        public abstract OUT_CANCELSCHEDULEDRESULT Api_CancelScheduledEvents(IntPtr handle, long token);
+
+        public abstract OUT_ACQUIRESYSEXBUFFERRESULT Api_AcquireSysExBuffer(IntPtr handle, int size, out IntPtr buffer, out IntPtr data);
+
+        public abstract void Api_ReleaseSysExBuffer(IntPtr handle, IntPtr buffer);
+
+        public abstract OUT_SENDSYSEXRESULT Api_SendSysExBuffer(IntPtr handle, IntPtr buffer, int size);
 
-        public abstract OUT_SENDSYSEXRESULT Api_SendSysExEvent_Win(IntPtr handle, IntPtr data, int size);
+        public abstract OUT_GETSYSEXDATARESULT Api_GetSysExBufferData(IntPtr handle, IntPtr header, out IntPtr data, out int size, out IntPtr buffer);
 
-        public abstract OUT_GETSYSEXDATARESULT Api_GetSysExBufferData(IntPtr handle, IntPtr header, out IntPtr data, out int size);
+        public abstract void Api_GetSysExBufferPoolCounters(IntPtr handle, out long acquisitionsCount, out long reusesCount, out long exhaustionsCount);
 
         public abstract bool Api_IsPropertySupported(OutputDeviceProperty property);
 
@@ -43,6 +43,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern OUT_OPENRESULT OpenOutputDevice_Mac(IntPtr info, IntPtr sessionHandle, out IntPtr handle);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern OUT_OPENRESULT OpenOutputDevice_Linux(IntPtr info, IntPtr sessionHandle, out IntPtr handle);
+
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern OUT_CLOSERESULT CloseOutputDevice(IntPtr handle);
 
@@ -50,13 +53,25 @@ namespace Melanchall.DryWetMidi.Multimedia
         private static extern OUT_SENDSHORTRESULT SendShortEventToOutputDevice(IntPtr handle, int message);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
-        private static extern OUT_SENDSYSEXRESULT SendSysExEventToOutputDevice_Mac(IntPtr handle, byte[] data, ushort dataSize);
+        private static extern OUT_SENDSHORTRESULT SendShortEventsToOutputDevice(IntPtr handle, int[] messages, long[] timestamps, long token, int count, out int sentCount);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern OUT_CANCELSCHEDULEDRESULT CancelScheduledOutputDeviceEvents(IntPtr handle, long token);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
-        private static extern OUT_SENDSYSEXRESULT SendSysExEventToOutputDevice_Win(IntPtr handle, IntPtr data, int size);
+        private static extern OUT_ACQUIRESYSEXBUFFERRESULT AcquireOutputDeviceSysExBuffer(IntPtr handle, int size, out IntPtr buffer, out IntPtr data);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
-        private static extern OUT_GETSYSEXDATARESULT GetOutputDeviceSysExBufferData(IntPtr handle, IntPtr header, out IntPtr data, out int size);
+        private static extern void ReleaseOutputDeviceSysExBuffer(IntPtr handle, IntPtr buffer);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern OUT_SENDSYSEXRESULT SendSysExBufferToOutputDevice(IntPtr handle, IntPtr buffer, int size);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern OUT_GETSYSEXDATARESULT GetOutputDeviceSysExBufferData(IntPtr handle, IntPtr header, out IntPtr data, out int size, out IntPtr buffer);
+
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern void GetOutputDeviceSysExBufferPoolCounters(IntPtr handle, out long acquisitionsCount, out long reusesCount, out long exhaustionsCount);
 
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern bool IsOutputDevicePropertySupported(OutputDeviceProperty property);
@@ -116,6 +131,11 @@ namespace Melanchall.DryWetMidi.Multimedia
             return OpenOutputDevice_Mac(info, sessionHandle, out handle);
         }
 
+        public override OUT_OPENRESULT Api_OpenDevice_Linux(IntPtr info, IntPtr sessionHandle, out IntPtr handle)
+        {
+            return OpenOutputDevice_Linux(info, sessionHandle, out handle);
+        }
+
         public override OUT_CLOSERESULT Api_CloseDevice(IntPtr handle)
         {
             return CloseOutputDevice(handle);
@@ -126,19 +146,39 @@ namespace Melanchall.DryWetMidi.Multimedia
             return SendShortEventToOutputDevice(handle, message);
         }
 
-        public override OUT_SENDSYSEXRESULT Api_SendSysExEvent_Mac(IntPtr handle, byte[] data, ushort dataSize)
+        public override OUT_SENDSHORTRESULT Api_SendShortEvents(IntPtr handle, int[] messages, long[] timestamps, long token, int count, out int sentCount)
+        {
+            return SendShortEventsToOutputDevice(handle, messages, timestamps, token, count, out sentCount);
+        }
+
+        public override OUT_CANCELSCHEDULEDRESULT Api_CancelScheduledEvents(IntPtr handle, long token)
+        {
+            return CancelScheduledOutputDeviceEvents(handle, token);
+        }
+
+        public override OUT_ACQUIRESYSEXBUFFERRESULT Api_AcquireSysExBuffer(IntPtr handle, int size, out IntPtr buffer, out IntPtr data)
+        {
+            return AcquireOutputDeviceSysExBuffer(handle, size, out buffer, out data);
+        }
+
+        public override void Api_ReleaseSysExBuffer(IntPtr handle, IntPtr buffer)
+        {
+            ReleaseOutputDeviceSysExBuffer(handle, buffer);
+        }
+
+        public override OUT_SENDSYSEXRESULT Api_SendSysExBuffer(IntPtr handle, IntPtr buffer, int size)
         {
-            return SendSysExEventToOutputDevice_Mac(handle, data, dataSize);
+            return SendSysExBufferToOutputDevice(handle, buffer, size);
         }
 
-        public override OUT_SENDSYSEXRESULT Api_SendSysExEvent_Win(IntPtr handle, IntPtr data, int size)
+        public override OUT_GETSYSEXDATARESULT Api_GetSysExBufferData(IntPtr handle, IntPtr header, out IntPtr data, out int size, out IntPtr buffer)
         {
-            return SendSysExEventToOutputDevice_Win(handle, data, size);
+            return GetOutputDeviceSysExBufferData(handle, header, out data, out size, out buffer);
         }
 
-        public override OUT_GETSYSEXDATARESULT Api_GetSysExBufferData(IntPtr handle, IntPtr header, out IntPtr data, out int size)
+        public override void Api_GetSysExBufferPoolCounters(IntPtr handle, out long acquisitionsCount, out long reusesCount, out long exhaustionsCount)
         {
-            return GetOutputDeviceSysExBufferData(handle, header, out data, out size);
+            GetOutputDeviceSysExBufferPoolCounters(handle, out acquisitionsCount, out reusesCount, out exhaustionsCount);
         }
 
         public override bool Api_IsPropertySupported(OutputDeviceProperty property)
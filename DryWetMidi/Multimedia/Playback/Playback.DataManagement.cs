@@ -20,7 +20,7 @@ namespace Melanchall.DryWetMidi.Multimedia
         private readonly ConcurrentDictionary<NoteId, TimedEvent> _noteOffEvents = new ConcurrentDictionary<NoteId, TimedEvent>();
 
         private readonly List<PlaybackEvent> _playbackEventsBuffer = new List<PlaybackEvent>();
-        private IPlaybackSource _playbackSource = new FixedPlaybackSource();
+        private IPlaybackSource _playbackSource;
         private readonly object _playbackLockObject = new object();
         private bool _beforeStart = true;
 
@@ -33,7 +33,8 @@ namespace Melanchall.DryWetMidi.Multimedia
             TempoMap tempoMap,
             NoteDetectionSettings noteDetectionSettings,
             bool calculateTempoMap,
-            bool useNoteEventsDirectly)
+            bool useNoteEventsDirectly,
+            bool useCompiledTimeline)
         {
             _observableTimedObjectsCollection = timedObjects as IObservableTimedObjectsCollection;
             if (_observableTimedObjectsCollection != null)
@@ -41,6 +42,11 @@ namespace Melanchall.DryWetMidi.Multimedia
                 _playbackSource = new ObservablePlaybackSource();
                 _observableTimedObjectsCollection.CollectionChanged += OnObservableTimedObjectsCollectionChanged;
             }
+            else
+            {
+                _playbackSource = new FixedPlaybackSource(useCompiledTimeline);
+                BeginTrackedDataCheckpoints();
+            }
 
             var playbackEventsSource = timedObjects;
             if (!(timedObjects is ISortedCollection))
@@ -52,6 +58,9 @@ namespace Melanchall.DryWetMidi.Multimedia
                 calculateTempoMap,
                 useNoteEventsDirectly);
 
+            if (_observableTimedObjectsCollection == null)
+                CompleteTrackedDataCheckpoints();
+
             MoveToNextPlaybackEvent();
         }
 
@@ -114,6 +123,8 @@ namespace Melanchall.DryWetMidi.Multimedia
                     _clock.StopInternally();
                     OnFinished();
                 }
+                else if (isRunning)
+                    ScheduleNextClockTick();
 
                 TraceAction("processed observable collection changed");
             }
@@ -267,11 +278,15 @@ namespace Melanchall.DryWetMidi.Multimedia
             //
 
             var playbackEvents = GetPlaybackEvents(timedObject, tempoMap, useNoteEventsDirectly);
-            var eventsGroup = new HashSet<RedBlackTreeCoordinate<TimeSpan, PlaybackEvent>>();
 
             var minTime = TimeSpan.MaxValue;
             var observablePlaybackSource = _playbackSource as ObservablePlaybackSource;
 
+            // Events groups are needed only to remove events of an object from the tree
+            var eventsGroup = observablePlaybackSource != null
+                ? new HashSet<RedBlackTreeCoordinate<TimeSpan, PlaybackEvent>>()
+                : null;
+
             foreach (var e in playbackEvents)
             {
                 RedBlackTreeCoordinate<TimeSpan, PlaybackEvent> node = null;
@@ -230,6 +230,12 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private void InitializeTrackedData(MidiEvent midiEvent, long time, object metadata)
         {
+            if (_trackedDataChangesBuffer != null)
+            {
+                AddTrackedDataChange(midiEvent, time, metadata);
+                return;
+            }
+
             InitializeProgramChangeData(midiEvent as ProgramChangeEvent, time, metadata);
             InitializePitchBendData(midiEvent as PitchBendEvent, time, metadata);
             InitializeControlData(midiEvent as ControlChangeEvent, time, metadata);
@@ -261,6 +267,13 @@ namespace Melanchall.DryWetMidi.Multimedia
         {
             var convertedTime = TimeConverter.ConvertFrom((MetricTimeSpan)time, TempoMap);
 
+            return _trackedDataCheckpoints != null
+                ? GetEventsAtTimeByCheckpoints(convertedTime, trackedParameterType)
+                : GetEventsAtTimeByTrees(convertedTime, trackedParameterType);
+        }
+
+        private IEnumerable<EventWithMetadata> GetEventsAtTimeByTrees(long convertedTime, TrackedParameterType trackedParameterType)
+        {
             foreach (var getEvents in _getParameterEventsAtTime)
             {
                 if (trackedParameterType.HasFlag(getEvents.Key))
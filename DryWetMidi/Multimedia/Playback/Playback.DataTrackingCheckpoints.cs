@@ -0,0 +1,274 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using Melanchall.DryWetMidi.Common;
+using Melanchall.DryWetMidi.Core;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    public partial class Playback
+    {
+        #region Nested classes
+
+        private struct TrackedDataChange
+        {
+            public long Time;
+            public int Key;
+            public object Change;
+        }
+
+        #endregion
+
+        #region Constants
+
+        private const int ProgramKeysOffset = 0;
+        private const int PitchValueKeysOffset = ProgramKeysOffset + 16;
+        private const int ControlValueKeysOffset = PitchValueKeysOffset + 16;
+        private const int TrackedDataKeysCount = ControlValueKeysOffset + 16 * 128;
+
+        private const int MinTrackedDataCheckpointsSpacing = 64;
+
+        #endregion
+
+        #region Fields
+
+        private List<TrackedDataChange> _trackedDataChangesBuffer;
+
+        private long[] _trackedDataChangesTimes;
+        private int[] _trackedDataChangesSlots;
+        private object[] _trackedDataChangesValues;
+
+        private int[] _trackedDataSlotsKeys;
+        private object[][] _trackedDataCheckpoints;
+        private int _trackedDataCheckpointsSpacing;
+
+        #endregion
+
+        #region Methods
+
+        // Values of tracked parameters can't be changed for a fixed collection of objects,
+        // so instead of trees all changes are stored in a flat timeline along with full
+        // snapshots of parameters values taken every N changes. Values at a time are then
+        // obtained by restoring the nearest preceding snapshot and applying at most N changes
+        // after it
+        private void BeginTrackedDataCheckpoints()
+        {
+            _trackedDataChangesBuffer = new List<TrackedDataChange>();
+        }
+
+        private void CompleteTrackedDataCheckpoints()
+        {
+            var changes = _trackedDataChangesBuffer;
+            _trackedDataChangesBuffer = null;
+
+            // Order of changes at the same time must be preserved, so stable sorting is used
+            if (!IsSortedByTime(changes))
+                changes = changes.OrderBy(c => c.Time).ToList();
+
+            // Program and pitch value are checked for all channels to handle values
+            // produced by callbacks, controls are checked only if present in the data
+            var isKeyUsed = new bool[TrackedDataKeysCount];
+            for (var key = 0; key < ControlValueKeysOffset; key++)
+            {
+                isKeyUsed[key] = true;
+            }
+
+            foreach (var change in changes)
+            {
+                isKeyUsed[change.Key] = true;
+            }
+
+            var keysSlots = new int[TrackedDataKeysCount];
+            var slotsKeys = new List<int>();
+            for (var key = 0; key < TrackedDataKeysCount; key++)
+            {
+                if (!isKeyUsed[key])
+                    continue;
+
+                keysSlots[key] = slotsKeys.Count;
+                slotsKeys.Add(key);
+            }
+
+            _trackedDataSlotsKeys = slotsKeys.ToArray();
+
+            var changesCount = changes.Count;
+            _trackedDataChangesTimes = new long[changesCount];
+            _trackedDataChangesSlots = new int[changesCount];
+            _trackedDataChangesValues = new object[changesCount];
+
+            for (var i = 0; i < changesCount; i++)
+            {
+                var change = changes[i];
+                _trackedDataChangesTimes[i] = change.Time;
+                _trackedDataChangesSlots[i] = keysSlots[change.Key];
+                _trackedDataChangesValues[i] = change.Change;
+            }
+
+            // Spacing not less than slots count keeps snapshots memory linear
+            // in the number of changes
+            var slotsCount = _trackedDataSlotsKeys.Length;
+            var spacing = Math.Max(MinTrackedDataCheckpointsSpacing, slotsCount);
+
+            var checkpoints = new object[changesCount / spacing + 1][];
+            var state = new object[slotsCount];
+
+            for (var i = 0; i < checkpoints.Length; i++)
+            {
+                checkpoints[i] = (object[])state.Clone();
+
+                var lastIndex = Math.Min((i + 1) * spacing, changesCount);
+                for (var j = i * spacing; j < lastIndex; j++)
+                {
+                    state[_trackedDataChangesSlots[j]] = _trackedDataChangesValues[j];
+                }
+            }
+
+            _trackedDataCheckpoints = checkpoints;
+            _trackedDataCheckpointsSpacing = spacing;
+        }
+
+        private void AddTrackedDataChange(MidiEvent midiEvent, long time, object metadata)
+        {
+            var programChangeEvent = midiEvent as ProgramChangeEvent;
+            if (programChangeEvent != null)
+            {
+                AddTrackedDataChange(
+                    time,
+                    ProgramKeysOffset + programChangeEvent.Channel,
+                    new ProgramChange(programChangeEvent.ProgramNumber, metadata));
+                return;
+            }
+
+            var pitchBendEvent = midiEvent as PitchBendEvent;
+            if (pitchBendEvent != null)
+            {
+                AddTrackedDataChange(
+                    time,
+                    PitchValueKeysOffset + pitchBendEvent.Channel,
+                    new PitchValueChange(pitchBendEvent.PitchValue, metadata));
+                return;
+            }
+
+            var controlChangeEvent = midiEvent as ControlChangeEvent;
+            if (controlChangeEvent != null)
+                AddTrackedDataChange(
+                    time,
+                    ControlValueKeysOffset + controlChangeEvent.Channel * 128 + controlChangeEvent.ControlNumber,
+                    new ControlValueChange(controlChangeEvent.ControlValue, metadata));
+        }
+
+        private void AddTrackedDataChange(long time, int key, object change)
+        {
+            _trackedDataChangesBuffer.Add(new TrackedDataChange
+            {
+                Time = time,
+                Key = key,
+                Change = change
+            });
+        }
+
+        private IEnumerable<EventWithMetadata> GetEventsAtTimeByCheckpoints(long time, TrackedParameterType trackedParameterType)
+        {
+            var trackProgram = TrackProgram && trackedParameterType.HasFlag(TrackedParameterType.Program);
+            var trackPitchValue = TrackPitchValue && trackedParameterType.HasFlag(TrackedParameterType.PitchValue);
+            var trackControlValue = TrackControlValue && trackedParameterType.HasFlag(TrackedParameterType.ControlValue);
+
+            if (!trackProgram && !trackPitchValue && !trackControlValue)
+                yield break;
+
+            var times = _trackedDataChangesTimes;
+
+            int firstIndexAtTime;
+            MathUtilities.GetLastElementBelowThreshold(times, time, t => t, out firstIndexAtTime);
+            firstIndexAtTime++;
+
+            int endIndex;
+            MathUtilities.GetFirstElementAboveThreshold(times, time, t => t, out endIndex);
+            if (endIndex < 0)
+                endIndex = times.Length;
+
+            // Checkpoint is selected so that all changes at the time are applied after it,
+            // since parameters changed exactly at the time are not sent (corresponding
+            // events will be played by the playback)
+            var checkpointIndex = firstIndexAtTime / _trackedDataCheckpointsSpacing;
+            var state = (object[])_trackedDataCheckpoints[checkpointIndex].Clone();
+            var isChangedAtTime = new bool[state.Length];
+
+            for (var i = checkpointIndex * _trackedDataCheckpointsSpacing; i < endIndex; i++)
+            {
+                var slot = _trackedDataChangesSlots[i];
+                state[slot] = _trackedDataChangesValues[i];
+                isChangedAtTime[slot] = i >= firstIndexAtTime;
+            }
+
+            for (var slot = 0; slot < state.Length; slot++)
+            {
+                if (isChangedAtTime[slot])
+                    continue;
+
+                var key = _trackedDataSlotsKeys[slot];
+
+                if (key < PitchValueKeysOffset)
+                {
+                    if (!trackProgram)
+                        continue;
+
+                    var channel = (FourBitNumber)(byte)(key - ProgramKeysOffset);
+                    var programChangeAtTime = (ProgramChange)state[slot] ?? DefaultProgramChange;
+
+                    var currentProgramChange = _currentProgramChanges[channel];
+                    if (programChangeAtTime.Data != currentProgramChange?.Data && (currentProgramChange != null || !programChangeAtTime.IsDefault))
+                        yield return new EventWithMetadata(
+                            new ProgramChangeEvent(programChangeAtTime.Data) { Channel = channel },
+                            programChangeAtTime.Metadata);
+                }
+                else if (key < ControlValueKeysOffset)
+                {
+                    if (!trackPitchValue)
+                        continue;
+
+                    var channel = (FourBitNumber)(byte)(key - PitchValueKeysOffset);
+                    var pitchValueChangeAtTime = (PitchValueChange)state[slot] ?? DefaultPitchValueChange;
+
+                    var currentPitchValueChange = _currentPitchValues[channel];
+                    if (pitchValueChangeAtTime.Data != currentPitchValueChange?.Data && (currentPitchValueChange != null || !pitchValueChangeAtTime.IsDefault))
+                        yield return new EventWithMetadata(
+                            new PitchBendEvent(pitchValueChangeAtTime.Data) { Channel = channel },
+                            pitchValueChangeAtTime.Metadata);
+                }
+                else
+                {
+                    if (!trackControlValue)
+                        continue;
+
+                    var channel = (FourBitNumber)(byte)((key - ControlValueKeysOffset) / 128);
+                    var controlNumber = (SevenBitNumber)(byte)((key - ControlValueKeysOffset) % 128);
+                    var controlValueChangeAtTime = (ControlValueChange)state[slot] ?? DefaultControlValueChange;
+
+                    ControlValueChange currentControlValueChange = null;
+                    var currentControlsValuesChangesByControlNumber = _currentControlsValuesChangesByChannel[channel];
+                    if (currentControlsValuesChangesByControlNumber != null)
+                        currentControlsValuesChangesByControlNumber.TryGetValue(controlNumber, out currentControlValueChange);
+
+                    if (controlValueChangeAtTime.Data != currentControlValueChange?.Data && (currentControlValueChange != null || !controlValueChangeAtTime.IsDefault))
+                        yield return new EventWithMetadata(
+                            new ControlChangeEvent(controlNumber, controlValueChangeAtTime.Data) { Channel = channel },
+                            controlValueChangeAtTime.Metadata);
+                }
+            }
+        }
+
+        private static bool IsSortedByTime(List<TrackedDataChange> changes)
+        {
+            for (var i = 1; i < changes.Count; i++)
+            {
+                if (changes[i].Time < changes[i - 1].Time)
+                    return false;
+            }
+
+            return true;
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,134 @@
+﻿using System;
+using Melanchall.DryWetMidi.Core;
+using Melanchall.DryWetMidi.Interaction;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    public partial class Playback
+    {
+        #region Nested classes
+
+        private struct BatchedEvent
+        {
+            public MidiEvent Event;
+            public object Metadata;
+            public Note Note;
+            public Note OriginalNote;
+            public bool IsNoteOn;
+        }
+
+        #endregion
+
+        #region Constants
+
+        private const int EventsBatchSize = 256;
+
+        #endregion
+
+        #region Fields
+
+        private int[] _eventsBatchMessages;
+        private MidiEvent[] _eventsBatchMidiEvents;
+        private BatchedEvent[] _eventsBatch;
+        private int _eventsBatchCount;
+
+        private OutputDevice _eventsBatchOutputDevice;
+
+        #endregion
+
+        #region Methods
+
+        // Events can be batched only within a tick and only if they are allowed
+        // to be sent bypassing TryPlayEvent
+        private void BeginEventsBatch()
+        {
+            _eventsBatchOutputDevice = CanSendEventsDirectly
+                ? OutputDevice as OutputDevice
+                : null;
+
+            if (_eventsBatchOutputDevice == null || _eventsBatch != null)
+                return;
+
+            _eventsBatchMessages = new int[EventsBatchSize];
+            _eventsBatchMidiEvents = new MidiEvent[EventsBatchSize];
+            _eventsBatch = new BatchedEvent[EventsBatchSize];
+        }
+
+        private void EndEventsBatch()
+        {
+            FlushEventsBatch();
+            _eventsBatchOutputDevice = null;
+        }
+
+        private bool TryAddEventToBatch(MidiEvent midiEvent, object metadata, int message)
+        {
+            if (message == 0 || _eventsBatchOutputDevice == null || _scheduledEventTimestamp > 0)
+                return false;
+
+            _eventsBatchMessages[_eventsBatchCount] = message;
+            _eventsBatchMidiEvents[_eventsBatchCount] = midiEvent;
+            _eventsBatch[_eventsBatchCount++] = new BatchedEvent
+            {
+                Event = midiEvent,
+                Metadata = metadata
+            };
+
+            if (_eventsBatchCount == EventsBatchSize)
+                FlushEventsBatch();
+
+            return true;
+        }
+
+        // Notes notifications must follow EventPlayed of the note's event so they
+        // are postponed until the batch is sent if the event is the last one batched
+        private bool TryAddNoteToBatch(MidiEvent midiEvent, Note note, Note originalNote, bool isNoteOn)
+        {
+            if (_eventsBatchCount == 0 || _eventsBatch[_eventsBatchCount - 1].Event != midiEvent)
+                return false;
+
+            _eventsBatch[_eventsBatchCount - 1].Note = note;
+            _eventsBatch[_eventsBatchCount - 1].OriginalNote = originalNote;
+            _eventsBatch[_eventsBatchCount - 1].IsNoteOn = isNoteOn;
+            return true;
+        }
+
+        private void FlushEventsBatch()
+        {
+            var count = _eventsBatchCount;
+            if (count == 0)
+                return;
+
+            _eventsBatchCount = 0;
+
+            var sentCount = 0;
+
+            try
+            {
+                _eventsBatchOutputDevice.SendShortEvents(_eventsBatchMessages, _eventsBatchMidiEvents, count, out sentCount);
+            }
+            catch (Exception e)
+            {
+                OnErrorOccurred(PlaybackErrorSite.PlayEvent, e);
+            }
+
+            for (var i = 0; i < count; i++)
+            {
+                var batchedEvent = _eventsBatch[i];
+
+                if (i < sentCount)
+                {
+                    TraceAction($"played event '{batchedEvent.Event}'");
+                    OnEventPlayed(batchedEvent.Event, batchedEvent.Metadata);
+                }
+
+                if (batchedEvent.Note != null)
+                    OnNotePlayed(batchedEvent.Note, batchedEvent.OriginalNote, batchedEvent.IsNoteOn);
+            }
+
+            Array.Clear(_eventsBatchMidiEvents, 0, count);
+            Array.Clear(_eventsBatch, 0, count);
+        }
+
+        #endregion
+    }
+}
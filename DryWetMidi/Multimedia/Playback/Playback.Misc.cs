@@ -7,6 +7,7 @@ using System.Collections.Generic;
 using System.ComponentModel;
 using System.Diagnostics;
 using System.Linq;
+using System.Reflection;
 using NotePlaybackEventMetadataCollection = Melanchall.DryWetMidi.Common.IntervalTree<System.TimeSpan, Melanchall.DryWetMidi.Multimedia.NotePlaybackEventMetadata>;
 
 namespace Melanchall.DryWetMidi.Multimedia
@@ -93,7 +94,14 @@ namespace Melanchall.DryWetMidi.Multimedia
         private bool _hasBeenStarted;
         private bool _tickHandling;
 
+        private readonly long _scheduledEventsToken = Multimedia.OutputDevice.GetNewScheduledEventsToken();
+        private long _scheduledEventTimestamp;
+        private TimeSpan _scheduledEventsEndTime;
+        private bool _hasScheduledEvents;
+        private TimeSpan _outputLookAhead;
+
         private readonly MidiClock _clock;
+        private readonly bool _isTryPlayEventOverridden;
 
         private readonly ConcurrentDictionary<NoteId, NotePlaybackEventMetadata> _activeNotesMetadata = new ConcurrentDictionary<NoteId, NotePlaybackEventMetadata>();
         private readonly NotePlaybackEventMetadataCollection _notesMetadata = new NotePlaybackEventMetadataCollection();
@@ -131,8 +139,12 @@ namespace Melanchall.DryWetMidi.Multimedia
 
             TempoMap = tempoMap.Clone();
 
+            _isTryPlayEventOverridden = GetType()
+                .GetMethod(nameof(TryPlayEvent), BindingFlags.Instance | BindingFlags.NonPublic, null, new[] { typeof(MidiEvent), typeof(object) }, null)
+                .DeclaringType != typeof(Playback);
+
             var clockSettings = playbackSettings.ClockSettings ?? new MidiClockSettings();
-            _clock = new MidiClock(false, clockSettings.CreateTickGeneratorCallback(), ClockInterval);
+            _clock = new MidiClock(false, clockSettings.CreateTickGeneratorCallback(), ClockInterval, clockSettings.TickingMode);
             _clock.Ticked += OnClockTicked;
 
             InitializeDataTracking();
@@ -141,7 +153,8 @@ namespace Melanchall.DryWetMidi.Multimedia
                 TempoMap,
                 playbackSettings.NoteDetectionSettings ?? new NoteDetectionSettings(),
                 playbackSettings.CalculateTempoMap,
-                playbackSettings.UseNoteEventsDirectly);
+                playbackSettings.UseNoteEventsDirectly,
+                playbackSettings.UseCompiledTimeline);
             UpdateDuration();
         }
 
@@ -229,6 +242,46 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </summary>
         public bool InterruptNotesOnStop { get; set; } = true;
 
+        /// <summary>
+        /// Gets or sets the interval of real time ahead of the current playback time within
+        /// which events are handed to the output device in advance along with the times they
+        /// should be sent at. The default value is <see cref="TimeSpan.Zero"/> which means
+        /// every event is sent by the playback's clock at the time of the event. More info in the
+        /// <see href="xref:a_playback_overview#scheduled-output">Overview: Scheduled output</see> article.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// Scheduling is used only if <see cref="OutputDevice"/> is an instance of the
+        /// <see cref="Multimedia.OutputDevice"/> and only for channel events (see
+        /// <see cref="Multimedia.OutputDevice.ScheduleEvent(MidiEvent, long)"/>). Also it's not used if
+        /// <see cref="CanSendEventsDirectly"/> returns <c>false</c>. Scheduled events are sent
+        /// by the native library at the calculated times so their timing
+        /// doesn't depend on the clock's tick interval and on the load of .NET threads.
+        /// </para>
+        /// <para>
+        /// Note that <see cref="EventPlayed"/> and <see cref="NotesPlaybackStarted"/>/<see cref="NotesPlaybackFinished"/>
+        /// events are fired when an event is scheduled, i.e. up to the specified interval before the event is actually sent.
+        /// Events scheduled but not sent yet are cancelled on <see cref="Stop"/> and on moving playback position.
+        /// Events scheduled on the same device by other playbacks or via <see cref="Multimedia.OutputDevice.ScheduleEvent(MidiEvent, long)"/>
+        /// are not affected.
+        /// </para>
+        /// </remarks>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="value"/> is negative.</exception>
+        public TimeSpan OutputLookAhead
+        {
+            get { return _outputLookAhead; }
+            set
+            {
+                ThrowIfArgument.IsLessThan(nameof(value), value, TimeSpan.Zero, "Look-ahead interval is negative.");
+
+                lock (_playbackLockObject)
+                {
+                    _outputLookAhead = value;
+                    ScheduleNextClockTick();
+                }
+            }
+        }
+
         /// <summary>
         /// Gets or sets a value indicating whether notes must be tracked or not. If <c>false</c>, notes
         /// will be treated as just Note On/Note Off events. The default value is <c>true</c>. More info in the
@@ -295,6 +348,11 @@ namespace Melanchall.DryWetMidi.Multimedia
                 EnsureIsNotDisposed();
 
                 _clock.Speed = value;
+
+                lock (_playbackLockObject)
+                {
+                    ScheduleNextClockTick();
+                }
             }
         }
 
@@ -394,9 +452,27 @@ namespace Melanchall.DryWetMidi.Multimedia
             {
                 _playbackEnd = value;
                 UpdatePlaybackEndMetric();
+
+                lock (_playbackLockObject)
+                {
+                    ScheduleNextClockTick();
+                }
             }
         }
 
+        /// <summary>
+        /// Gets a value indicating whether events can be handed to <see cref="OutputDevice"/> without
+        /// calling <see cref="TryPlayEvent(MidiEvent, object)"/>, i.e. scheduled in advance (see
+        /// <see cref="OutputLookAhead"/>) or sent in batches (see <see cref="PlaybackSettings.UseCompiledTimeline"/>).
+        /// The default value is <c>true</c> unless <see cref="TryPlayEvent(MidiEvent, object)"/> is overridden.
+        /// </summary>
+        /// <remarks>
+        /// If <see cref="TryPlayEvent(MidiEvent, object)"/> is overridden, the property returns <c>false</c>
+        /// so the method is called for every event. Override the property to return <c>true</c> if the
+        /// method doesn't need to see events which can be sent directly.
+        /// </remarks>
+        protected virtual bool CanSendEventsDirectly => !_isTryPlayEventOverridden;
+
 #if TRACE
         internal PlaybackActionsTracer ActionsTracer { get; set; } = new PlaybackActionsTracer();
 
@@ -490,6 +566,13 @@ namespace Melanchall.DryWetMidi.Multimedia
 
             if (!_hasBeenStarted)
                 OnClockTicked(_clock, EventArgs.Empty);
+            else
+            {
+                lock (_playbackLockObject)
+                {
+                    ScheduleNextClockTick();
+                }
+            }
 
             _hasBeenStarted = true;
             OnStarted();
@@ -514,6 +597,11 @@ namespace Melanchall.DryWetMidi.Multimedia
 
             _clock.Stop();
 
+            lock (_playbackLockObject)
+            {
+                CancelScheduledEvents();
+            }
+
             InterruptActiveNotes();
 
             OnStopped();
@@ -789,7 +877,11 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// <returns><c>true</c> if <paramref name="midiEvent"/> was played; otherwise, <c>false</c>.</returns>
         protected virtual bool TryPlayEvent(MidiEvent midiEvent, object metadata)
         {
-            OutputDevice?.SendEvent(midiEvent);
+            var outputDevice = OutputDevice as OutputDevice;
+            if (_scheduledEventTimestamp > 0 && outputDevice != null && Multimedia.OutputDevice.IsShortEvent(midiEvent))
+                outputDevice.ScheduleEvent(midiEvent, _scheduledEventTimestamp, _scheduledEventsToken);
+            else
+                OutputDevice?.SendEvent(midiEvent);
 
             TraceAction($"played event '{midiEvent}'");
             return true;
@@ -996,8 +1088,26 @@ namespace Melanchall.DryWetMidi.Multimedia
                 new NotesEventArgs(notes, originalNotes));
         }
 
+        private void OnNotePlayed(Note note, Note originalNote, bool isNoteOn)
+        {
+            // Arrays for event args are created only if there are subscribers
+            if (isNoteOn)
+            {
+                if (NotesPlaybackStarted != null)
+                    OnNotesPlaybackStarted(new[] { note }, new[] { originalNote });
+            }
+            else
+            {
+                if (NotesPlaybackFinished != null)
+                    OnNotesPlaybackFinished(new[] { note }, new[] { originalNote });
+            }
+        }
+
         private void OnEventPlayed(MidiEvent midiEvent, object metadata)
         {
+            if (EventPlayed == null)
+                return;
+
             HandleEvent(
                 EventPlayed,
                 PlaybackErrorSite.EventPlayed,
@@ -1076,6 +1186,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 
                 try
                 {
+                    BeginEventsBatch();
+
                     do
                     {
                         var time = _clock.CurrentTime;
@@ -1086,8 +1198,14 @@ namespace Melanchall.DryWetMidi.Multimedia
                         if (playbackEvent == null)
                             continue;
 
+                        _scheduledEventTimestamp = 0;
+
                         if (playbackEvent.Time > time)
-                            return;
+                        {
+                            _scheduledEventTimestamp = GetScheduledEventTimestamp(playbackEvent, time);
+                            if (_scheduledEventTimestamp == 0)
+                                return;
+                        }
 
                         var midiEvent = playbackEvent.Event;
                         if (midiEvent == null)
@@ -1098,17 +1216,20 @@ namespace Melanchall.DryWetMidi.Multimedia
 
                         TraceAction($"tick: processing event '{midiEvent}'...");
 
+                        var message = _eventsBatchOutputDevice != null
+                            ? _playbackSource.GetCurrentShortMessage()
+                            : 0;
+
                         Note note;
                         Note originalNote;
 
-                        if (TryPlayNoteEvent(playbackEvent, out note, out originalNote))
+                        if (TryPlayNoteEvent(playbackEvent, message, out note, out originalNote))
                         {
                             if (note != null)
                             {
-                                if (playbackEvent.Event is NoteOnEvent)
-                                    OnNotesPlaybackStarted(new[] { note }, new[] { originalNote });
-                                else
-                                    OnNotesPlaybackFinished(new[] { note }, new[] { originalNote });
+                                var isNoteOn = playbackEvent.Event is NoteOnEvent;
+                                if (!TryAddNoteToBatch(playbackEvent.Event, note, originalNote, isNoteOn))
+                                    OnNotePlayed(note, originalNote, isNoteOn);
                             }
 
                             continue;
@@ -1130,10 +1251,22 @@ namespace Melanchall.DryWetMidi.Multimedia
                         if (midiEvent == null)
                             continue;
 
-                        PlayEvent(midiEvent, playbackEvent.TimedEventMetadata);
+                        PlayEvent(midiEvent, playbackEvent.TimedEventMetadata, midiEvent == playbackEvent.Event ? message : 0);
                     }
                     while (MoveToNextPlaybackEvent());
 
+                    EndEventsBatch();
+
+                    // Playback can't be finished or repeated until all scheduled
+                    // events are sent by the device
+                    if (_hasScheduledEvents)
+                    {
+                        if (_scheduledEventsEndTime > _clock.CurrentTime)
+                            return;
+
+                        _hasScheduledEvents = false;
+                    }
+
                     if (!Loop)
                     {
                         TraceAction("tick: finishing...");
@@ -1163,11 +1296,84 @@ namespace Melanchall.DryWetMidi.Multimedia
                 }
                 finally
                 {
+                    _scheduledEventTimestamp = 0;
+                    EndEventsBatch();
                     _tickHandling = false;
+
+                    try
+                    {
+                        ScheduleNextClockTick();
+                    }
+                    catch (Exception ex)
+                    {
+                        OnErrorOccurred(PlaybackErrorSite.Tick, ex);
+                    }
                 }
             }
         }
 
+        // If the clock's tick generator supports it, the next tick is requested at the time
+        // the tick handler has something to do: the next event should be played or
+        // scheduled, the playback end is reached or the scheduled events are sent
+        private void ScheduleNextClockTick()
+        {
+            if (!_clock.CanScheduleTicks)
+                return;
+
+            var nextTickTime = _playbackEndMetric;
+
+            var playbackEvent = _playbackSource.GetCurrentPlaybackEvent();
+            if (playbackEvent != null)
+            {
+                var eventTime = (TimeSpan)playbackEvent.Time;
+                if (_outputLookAhead > TimeSpan.Zero && CanSendEventsDirectly)
+                    eventTime -= TimeSpan.FromTicks(Math.Min((long)(_outputLookAhead.Ticks * Speed), eventTime.Ticks));
+
+                if (eventTime < nextTickTime)
+                    nextTickTime = eventTime;
+            }
+            else if (!_hasScheduledEvents)
+                nextTickTime = TimeSpan.Zero;
+
+            if (_hasScheduledEvents && _scheduledEventsEndTime < nextTickTime)
+                nextTickTime = _scheduledEventsEndTime;
+
+            _clock.ScheduleTick(nextTickTime);
+        }
+
+        private long GetScheduledEventTimestamp(PlaybackEvent playbackEvent, TimeSpan time)
+        {
+            var outputLookAhead = _outputLookAhead;
+            if (outputLookAhead <= TimeSpan.Zero || !CanSendEventsDirectly || playbackEvent.Time >= _playbackEndMetric)
+                return 0;
+
+            if (!(OutputDevice is OutputDevice) || !Multimedia.OutputDevice.IsShortEvent(playbackEvent.Event))
+                return 0;
+
+            var delay = TimeSpan.FromTicks((long)((playbackEvent.Time - time).Ticks / Speed));
+            if (delay > outputLookAhead)
+                return 0;
+
+            if (playbackEvent.Time > _scheduledEventsEndTime || !_hasScheduledEvents)
+                _scheduledEventsEndTime = playbackEvent.Time;
+
+            _hasScheduledEvents = true;
+
+            // Timestamps are in nanoseconds, TimeSpan's tick is 100 nanoseconds
+            return Math.Max(MidiDevice.GetCurrentTimestamp() + delay.Ticks * 100, 1);
+        }
+
+        private void CancelScheduledEvents()
+        {
+            if (!_hasScheduledEvents)
+                return;
+
+            // Only events scheduled by the current playback are cancelled since the device
+            // can be shared with other playbacks or used directly
+            _hasScheduledEvents = false;
+            (OutputDevice as OutputDevice)?.CancelScheduledEvents(_scheduledEventsToken);
+        }
+
         private void EnsureIsNotDisposed()
         {
             if (_disposed)
@@ -1185,6 +1391,7 @@ namespace Melanchall.DryWetMidi.Multimedia
 
                 var isRunning = IsRunning;
 
+                CancelScheduledEvents();
                 SetStartTime(time);
 
                 if (isRunning)
@@ -1192,6 +1399,7 @@ namespace Melanchall.DryWetMidi.Multimedia
                     SendTrackedData();
                     StopStartNotes();
                     _clock?.Start();
+                    ScheduleNextClockTick();
                 }
 
                 TraceAction("moved to time internally");
@@ -1231,10 +1439,15 @@ namespace Melanchall.DryWetMidi.Multimedia
             MoveToNextPlaybackEvent();
         }
 
-        private void PlayEvent(MidiEvent midiEvent, object metadata)
+        private void PlayEvent(MidiEvent midiEvent, object metadata, int message = 0)
         {
             UpdateCurrentTrackedData(midiEvent, metadata);
 
+            if (TryAddEventToBatch(midiEvent, metadata, message))
+                return;
+
+            FlushEventsBatch();
+
             try
             {
                 if (TryPlayEvent(midiEvent, metadata))
@@ -1256,6 +1469,7 @@ namespace Melanchall.DryWetMidi.Multimedia
             return TryPlayNoteEvent(
                 noteMetadata,
                 null,
+                0,
                 isNoteOnEvent,
                 time,
                 out note,
@@ -1264,12 +1478,14 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         private bool TryPlayNoteEvent(
             PlaybackEvent playbackEvent,
+            int message,
             out Note note,
             out Note originalNote)
         {
             return TryPlayNoteEvent(
                 playbackEvent.NoteMetadata,
                 playbackEvent.Event,
+                message,
                 playbackEvent.Event is NoteOnEvent,
                 playbackEvent.Time,
                 out note,
@@ -1279,6 +1495,7 @@ namespace Melanchall.DryWetMidi.Multimedia
         private bool TryPlayNoteEvent(
             NotePlaybackEventMetadata noteMetadata,
             MidiEvent midiEvent,
+            int message,
             bool isNoteOnEvent,
             TimeSpan time,
             out Note note,
@@ -1287,6 +1504,8 @@ namespace Melanchall.DryWetMidi.Multimedia
             note = null;
             originalNote = null;
 
+            var sourceMidiEvent = midiEvent;
+
             if (noteMetadata == null)
                 return false;
 
@@ -1357,7 +1576,7 @@ namespace Melanchall.DryWetMidi.Multimedia
                 }
 
                 var timedObjectWithMetadata = isNoteOnEvent ? noteMetadata.RawNote.TimedNoteOnEvent : noteMetadata.RawNote.TimedNoteOffEvent;
-                PlayEvent(midiEvent, (timedObjectWithMetadata as IMetadata)?.Metadata);
+                PlayEvent(midiEvent, (timedObjectWithMetadata as IMetadata)?.Metadata, midiEvent == sourceMidiEvent ? message : 0);
             }
             else
             {
@@ -41,6 +41,27 @@ namespace Melanchall.DryWetMidi.Multimedia
         /// </remarks>
         public bool CalculateTempoMap { get; set; }
 
+        /// <summary>
+        /// Gets or sets a value indicating whether events of a playback should be compiled into
+        /// a timeline of packed MIDI messages on data initializing. The default value is <c>false</c>.
+        /// More info in the <see href="xref:a_playback_overview#compiled-timeline">Overview: Compiled timeline</see> article.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// The timeline is used only if the <see cref="Playback"/> is created with a collection of objects which is not
+        /// <see cref="IObservableTimedObjectsCollection"/>. Channel and system real-time events which fire together
+        /// are then sent to <see cref="Playback.OutputDevice"/> in batches (by a single call to the operating system)
+        /// without packing them on every tick. Batches are used only if the output device is an instance of
+        /// <see cref="OutputDevice"/>, <see cref="Playback.CanSendEventsDirectly"/> returns <c>true</c>
+        /// and an event is not changed by <see cref="Playback.EventCallback"/> or <see cref="Playback.NoteCallback"/>.
+        /// </para>
+        /// <para>
+        /// Since events are packed on data initializing, changes of the MIDI events made after the playback is
+        /// created don't affect the data sent to the device.
+        /// </para>
+        /// </remarks>
+        public bool UseCompiledTimeline { get; set; }
+
         internal bool UseNoteEventsDirectly { get; set; }
 
         #endregion
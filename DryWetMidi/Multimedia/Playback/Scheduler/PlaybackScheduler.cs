@@ -0,0 +1,210 @@
+﻿using System;
+using System.Diagnostics;
+using System.Linq;
+using Melanchall.DryWetMidi.Common;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    /// <summary>
+    /// Drives many instances of the <see cref="Playback"/> (or any other objects using <see cref="MidiClock"/>)
+    /// from a small pool of timing threads. More info in the
+    /// <see href="xref:a_playback_overview#shared-scheduler">Overview: Shared scheduler</see> article.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Every clock normally owns its own tick generator which fires at the clock's interval regardless
+    /// of whether there is something to do, so CPU load grows with the number of clocks. Tick generators
+    /// created by <see cref="CreateTickGenerator"/> are distributed among the scheduler's threads, and each
+    /// thread keeps deadlines of its tick generators in a hierarchical timer wheel sleeping until the
+    /// earliest one. <see cref="Playback"/> driven by such a tick generator requests a tick exactly at the
+    /// time of the next event to play, so CPU load grows with the number of events rather than with
+    /// the number of playbacks.
+    /// </para>
+    /// <para>
+    /// A thread sleeps until a deadline is close and spins for the rest of the interval, which is less
+    /// than a millisecond. Sleeping is as precise as the system timer resolution allows, so on Windows
+    /// the scheduler raises the resolution to the minimum supported one (usually 1 ms instead of the
+    /// default 15.6 ms) for its lifetime; accuracy of ticks is about a millisecond then. Handlers of ticks (for example, playback's events callbacks) are executed on the
+    /// scheduler's threads, so long-running handlers delay other clocks served by the same thread.
+    /// Exceptions thrown by handlers are reported via the <see cref="ErrorOccurred"/> event.
+    /// </para>
+    /// </remarks>
+    /// <example>
+    /// <code language="csharp">
+    /// using (var scheduler = new PlaybackScheduler())
+    /// {
+    ///     var playbackSettings = new PlaybackSettings
+    ///     {
+    ///         ClockSettings = new MidiClockSettings
+    ///         {
+    ///             CreateTickGeneratorCallback = scheduler.CreateTickGenerator
+    ///         }
+    ///     };
+    ///
+    ///     var playbacks = midiFiles
+    ///         .Select(f => f.GetPlayback(outputDevice, playbackSettings))
+    ///         .ToArray();
+    ///
+    ///     // ...
+    /// }
+    /// </code>
+    /// </example>
+    public sealed class PlaybackScheduler : IDisposable
+    {
+        #region Events
+
+        /// <summary>
+        /// Occurs when a handler of a tick generated by the scheduler has thrown an exception.
+        /// </summary>
+        /// <remarks>
+        /// The event is raised on the scheduler's thread which has executed the handler.
+        /// </remarks>
+        public event EventHandler<ErrorOccurredEventArgs> ErrorOccurred;
+
+        #endregion
+
+        #region Fields
+
+        private readonly Stopwatch _stopwatch = Stopwatch.StartNew();
+        private readonly PlaybackSchedulerWorker[] _workers;
+        private readonly object _lockObject = new object();
+        private readonly uint? _timerPeriod;
+
+        private bool _disposed = false;
+
+        #endregion
+
+        #region Constructor
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="PlaybackScheduler"/> with a thread
+        /// per processor.
+        /// </summary>
+        /// <exception cref="TickGeneratorException">Failed to raise the system timer resolution.</exception>
+        public PlaybackScheduler()
+            : this(Environment.ProcessorCount)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="PlaybackScheduler"/> with the specified
+        /// number of threads.
+        /// </summary>
+        /// <param name="threadsCount">Number of threads to drive clocks.</param>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="threadsCount"/> is zero or negative.</exception>
+        /// <exception cref="TickGeneratorException">Failed to raise the system timer resolution.</exception>
+        public PlaybackScheduler(int threadsCount)
+        {
+            ThrowIfArgument.IsNonpositive(nameof(threadsCount), threadsCount, "Threads count is zero or negative.");
+
+            if (CommonApiProvider.Api.Api_GetApiType() == CommonApi.API_TYPE.API_TYPE_WIN)
+            {
+                uint timerPeriod;
+                NativeApiUtilities.HandleTickGeneratorNativeApiResult(
+                    TickGeneratorApiProvider.Api.Api_BeginTimerPeriod_Win(out timerPeriod));
+                _timerPeriod = timerPeriod;
+            }
+
+            _workers = Enumerable
+                .Range(0, threadsCount)
+                .Select(i => new PlaybackSchedulerWorker(this, i))
+                .ToArray();
+        }
+
+        #endregion
+
+        #region Properties
+
+        /// <summary>
+        /// Gets the number of threads used by the current scheduler.
+        /// </summary>
+        public int ThreadsCount => _workers.Length;
+
+        #endregion
+
+        #region Methods
+
+        /// <summary>
+        /// Creates a tick generator driven by the current scheduler. The method can be
+        /// used as <see cref="MidiClockSettings.CreateTickGeneratorCallback"/>.
+        /// </summary>
+        /// <returns>A tick generator driven by the current scheduler.</returns>
+        /// <exception cref="ObjectDisposedException">The current <see cref="PlaybackScheduler"/> is disposed.</exception>
+        public TickGenerator CreateTickGenerator()
+        {
+            lock (_lockObject)
+            {
+                EnsureIsNotDisposed();
+
+                var worker = _workers.OrderBy(w => w.TickGeneratorsCount).First();
+                return new ScheduledTickGenerator(worker);
+            }
+        }
+
+        internal long GetTime()
+        {
+            return _stopwatch.Elapsed.Ticks;
+        }
+
+        internal void OnErrorOccurred(Exception exception)
+        {
+            var eventHandler = ErrorOccurred;
+            if (eventHandler == null)
+                return;
+
+            var eventArgs = new ErrorOccurredEventArgs(exception);
+
+            foreach (EventHandler<ErrorOccurredEventArgs> handler in eventHandler.GetInvocationList())
+            {
+                try
+                {
+                    handler?.Invoke(this, eventArgs);
+                }
+                catch
+                {
+                }
+            }
+        }
+
+        private void EnsureIsNotDisposed()
+        {
+            if (_disposed)
+                throw new ObjectDisposedException("Playback scheduler is disposed.");
+        }
+
+        #endregion
+
+        #region IDisposable
+
+        /// <summary>
+        /// Releases all resources used by the current <see cref="PlaybackScheduler"/>. Tick
+        /// generators created by the scheduler stop ticking.
+        /// </summary>
+        /// <remarks>
+        /// The method waits for the scheduler's threads to finish, so tick handlers being executed
+        /// complete before the method returns (unless it's called by a tick handler).
+        /// </remarks>
+        public void Dispose()
+        {
+            lock (_lockObject)
+            {
+                if (_disposed)
+                    return;
+
+                _disposed = true;
+            }
+
+            // Workers are disposed outside of the lock since a tick handler being waited
+            // for can create a tick generator
+            foreach (var worker in _workers)
+            {
+                worker.Dispose();
+            }
+
+            if (_timerPeriod != null)
+                TickGeneratorApiProvider.Api.Api_EndTimerPeriod_Win(_timerPeriod.Value);
+        }
+
+        #endregion
+    }
+}
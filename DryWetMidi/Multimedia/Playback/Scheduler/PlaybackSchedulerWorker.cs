@@ -0,0 +1,210 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+using Melanchall.DryWetMidi.Common;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    internal sealed class PlaybackSchedulerWorker : IDisposable
+    {
+        #region Constants
+
+        private static readonly long TimerWheelResolution = TimeSpan.FromTicks(TimeSpan.TicksPerMillisecond / 4).Ticks;
+        private static readonly long SpinThreshold = TimeSpan.FromTicks(TimeSpan.TicksPerMillisecond / 2).Ticks;
+
+        #endregion
+
+        #region Fields
+
+        private readonly PlaybackScheduler _scheduler;
+        private readonly TimerWheel<ScheduledTickGenerator> _timerWheel;
+        private readonly Thread _thread;
+        private readonly object _lockObject = new object();
+
+        private int _tickGeneratorsCount;
+        private bool _disposed = false;
+
+        #endregion
+
+        #region Constructor
+
+        public PlaybackSchedulerWorker(PlaybackScheduler scheduler, int index)
+        {
+            _scheduler = scheduler;
+            _timerWheel = new TimerWheel<ScheduledTickGenerator>(TimerWheelResolution, scheduler.GetTime());
+
+            _thread = new Thread(Run)
+            {
+                Name = $"DryWetMIDI playback scheduler {index}",
+                IsBackground = true,
+                Priority = ThreadPriority.Highest
+            };
+            _thread.Start();
+        }
+
+        #endregion
+
+        #region Properties
+
+        public int TickGeneratorsCount => Volatile.Read(ref _tickGeneratorsCount);
+
+        #endregion
+
+        #region Methods
+
+        public void AddTickGenerator()
+        {
+            Interlocked.Increment(ref _tickGeneratorsCount);
+        }
+
+        public void RemoveTickGenerator()
+        {
+            Interlocked.Decrement(ref _tickGeneratorsCount);
+        }
+
+        public void StartTickGenerator(ScheduledTickGenerator tickGenerator, TimeSpan interval)
+        {
+            lock (_lockObject)
+            {
+                if (_disposed)
+                    throw new ObjectDisposedException("Playback scheduler is disposed.");
+
+                tickGenerator.Interval = interval;
+                tickGenerator.IsActive = true;
+
+                // Tick generator with zero interval is started in one-shot mode and
+                // ticks only when a tick is scheduled
+                if (interval > TimeSpan.Zero)
+                    AddToTimerWheel(tickGenerator, interval.Ticks);
+            }
+        }
+
+        public void StopTickGenerator(ScheduledTickGenerator tickGenerator)
+        {
+            lock (_lockObject)
+            {
+                tickGenerator.IsActive = false;
+                _timerWheel.Remove(tickGenerator.Node);
+            }
+        }
+
+        public void ScheduleTick(ScheduledTickGenerator tickGenerator, TimeSpan delay)
+        {
+            lock (_lockObject)
+            {
+                if (!tickGenerator.IsActive)
+                    return;
+
+                AddToTimerWheel(tickGenerator, delay.Ticks);
+            }
+        }
+
+        private void AddToTimerWheel(ScheduledTickGenerator tickGenerator, long delay)
+        {
+            _timerWheel.Add(tickGenerator.Node, _scheduler.GetTime() + delay);
+
+            // The thread must recalculate its waiting time unless the call is made
+            // by a tick handler executed on the thread
+            if (Thread.CurrentThread != _thread)
+                Monitor.Pulse(_lockObject);
+        }
+
+        private void Run()
+        {
+            var expiredNodes = new List<TimerWheelNode<ScheduledTickGenerator>>();
+
+            lock (_lockObject)
+            {
+                while (!_disposed)
+                {
+                    var time = _scheduler.GetTime();
+                    _timerWheel.Advance(time, expiredNodes);
+
+                    if (expiredNodes.Count > 0)
+                    {
+                        // Tick generator ticks at its interval until the next tick is
+                        // scheduled explicitly (usually by the tick handler)
+                        foreach (var node in expiredNodes)
+                        {
+                            var tickGenerator = node.Value;
+                            if (tickGenerator.IsActive && tickGenerator.Interval > TimeSpan.Zero)
+                                _timerWheel.Add(node, time + tickGenerator.Interval.Ticks);
+                        }
+
+                        Monitor.Exit(_lockObject);
+
+                        try
+                        {
+                            foreach (var node in expiredNodes)
+                            {
+                                OnTickGeneratorExpired(node.Value);
+                            }
+                        }
+                        finally
+                        {
+                            Monitor.Enter(_lockObject);
+                        }
+
+                        expiredNodes.Clear();
+                        continue;
+                    }
+
+                    var nextAdvanceTime = _timerWheel.GetNextAdvanceTime();
+                    if (nextAdvanceTime == null)
+                    {
+                        Monitor.Wait(_lockObject);
+                        continue;
+                    }
+
+                    // Waiting is possible with millisecond precision only, so the thread sleeps
+                    // at least a millisecond if there is enough time and spins otherwise. Spinning
+                    // is limited by the fixed threshold so CPU load doesn't depend on the system
+                    // timer resolution (which is raised by the scheduler on Windows)
+                    var remainingTime = nextAdvanceTime.Value - time;
+                    if (remainingTime > SpinThreshold)
+                        Monitor.Wait(_lockObject, (int)Math.Min(Math.Max((remainingTime - SpinThreshold) / TimeSpan.TicksPerMillisecond, 1), int.MaxValue));
+                    else
+                    {
+                        Monitor.Exit(_lockObject);
+                        Thread.Yield();
+                        Monitor.Enter(_lockObject);
+                    }
+                }
+            }
+        }
+
+        private void OnTickGeneratorExpired(ScheduledTickGenerator tickGenerator)
+        {
+            try
+            {
+                tickGenerator.OnExpired();
+            }
+            catch (Exception ex)
+            {
+                // Exception thrown by a tick handler must not stop other tick generators
+                // of the thread, so it's reported via the scheduler's event
+                _scheduler.OnErrorOccurred(ex);
+            }
+        }
+
+        #endregion
+
+        #region IDisposable
+
+        public void Dispose()
+        {
+            lock (_lockObject)
+            {
+                _disposed = true;
+                Monitor.Pulse(_lockObject);
+            }
+
+            // Thread can't be joined if the worker is disposed by a tick handler executed
+            // on it, the thread finishes right after the handler returns in this case
+            if (Thread.CurrentThread != _thread)
+                _thread.Join();
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,101 @@
+﻿using System;
+using Melanchall.DryWetMidi.Common;
+
+namespace Melanchall.DryWetMidi.Multimedia
+{
+    internal sealed class ScheduledTickGenerator : TickGenerator
+    {
+        #region Fields
+
+        private readonly PlaybackSchedulerWorker _worker;
+
+        private bool _disposed = false;
+
+        #endregion
+
+        #region Constructor
+
+        public ScheduledTickGenerator(PlaybackSchedulerWorker worker)
+        {
+            _worker = worker;
+            _worker.AddTickGenerator();
+
+            Node = new TimerWheelNode<ScheduledTickGenerator>(this);
+        }
+
+        #endregion
+
+        #region Properties
+
+        public TimerWheelNode<ScheduledTickGenerator> Node { get; }
+
+        // Fields below are guarded by the worker's lock
+        public TimeSpan Interval { get; set; }
+
+        public bool IsActive { get; set; }
+
+        internal override bool CanScheduleTicks => true;
+
+        internal override bool CanTickOneShot => true;
+
+        #endregion
+
+        #region Methods
+
+        public void OnExpired()
+        {
+            if (_disposed)
+                return;
+
+            GenerateTick();
+        }
+
+        internal override void ScheduleTick(TimeSpan delay)
+        {
+            _worker.ScheduleTick(this, delay);
+        }
+
+        internal override void StartOneShot()
+        {
+            _worker.StartTickGenerator(this, TimeSpan.Zero);
+        }
+
+        #endregion
+
+        #region Overrides
+
+        protected override void Start(TimeSpan interval)
+        {
+            ThrowIfArgument.IsOutOfRange(
+                nameof(interval),
+                interval,
+                HighPrecisionTickGenerator.MinSubMillisecondInterval,
+                HighPrecisionTickGenerator.MaxInterval,
+                $"Interval is out of [{HighPrecisionTickGenerator.MinSubMillisecondInterval}, {HighPrecisionTickGenerator.MaxInterval}] range.");
+
+            _worker.StartTickGenerator(this, interval);
+        }
+
+        protected override void Stop()
+        {
+            _worker.StopTickGenerator(this);
+        }
+
+        #endregion
+
+        #region IDisposable
+
+        protected override void Dispose(bool disposing)
+        {
+            if (_disposed)
+                return;
+
+            _worker.StopTickGenerator(this);
+            _worker.RemoveTickGenerator();
+
+            _disposed = true;
+        }
+
+        #endregion
+    }
+}
@@ -9,13 +9,26 @@ namespace Melanchall.DryWetMidi.Multimedia
     {
         #region Fields
 
+        private readonly bool _compileTimeline;
+
         private readonly IList<PlaybackEvent> _playbackEventsBuffer = new List<PlaybackEvent>();
         private PlaybackEvent[] _playbackEvents = null;
+        private long[] _playbackEventsTimes = null;
+        private int[] _shortMessages = null;
         private int _playbackEventsPosition = -1;
         private bool _isCompleted;
 
         #endregion
 
+        #region Constructor
+
+        public FixedPlaybackSource(bool compileTimeline)
+        {
+            _compileTimeline = compileTimeline;
+        }
+
+        #endregion
+
         #region Methods
 
         private TimeSpan ScaleTimeSpan(TimeSpan timeSpan, double scaleFactor)
@@ -35,6 +48,20 @@ namespace Melanchall.DryWetMidi.Multimedia
         public void CompleteSource()
         {
             _playbackEvents = _playbackEventsBuffer.OrderBy(e => e, new PlaybackEventsComparer()).ToArray();
+            _playbackEventsTimes = new long[_playbackEvents.Length];
+
+            if (_compileTimeline)
+                _shortMessages = new int[_playbackEvents.Length];
+
+            for (var i = 0; i < _playbackEvents.Length; i++)
+            {
+                var playbackEvent = _playbackEvents[i];
+                _playbackEventsTimes[i] = playbackEvent.Time.Time.Ticks;
+
+                if (_shortMessages != null && playbackEvent.Event != null)
+                    _shortMessages[i] = OutputDevice.GetShortEventMessage(playbackEvent.Event);
+            }
+
             _isCompleted = true;
             _playbackEventsBuffer.Clear();
         }
@@ -46,18 +73,25 @@ namespace Melanchall.DryWetMidi.Multimedia
                 : null;
         }
 
+        public int GetCurrentShortMessage()
+        {
+            return _shortMessages != null && IsPositionValid()
+                ? _shortMessages[_playbackEventsPosition]
+                : 0;
+        }
+
         public PlaybackEvent GetLastPlaybackEvent()
         {
-            return IsEmpty() ? null : _playbackEvents.Last();
+            return IsEmpty() ? null : _playbackEvents[_playbackEvents.Length - 1];
         }
 
         public SnapPoint GetNextSnapPoint(TimeSpan fromTime, Func<PlaybackEvent, SnapPoint> getSnapPoint)
         {
             int i;
             MathUtilities.GetFirstElementAboveThreshold(
-                _playbackEvents,
+                _playbackEventsTimes,
                 fromTime.Ticks,
-                e => e.Time.Time.Ticks,
+                t => t,
                 out i);
 
             for (; i < _playbackEvents.Length; i++)
@@ -74,9 +108,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         {
             int i;
             MathUtilities.GetLastElementBelowThreshold(
-                _playbackEvents,
+                _playbackEventsTimes,
                 fromTime.Ticks,
-                e => e.Time.Time.Ticks,
+                t => t,
                 out i);
 
             for (; i >= 0; i--)
@@ -105,7 +139,7 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public bool IsEmpty()
         {
-            return !_playbackEvents.Any();
+            return _playbackEvents.Length == 0;
         }
 
         public bool IsPositionValid()
@@ -121,9 +155,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         public void MoveToLastPositionBelowThreshold(TimeSpan threshold, ref bool beforeStart)
         {
             MathUtilities.GetLastElementBelowThreshold(
-                _playbackEvents,
-                threshold,
-                e => e.Time.Time,
+                _playbackEventsTimes,
+                threshold.Ticks,
+                t => t,
                 out _playbackEventsPosition);
 
             if (_playbackEventsPosition == -1)
@@ -133,9 +167,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         public void ResetPosition(TimeSpan playbackStart, ref bool beforeStart)
         {
             MathUtilities.GetLastElementBelowThreshold(
-                _playbackEvents,
-                playbackStart,
-                e => e.Time.Time,
+                _playbackEventsTimes,
+                playbackStart.Ticks,
+                t => t,
                 out _playbackEventsPosition);
 
             if (_playbackEventsPosition == -1)
@@ -24,6 +24,10 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         PlaybackEvent GetCurrentPlaybackEvent();
 
+        // Returns packed short message of the current event if the source has
+        // precompiled it, or zero otherwise
+        int GetCurrentShortMessage();
+
         PlaybackEvent GetLastPlaybackEvent();
 
         SnapPoint GetNextSnapPoint(TimeSpan fromTime, Func<PlaybackEvent, SnapPoint> getSnapPoint);
@@ -97,6 +97,11 @@ namespace Melanchall.DryWetMidi.Multimedia
                 : null;
         }
 
+        public int GetCurrentShortMessage()
+        {
+            return 0;
+        }
+
         public PlaybackEvent GetLastPlaybackEvent()
         {
             return _playbackEvents.GetMaximumCoordinate()?.Value;
@@ -34,11 +34,21 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         #endregion
 
+        #region Constants
+
+        private const long NanosecondsInTick = 100;
+
+        #endregion
+
         #region Fields
 
         private readonly List<RecordingEvent> _events = new List<RecordingEvent>();
         private readonly Stopwatch _stopwatch = new Stopwatch();
 
+        private TimeSpan _startTime;
+        private long? _startTimestamp;
+        private TimeSpan _lastEventTime;
+
         private bool _disposed = false;
 
         #endregion
@@ -145,6 +155,13 @@ namespace Melanchall.DryWetMidi.Multimedia
             if (!InputDevice.IsListeningForEvents)
                 throw new InvalidOperationException($"Input device is not listening for MIDI events. Call {nameof(InputDevice.StartEventsListening)} prior to start recording.");
 
+            // Events received by input device are stamped by the native API, so the start time
+            // is taken from the same clock to calculate events times without managed delays
+            _startTime = _stopwatch.Elapsed;
+            _startTimestamp = InputDevice is InputDevice
+                ? MidiDevice.GetCurrentTimestamp()
+                : (long?)null;
+
             _stopwatch.Start();
             OnStarted();
         }
@@ -177,11 +194,26 @@ namespace Melanchall.DryWetMidi.Multimedia
             if (!IsRunning)
                 return;
 
-            _events.Add(new RecordingEvent(e.Event, _stopwatch.Elapsed));
+            _events.Add(new RecordingEvent(e.Event, GetEventTime(e.Timestamp)));
 
             OnEventRecorded(e.Event);
         }
 
+        private TimeSpan GetEventTime(long? timestamp)
+        {
+            var time = timestamp != null && _startTimestamp != null
+                ? _startTime + TimeSpan.FromTicks(Math.Max(timestamp.Value - _startTimestamp.Value, 0) / NanosecondsInTick)
+                : _stopwatch.Elapsed;
+
+            // Recorded events must go in order of receiving, so a time can't be less than
+            // the time of the previous event
+            if (time < _lastEventTime)
+                time = _lastEventTime;
+
+            _lastEventTime = time;
+            return time;
+        }
+
         private void OnEventRecorded(MidiEvent midiEvent)
         {
             EventRecorded?.Invoke(this, new MidiEventRecordedEventArgs(midiEvent));
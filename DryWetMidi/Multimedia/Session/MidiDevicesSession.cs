@@ -52,6 +52,11 @@ namespace Melanchall.DryWetMidi.Multimedia
                             case CommonApi.API_TYPE.API_TYPE_WIN:
                                 result = MidiDevicesSessionApiProvider.Api.Api_OpenSession_Win(_name, out _handle);
                                 break;
+                            case CommonApi.API_TYPE.API_TYPE_LINUX:
+                                _inputDeviceCallback = InputDeviceCallback;
+                                _outputDeviceCallback = OutputDeviceCallback;
+                                result = MidiDevicesSessionApiProvider.Api.Api_OpenSession_Linux(_name, _inputDeviceCallback, _outputDeviceCallback, out _handle);
+                                break;
                         }
 
                         NativeApiUtilities.HandleDevicesNativeApiResult(result);
@@ -41,6 +41,12 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public abstract SESSION_OPENRESULT Api_OpenSession_Win(IntPtr name, out IntPtr handle);
 
+        public abstract SESSION_OPENRESULT Api_OpenSession_Linux(
+            IntPtr name,
+            InputDeviceCallback inputDeviceCallback,
+            OutputDeviceCallback outputDeviceCallback,
+            out IntPtr handle);
+
         public abstract SESSION_CLOSERESULT Api_CloseSession(IntPtr handle);
 
         #endregion
@@ -19,6 +19,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern SESSION_OPENRESULT OpenSession_Win(IntPtr name, out IntPtr handle);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern SESSION_OPENRESULT OpenSession_Linux(IntPtr name, InputDeviceCallback inputDeviceCallback, OutputDeviceCallback outputDeviceCallback, out IntPtr handle);
+
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern SESSION_CLOSERESULT CloseSession(IntPtr handle);
 
@@ -40,6 +43,15 @@ namespace Melanchall.DryWetMidi.Multimedia
             return OpenSession_Win(name, out handle);
         }
 
+        public override SESSION_OPENRESULT Api_OpenSession_Linux(
+            IntPtr name,
+            InputDeviceCallback inputDeviceCallback,
+            OutputDeviceCallback outputDeviceCallback,
+            out IntPtr handle)
+        {
+            return OpenSession_Linux(name, inputDeviceCallback, outputDeviceCallback, out handle);
+        }
+
         public override SESSION_CLOSERESULT Api_CloseSession(IntPtr handle)
         {
             return CloseSession(handle);
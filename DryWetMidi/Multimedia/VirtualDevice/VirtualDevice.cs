@@ -53,6 +53,7 @@ namespace Melanchall.DryWetMidi.Multimedia
         private readonly string _name;
 
         private VirtualDeviceApi.Callback_Mac _callback_Mac;
+        private VirtualDeviceApi.Callback_Linux _callback_Linux;
 
         private VirtualDeviceHandle _handle = null;
 
@@ -71,6 +72,9 @@ namespace Melanchall.DryWetMidi.Multimedia
                 case CommonApi.API_TYPE.API_TYPE_MAC:
                     InitializeDevice_Mac();
                     break;
+                case CommonApi.API_TYPE.API_TYPE_LINUX:
+                    InitializeDevice_Linux();
+                    break;
             }
         }
 
@@ -113,13 +117,23 @@ namespace Melanchall.DryWetMidi.Multimedia
             ThrowIfArgument.IsNullOrWhiteSpaceString(nameof(name), name, "Device name");
 
             var apiType = CommonApiProvider.Api.Api_GetApiType();
-            if (apiType != CommonApi.API_TYPE.API_TYPE_MAC)
+            if (apiType != CommonApi.API_TYPE.API_TYPE_MAC && apiType != CommonApi.API_TYPE.API_TYPE_LINUX)
                 throw new NotSupportedException("Virtual device creation is not supported on the current operating system.");
 
             return new VirtualDevice(name);
         }
 
         private void OnMessage_Mac(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon)
+        {
+            SendDataBack(pktlist, readProcRefCon);
+        }
+
+        private void OnMessage_Linux(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon)
+        {
+            SendDataBack(pktlist, readProcRefCon);
+        }
+
+        private void SendDataBack(IntPtr pktlist, IntPtr readProcRefCon)
         {
             if (!IsEnabled)
                 return;
@@ -142,6 +156,24 @@ namespace Melanchall.DryWetMidi.Multimedia
             NativeApiUtilities.HandleDevicesNativeApiResult(
                 VirtualDeviceApiProvider.Api.Api_OpenDevice_Mac(Name, sessionHandle, _callback_Mac, out deviceInfo));
 
+            InitializeSubdevices(deviceInfo);
+        }
+
+        private void InitializeDevice_Linux()
+        {
+            var sessionHandle = MidiDevicesSession.GetSessionHandle();
+
+            _callback_Linux = OnMessage_Linux;
+
+            var deviceInfo = IntPtr.Zero;
+            NativeApiUtilities.HandleDevicesNativeApiResult(
+                VirtualDeviceApiProvider.Api.Api_OpenDevice_Linux(Name, sessionHandle, _callback_Linux, out deviceInfo));
+
+            InitializeSubdevices(deviceInfo);
+        }
+
+        private void InitializeSubdevices(IntPtr deviceInfo)
+        {
             var inputDeviceInfo = VirtualDeviceApiProvider.Api.Api_GetInputDeviceInfo(deviceInfo);
             InputDevice = new InputDevice(inputDeviceInfo, CreationContext.VirtualDevice);
 
@@ -53,6 +53,7 @@ namespace Melanchall.DryWetMidi.Multimedia
         #region Delegates
 
         public delegate void Callback_Mac(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon);
+        public delegate void Callback_Linux(IntPtr pktlist, IntPtr readProcRefCon, IntPtr srcConnRefCon);
 
         #endregion
 
@@ -60,6 +61,8 @@ namespace Melanchall.DryWetMidi.Multimedia
 
         public abstract VIRTUAL_OPENRESULT Api_OpenDevice_Mac(string name, IntPtr sessionHandle, Callback_Mac callback, out IntPtr info);
 
+        public abstract VIRTUAL_OPENRESULT Api_OpenDevice_Linux(string name, IntPtr sessionHandle, Callback_Linux callback, out IntPtr info);
+
         public abstract VIRTUAL_CLOSERESULT Api_CloseDevice(IntPtr info);
 
         public abstract VIRTUAL_SENDBACKRESULT Api_SendDataBack(IntPtr pktlist, IntPtr readProcRefCon);
@@ -16,6 +16,9 @@ namespace Melanchall.DryWetMidi.Multimedia
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern VIRTUAL_OPENRESULT OpenVirtualDevice_Mac(IntPtr name, IntPtr sessionHandle, Callback_Mac callback, out IntPtr info);
 
+        [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
+        private static extern VIRTUAL_OPENRESULT OpenVirtualDevice_Linux(IntPtr name, IntPtr sessionHandle, Callback_Linux callback, out IntPtr info);
+
         [DllImport(LibraryName, ExactSpelling = true, CallingConvention = CallingConvention.StdCall)]
         private static extern VIRTUAL_CLOSERESULT CloseVirtualDevice(IntPtr info);
 
@@ -38,6 +41,12 @@ namespace Melanchall.DryWetMidi.Multimedia
             return OpenVirtualDevice_Mac(namePointer, sessionHandle, callback, out info);
         }
 
+        public override VIRTUAL_OPENRESULT Api_OpenDevice_Linux(string name, IntPtr sessionHandle, Callback_Linux callback, out IntPtr info)
+        {
+            var namePointer = Marshal.StringToHGlobalAnsi(name);
+            return OpenVirtualDevice_Linux(namePointer, sessionHandle, callback, out info);
+        }
+
         public override VIRTUAL_CLOSERESULT Api_CloseDevice(IntPtr info)
         {
             return CloseVirtualDevice(info);
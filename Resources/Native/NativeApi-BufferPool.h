@@ -0,0 +1,186 @@
+#ifndef NATIVEAPI_BUFFERPOOL_H
+#define NATIVEAPI_BUFFERPOOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+/* ================================
+   Buffer pool
+================================ */
+
+// Fixed set of equally sized slabs handed out for SysEx data. Slab memory is
+// allocated on first use and then reused, free slabs are kept in a stack so
+// the most recently released (and thus cache-hot) slab is taken first. If a
+// request is larger than a slab or all slabs are in use, a standalone buffer
+// is allocated from the heap and freed on release; such requests are counted
+// as exhaustions. The pool has no platform dependencies and can be used by
+// any backend. All functions are thread-safe.
+
+#define BUFFERPOOL_DEFAULTSLABSIZE (64 * 1024)
+#define BUFFERPOOL_DEFAULTSLABSCOUNT 8
+
+struct BufferPoolBuffer
+{
+    unsigned char* data;
+    uint32_t capacity;
+    int slabIndex;
+};
+
+struct BufferPool
+{
+    uint32_t slabSize;
+    int slabsCount;
+    BufferPoolBuffer* slabs;
+    int* freeSlabs;
+    int freeSlabsCount;
+    std::atomic_flag lock;
+    std::atomic<int64_t> acquisitionsCount;
+    std::atomic<int64_t> reusesCount;
+    std::atomic<int64_t> exhaustionsCount;
+};
+
+static inline void LockBufferPool(BufferPool* bufferPool)
+{
+    while (bufferPool->lock.test_and_set(std::memory_order_acquire))
+    {
+    }
+}
+
+static inline void UnlockBufferPool(BufferPool* bufferPool)
+{
+    bufferPool->lock.clear(std::memory_order_release);
+}
+
+static inline BufferPool* CreateBufferPool(uint32_t slabSize, int slabsCount)
+{
+    BufferPool* bufferPool = new (std::nothrow) BufferPool();
+    if (bufferPool == nullptr)
+        return nullptr;
+
+    bufferPool->slabs = new (std::nothrow) BufferPoolBuffer[slabsCount];
+    bufferPool->freeSlabs = new (std::nothrow) int[slabsCount];
+    if (bufferPool->slabs == nullptr || bufferPool->freeSlabs == nullptr)
+    {
+        delete[] bufferPool->slabs;
+        delete[] bufferPool->freeSlabs;
+        delete bufferPool;
+        return nullptr;
+    }
+
+    bufferPool->slabSize = slabSize;
+    bufferPool->slabsCount = slabsCount;
+
+    for (int i = 0; i < slabsCount; i++)
+    {
+        bufferPool->slabs[i].data = nullptr;
+        bufferPool->slabs[i].capacity = slabSize;
+        bufferPool->slabs[i].slabIndex = i;
+
+        bufferPool->freeSlabs[i] = slabsCount - 1 - i;
+    }
+
+    bufferPool->freeSlabsCount = slabsCount;
+    bufferPool->lock.clear();
+    bufferPool->acquisitionsCount.store(0);
+    bufferPool->reusesCount.store(0);
+    bufferPool->exhaustionsCount.store(0);
+
+    return bufferPool;
+}
+
+// All buffers must be released before the pool is deleted
+static inline void DeleteBufferPool(BufferPool* bufferPool)
+{
+    if (bufferPool == nullptr)
+        return;
+
+    for (int i = 0; i < bufferPool->slabsCount; i++)
+    {
+        delete[] bufferPool->slabs[i].data;
+    }
+
+    delete[] bufferPool->slabs;
+    delete[] bufferPool->freeSlabs;
+    delete bufferPool;
+}
+
+static inline BufferPoolBuffer* AcquireStandaloneBuffer(uint32_t size)
+{
+    BufferPoolBuffer* buffer = new (std::nothrow) BufferPoolBuffer();
+    if (buffer == nullptr)
+        return nullptr;
+
+    buffer->data = new (std::nothrow) unsigned char[size];
+    if (buffer->data == nullptr)
+    {
+        delete buffer;
+        return nullptr;
+    }
+
+    buffer->capacity = size;
+    buffer->slabIndex = -1;
+
+    return buffer;
+}
+
+// Returns a buffer of at least the specified size or nullptr if there is not
+// enough memory
+static inline BufferPoolBuffer* AcquireBufferPoolBuffer(BufferPool* bufferPool, uint32_t size)
+{
+    bufferPool->acquisitionsCount.fetch_add(1, std::memory_order_relaxed);
+
+    int slabIndex = -1;
+
+    if (size <= bufferPool->slabSize)
+    {
+        LockBufferPool(bufferPool);
+
+        if (bufferPool->freeSlabsCount > 0)
+            slabIndex = bufferPool->freeSlabs[--bufferPool->freeSlabsCount];
+
+        UnlockBufferPool(bufferPool);
+    }
+
+    if (slabIndex < 0)
+    {
+        bufferPool->exhaustionsCount.fetch_add(1, std::memory_order_relaxed);
+        return AcquireStandaloneBuffer(size);
+    }
+
+    BufferPoolBuffer* slab = &bufferPool->slabs[slabIndex];
+    if (slab->data != nullptr)
+    {
+        bufferPool->reusesCount.fetch_add(1, std::memory_order_relaxed);
+        return slab;
+    }
+
+    slab->data = new (std::nothrow) unsigned char[bufferPool->slabSize];
+    if (slab->data != nullptr)
+        return slab;
+
+    LockBufferPool(bufferPool);
+    bufferPool->freeSlabs[bufferPool->freeSlabsCount++] = slabIndex;
+    UnlockBufferPool(bufferPool);
+
+    return nullptr;
+}
+
+static inline void ReleaseBufferPoolBuffer(BufferPool* bufferPool, BufferPoolBuffer* buffer)
+{
+    if (buffer == nullptr)
+        return;
+
+    if (buffer->slabIndex < 0)
+    {
+        delete[] buffer->data;
+        delete buffer;
+        return;
+    }
+
+    LockBufferPool(bufferPool);
+    bufferPool->freeSlabs[bufferPool->freeSlabsCount++] = buffer->slabIndex;
+    UnlockBufferPool(bufferPool);
+}
+
+#endif
@@ -2,6 +2,7 @@ typedef int API_TYPE;
 
 #define API_TYPE_WIN 0
 #define API_TYPE_MAC 1
+#define API_TYPE_LINUX 2
 
 typedef int SESSION_OPENRESULT;
 
@@ -42,6 +43,7 @@ typedef int TG_STARTRESULT;
 
 #define TG_STARTRESULT_NORESOURCES 101
 #define TG_STARTRESULT_BADTHREADATTRIBUTE 102
+#define TG_STARTRESULT_CANTCREATETIMER 103
 #define TG_STARTRESULT_UNKNOWNERROR 199
 
 typedef int TG_STOPRESULT;
@@ -51,6 +53,14 @@ typedef int TG_STOPRESULT;
 #define TG_STOPRESULT_CANTENDPERIOD 1
 #define TG_STOPRESULT_CANTKILLEVENT 2
 
+typedef int TG_SCHEDULERESULT;
+
+#define TG_SCHEDULERESULT_OK 0
+
+#define TG_SCHEDULERESULT_CANTSETTIMERCALLBACK 1
+
+#define TG_SCHEDULERESULT_CANTSETTIMERTIME 101
+
 /* ================================
    Input device
 ================================ */
@@ -187,11 +197,33 @@ typedef int IN_DISCONNECTRESULT;
 typedef int IN_GETEVENTDATARESULT;
 
 #define IN_GETEVENTDATARESULT_OK 0
+#define IN_GETEVENTDATARESULT_BUFFERTOOSMALL 1
 
 typedef int IN_GETSYSEXDATARESULT;
 
 #define IN_GETSYSEXDATARESULT_OK 0
 
+typedef int IN_READBUFFERRESULT;
+
+#define IN_READBUFFERRESULT_OK 0
+
+#define IN_READBUFFERRESULT_NOBUFFER 1
+
+typedef int IN_WAITBUFFERRESULT;
+
+#define IN_WAITBUFFERRESULT_OK 0
+
+#define IN_WAITBUFFERRESULT_TIMEOUT 1
+#define IN_WAITBUFFERRESULT_NOBUFFER 2
+
+#define IN_WAITBUFFERRESULT_UNKNOWNERROR 1000
+
+typedef int IN_ADDTHRUROUTERESULT;
+
+#define IN_ADDTHRUROUTERESULT_OK 0
+
+#define IN_ADDTHRUROUTERESULT_NOMEMORY 1
+
 typedef int IN_PROPERTY;
 
 #define IN_PROPERTY_PRODUCT 0
@@ -267,6 +299,7 @@ typedef int OUT_SENDSHORTRESULT;
 #define OUT_SENDSHORTRESULT_WRONGTHREAD 107
 #define OUT_SENDSHORTRESULT_NOTPERMITTED 108
 #define OUT_SENDSHORTRESULT_UNKNOWNERROR 109
+#define OUT_SENDSHORTRESULT_NOMEMORY 110
 
 typedef int OUT_SENDSYSEXRESULT;
 
@@ -291,6 +324,16 @@ typedef int OUT_SENDSYSEXRESULT;
 #define OUT_SENDSYSEXRESULT_NOTPERMITTED 108
 #define OUT_SENDSYSEXRESULT_UNKNOWNERROR 109
 
+typedef int OUT_ACQUIRESYSEXBUFFERRESULT;
+
+#define OUT_ACQUIRESYSEXBUFFERRESULT_OK 0
+#define OUT_ACQUIRESYSEXBUFFERRESULT_NOMEMORY 1
+
+typedef int OUT_CANCELSCHEDULEDRESULT;
+
+#define OUT_CANCELSCHEDULEDRESULT_OK 0
+#define OUT_CANCELSCHEDULEDRESULT_UNKNOWNERROR 1
+
 typedef int OUT_GETSYSEXDATARESULT;
 
 #define OUT_GETSYSEXDATARESULT_OK 0
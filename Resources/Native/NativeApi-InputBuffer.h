@@ -0,0 +1,165 @@
+#ifndef NATIVEAPI_INPUTBUFFER_H
+#define NATIVEAPI_INPUTBUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+/* ================================
+   Input buffer
+================================ */
+
+// Lock-free single-producer/single-consumer ring of variable-length records.
+// Producer is a driver callback, consumer is a managed thread draining the
+// ring via ReadInputDeviceBuffer. Each record is a header followed by raw
+// MIDI bytes padded to 8 bytes. Records which don't fit are dropped and
+// counted as overflows, the producer never blocks.
+
+#define INPUTBUFFER_MINSIZE 1024
+#define INPUTBUFFER_MAXSIZE (64 * 1024 * 1024)
+
+#define INPUTBUFFER_RECORDFLAG_INVALIDSHORTEVENT 1
+#define INPUTBUFFER_RECORDFLAG_INVALIDSYSEXEVENT 2
+
+struct InputBufferRecordHeader
+{
+    uint64_t timestamp;
+    uint32_t length;
+    uint32_t flags;
+};
+
+struct InputBuffer
+{
+    unsigned char* data;
+    uint64_t capacity;
+    std::atomic<uint64_t> writePosition;
+    std::atomic<uint64_t> readPosition;
+    std::atomic<int64_t> overflowsCount;
+    std::atomic<char> signalled;
+};
+
+static inline uint64_t GetInputBufferRecordSize(uint32_t length)
+{
+    return (sizeof(InputBufferRecordHeader) + length + 7) & ~static_cast<uint64_t>(7);
+}
+
+static inline InputBuffer* CreateInputBuffer(int size)
+{
+    uint64_t capacity = INPUTBUFFER_MINSIZE;
+    while (capacity < static_cast<uint64_t>(size) && capacity < INPUTBUFFER_MAXSIZE)
+        capacity <<= 1;
+
+    unsigned char* data = new (std::nothrow) unsigned char[capacity];
+    if (data == nullptr)
+        return nullptr;
+
+    InputBuffer* inputBuffer = new (std::nothrow) InputBuffer();
+    if (inputBuffer == nullptr)
+    {
+        delete[] data;
+        return nullptr;
+    }
+
+    inputBuffer->data = data;
+    inputBuffer->capacity = capacity;
+    inputBuffer->writePosition.store(0);
+    inputBuffer->readPosition.store(0);
+    inputBuffer->overflowsCount.store(0);
+    inputBuffer->signalled.store(0);
+
+    return inputBuffer;
+}
+
+static inline void DeleteInputBuffer(InputBuffer* inputBuffer)
+{
+    if (inputBuffer == nullptr)
+        return;
+
+    delete[] inputBuffer->data;
+    delete inputBuffer;
+}
+
+static inline void CopyToInputBuffer(InputBuffer* inputBuffer, uint64_t position, const void* source, uint64_t size)
+{
+    uint64_t offset = position & (inputBuffer->capacity - 1);
+    uint64_t firstPartSize = inputBuffer->capacity - offset;
+    if (firstPartSize > size)
+        firstPartSize = size;
+
+    memcpy(inputBuffer->data + offset, source, firstPartSize);
+    memcpy(inputBuffer->data, reinterpret_cast<const unsigned char*>(source) + firstPartSize, size - firstPartSize);
+}
+
+static inline void CopyFromInputBuffer(InputBuffer* inputBuffer, uint64_t position, void* target, uint64_t size)
+{
+    uint64_t offset = position & (inputBuffer->capacity - 1);
+    uint64_t firstPartSize = inputBuffer->capacity - offset;
+    if (firstPartSize > size)
+        firstPartSize = size;
+
+    memcpy(target, inputBuffer->data + offset, firstPartSize);
+    memcpy(reinterpret_cast<unsigned char*>(target) + firstPartSize, inputBuffer->data, size - firstPartSize);
+}
+
+// Returns 1 if the consumer should be woken up (it's the first record since
+// the consumer has started draining), 0 otherwise. Must be called from a
+// single thread at a time.
+static inline char PushToInputBuffer(InputBuffer* inputBuffer, uint64_t timestamp, uint32_t flags, const void* data, uint32_t length)
+{
+    uint64_t recordSize = GetInputBufferRecordSize(length);
+    uint64_t writePosition = inputBuffer->writePosition.load(std::memory_order_relaxed);
+    uint64_t readPosition = inputBuffer->readPosition.load(std::memory_order_acquire);
+
+    if (inputBuffer->capacity - (writePosition - readPosition) < recordSize)
+    {
+        inputBuffer->overflowsCount.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    InputBufferRecordHeader header;
+    header.timestamp = timestamp;
+    header.length = length;
+    header.flags = flags;
+
+    CopyToInputBuffer(inputBuffer, writePosition, &header, sizeof(header));
+    CopyToInputBuffer(inputBuffer, writePosition + sizeof(header), data, length);
+
+    // Publishing the record and checking the signal flag (and the reverse on the
+    // consumer's side) must not be reordered, otherwise a wake-up can be lost
+    inputBuffer->writePosition.store(writePosition + recordSize, std::memory_order_seq_cst);
+
+    return static_cast<char>(inputBuffer->signalled.exchange(1, std::memory_order_seq_cst) == 0);
+}
+
+// Copies as many whole records as fit into the target. The target should be
+// at least of the buffer's capacity to be able to take any record. Must be
+// called from a single thread at a time.
+static inline int ReadFromInputBuffer(InputBuffer* inputBuffer, unsigned char* target, int targetSize)
+{
+    inputBuffer->signalled.store(0, std::memory_order_seq_cst);
+
+    uint64_t readPosition = inputBuffer->readPosition.load(std::memory_order_relaxed);
+    uint64_t writePosition = inputBuffer->writePosition.load(std::memory_order_seq_cst);
+
+    uint64_t bytesRead = 0;
+
+    while (readPosition + bytesRead < writePosition)
+    {
+        InputBufferRecordHeader header;
+        CopyFromInputBuffer(inputBuffer, readPosition + bytesRead, &header, sizeof(header));
+
+        uint64_t recordSize = GetInputBufferRecordSize(header.length);
+        if (bytesRead + recordSize > static_cast<uint64_t>(targetSize))
+            break;
+
+        bytesRead += recordSize;
+    }
+
+    CopyFromInputBuffer(inputBuffer, readPosition, target, bytesRead);
+    inputBuffer->readPosition.store(readPosition + bytesRead, std::memory_order_release);
+
+    return static_cast<int>(bytesRead);
+}
+
+#endif
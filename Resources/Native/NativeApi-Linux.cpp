@@ -0,0 +1,1704 @@
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "NativeApi-Constants.h"
+#include "NativeApi-InputBuffer.h"
+#include "NativeApi-BufferPool.h"
+#include "NativeApi-Scheduler.h"
+#include "NativeApi-PacketList.h"
+#include "NativeApi-Thru.h"
+
+#define PROPERTY_VALUE_BUFFER_SIZE 256
+#define PACKET_DATA_ALIGNMENT 4
+#define PACKET_MAXLENGTH 0xFFFF
+
+#define API_EXPORT extern "C" __attribute__((visibility("default")))
+
+typedef unsigned char Byte;
+
+/* ================================
+   Common
+================================ */
+
+API_EXPORT API_TYPE GetApiType()
+{
+    return API_TYPE_LINUX;
+}
+
+API_EXPORT char CanCompareDevices()
+{
+    return 1;
+}
+
+static uint64_t GetMonotonicTimeInNanoseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+API_EXPORT int64_t GetMonotonicTimestamp()
+{
+    return static_cast<int64_t>(GetMonotonicTimeInNanoseconds());
+}
+
+/* ================================
+   High-precision tick generator
+================================ */
+
+// Ticks are driven by a periodic timerfd armed with an absolute deadline, so the
+// period doesn't drift with callback duration and can be shorter than 1 ms. Timer
+// expirations missed while the callback was running are coalesced into a single tick.
+// Where timerfd is unavailable, absolute-deadline clock_nanosleep is used instead.
+// One-shot tick generator has zero interval and its timerfd is disarmed until the next
+// tick is scheduled
+
+#define TICK_GENERATOR_SCHED_PRIORITY_DIVIDER 2
+#define TICK_GENERATOR_STOP_CHECK_INTERVAL_NS 10000000LL
+
+struct TickGeneratorSessionHandle
+{
+    char dummy;
+};
+
+struct TickGeneratorInfo
+{
+    void (*callback)(void);
+    int64_t intervalInNanoseconds;
+    pthread_t thread;
+    int timerFd;
+    int stopFd;
+    std::atomic<char> active;
+    std::atomic<char> deleteOnExit;
+};
+
+API_EXPORT TGSESSION_OPENRESULT OpenTickGeneratorSession(void** handle)
+{
+    TickGeneratorSessionHandle* sessionHandle = new TickGeneratorSessionHandle();
+
+    *handle = sessionHandle;
+
+    return TGSESSION_OPENRESULT_OK;
+}
+
+static void AddNanoseconds(struct timespec* ts, int64_t nanoseconds)
+{
+    int64_t totalNanoseconds = static_cast<int64_t>(ts->tv_nsec) + nanoseconds % 1000000000LL;
+    ts->tv_sec += static_cast<time_t>(nanoseconds / 1000000000LL + totalNanoseconds / 1000000000LL);
+    ts->tv_nsec = static_cast<long>(totalNanoseconds % 1000000000LL);
+}
+
+static int64_t GetNanosecondsBetween(const struct timespec* from, const struct timespec* to)
+{
+    return static_cast<int64_t>(to->tv_sec - from->tv_sec) * 1000000000LL + (to->tv_nsec - from->tv_nsec);
+}
+
+static void DeleteTickGeneratorInfo(TickGeneratorInfo* tickGeneratorInfo)
+{
+    if (tickGeneratorInfo->timerFd >= 0)
+        close(tickGeneratorInfo->timerFd);
+
+    if (tickGeneratorInfo->stopFd >= 0)
+        close(tickGeneratorInfo->stopFd);
+
+    delete tickGeneratorInfo;
+}
+
+static void RunTimerFdLoop(TickGeneratorInfo* tickGeneratorInfo)
+{
+    struct pollfd fds[2];
+    fds[0].fd = tickGeneratorInfo->timerFd;
+    fds[0].events = POLLIN;
+    fds[1].fd = tickGeneratorInfo->stopFd;
+    fds[1].events = POLLIN;
+
+    while (tickGeneratorInfo->active.load() == 1)
+    {
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        if (fds[1].revents != 0)
+            break;
+
+        uint64_t expirationsCount;
+        if (read(tickGeneratorInfo->timerFd, &expirationsCount, sizeof(expirationsCount)) != sizeof(expirationsCount))
+            continue;
+
+        if (tickGeneratorInfo->active.load() == 1)
+            tickGeneratorInfo->callback();
+    }
+}
+
+static void RunClockNanosleepLoop(TickGeneratorInfo* tickGeneratorInfo)
+{
+    int64_t interval = tickGeneratorInfo->intervalInNanoseconds;
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    AddNanoseconds(&deadline, interval);
+
+    while (tickGeneratorInfo->active.load() == 1)
+    {
+        // Sleep in slices so the thread notices stop request in reasonable time
+        // even for long intervals
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        struct timespec wakeTime = deadline;
+        if (GetNanosecondsBetween(&now, &deadline) > TICK_GENERATOR_STOP_CHECK_INTERVAL_NS)
+        {
+            wakeTime = now;
+            AddNanoseconds(&wakeTime, TICK_GENERATOR_STOP_CHECK_INTERVAL_NS);
+        }
+
+        int result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, nullptr);
+        if (result == EINTR || tickGeneratorInfo->active.load() != 1)
+            continue;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (GetNanosecondsBetween(&deadline, &now) < 0)
+            continue;
+
+        tickGeneratorInfo->callback();
+
+        AddNanoseconds(&deadline, interval);
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t lateness = GetNanosecondsBetween(&deadline, &now);
+        if (lateness >= 0)
+            AddNanoseconds(&deadline, (lateness / interval + 1) * interval);
+    }
+}
+
+static void* TickGeneratorThreadRoutine(void* data)
+{
+    TickGeneratorInfo* tickGeneratorInfo = reinterpret_cast<TickGeneratorInfo*>(data);
+
+    if (tickGeneratorInfo->timerFd >= 0)
+        RunTimerFdLoop(tickGeneratorInfo);
+    else
+        RunClockNanosleepLoop(tickGeneratorInfo);
+
+    if (tickGeneratorInfo->deleteOnExit.load() == 1)
+        DeleteTickGeneratorInfo(tickGeneratorInfo);
+
+    return nullptr;
+}
+
+static int ArmTimerFd(TickGeneratorInfo* tickGeneratorInfo)
+{
+    int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (timerFd < 0)
+        return -1;
+
+    int64_t interval = tickGeneratorInfo->intervalInNanoseconds;
+
+    struct itimerspec timerSpec;
+    timerSpec.it_interval.tv_sec = static_cast<time_t>(interval / 1000000000LL);
+    timerSpec.it_interval.tv_nsec = static_cast<long>(interval % 1000000000LL);
+
+    clock_gettime(CLOCK_MONOTONIC, &timerSpec.it_value);
+    AddNanoseconds(&timerSpec.it_value, interval);
+
+    if (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &timerSpec, nullptr) != 0)
+    {
+        close(timerFd);
+        return -1;
+    }
+
+    return timerFd;
+}
+
+static int CreateTickGeneratorThread(TickGeneratorInfo* tickGeneratorInfo)
+{
+    // Try to run ticking thread with real-time priority first; SCHED_FIFO requires
+    // CAP_SYS_NICE or RLIMIT_RTPRIO, so fall back to default policy if not permitted
+
+    pthread_attr_t attr;
+    if (pthread_attr_init(&attr) == 0)
+    {
+        struct sched_param schedParam;
+        schedParam.sched_priority = sched_get_priority_max(SCHED_FIFO) / TICK_GENERATOR_SCHED_PRIORITY_DIVIDER;
+
+        int result = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        if (result == 0)
+            result = pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        if (result == 0)
+            result = pthread_attr_setschedparam(&attr, &schedParam);
+        if (result == 0)
+            result = pthread_create(&tickGeneratorInfo->thread, &attr, TickGeneratorThreadRoutine, tickGeneratorInfo);
+
+        pthread_attr_destroy(&attr);
+
+        if (result == 0)
+            return 0;
+    }
+
+    return pthread_create(&tickGeneratorInfo->thread, nullptr, TickGeneratorThreadRoutine, tickGeneratorInfo);
+}
+
+static TG_STARTRESULT StartTickGeneratorThread(TickGeneratorInfo* tickGeneratorInfo, TickGeneratorInfo** info)
+{
+    int result = CreateTickGeneratorThread(tickGeneratorInfo);
+    if (result != 0)
+    {
+        DeleteTickGeneratorInfo(tickGeneratorInfo);
+        switch (result)
+        {
+            case EAGAIN: return TG_STARTRESULT_NORESOURCES;
+            case EINVAL: return TG_STARTRESULT_BADTHREADATTRIBUTE;
+        }
+
+        return TG_STARTRESULT_UNKNOWNERROR;
+    }
+
+    *info = tickGeneratorInfo;
+
+    return TG_STARTRESULT_OK;
+}
+
+API_EXPORT TG_STARTRESULT StartHighPrecisionTickGenerator_Linux(int64_t intervalInMicroseconds, void* sessionHandle, void (*callback)(void), TickGeneratorInfo** info)
+{
+    TickGeneratorInfo* tickGeneratorInfo = new TickGeneratorInfo();
+
+    tickGeneratorInfo->callback = callback;
+    tickGeneratorInfo->intervalInNanoseconds = intervalInMicroseconds * 1000LL;
+    tickGeneratorInfo->active.store(1);
+    tickGeneratorInfo->deleteOnExit.store(0);
+    tickGeneratorInfo->stopFd = eventfd(0, EFD_CLOEXEC);
+    tickGeneratorInfo->timerFd = tickGeneratorInfo->stopFd >= 0
+        ? ArmTimerFd(tickGeneratorInfo)
+        : -1;
+
+    return StartTickGeneratorThread(tickGeneratorInfo, info);
+}
+
+API_EXPORT TG_STARTRESULT StartOneShotHighPrecisionTickGenerator_Linux(void* sessionHandle, void (*callback)(void), TickGeneratorInfo** info)
+{
+    TickGeneratorInfo* tickGeneratorInfo = new TickGeneratorInfo();
+
+    tickGeneratorInfo->callback = callback;
+    tickGeneratorInfo->intervalInNanoseconds = 0;
+    tickGeneratorInfo->active.store(1);
+    tickGeneratorInfo->deleteOnExit.store(0);
+    tickGeneratorInfo->stopFd = eventfd(0, EFD_CLOEXEC);
+
+    // Timer can be rearmed by another thread between poll and read, so reading
+    // must not block
+    tickGeneratorInfo->timerFd = tickGeneratorInfo->stopFd >= 0
+        ? timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)
+        : -1;
+
+    if (tickGeneratorInfo->timerFd < 0)
+    {
+        DeleteTickGeneratorInfo(tickGeneratorInfo);
+        return TG_STARTRESULT_CANTCREATETIMER;
+    }
+
+    return StartTickGeneratorThread(tickGeneratorInfo, info);
+}
+
+API_EXPORT TG_SCHEDULERESULT ScheduleHighPrecisionTickGeneratorTick(TickGeneratorSessionHandle* sessionHandle, TickGeneratorInfo* tickGeneratorInfo, int64_t delayInMicroseconds)
+{
+    if (tickGeneratorInfo->timerFd < 0)
+        return TG_SCHEDULERESULT_CANTSETTIMERTIME;
+
+    int64_t interval = tickGeneratorInfo->intervalInNanoseconds;
+
+    struct itimerspec timerSpec;
+    timerSpec.it_interval.tv_sec = static_cast<time_t>(interval / 1000000000LL);
+    timerSpec.it_interval.tv_nsec = static_cast<long>(interval % 1000000000LL);
+
+    // Zero value disarms the timer, so the deadline is at least a nanosecond ahead
+    clock_gettime(CLOCK_MONOTONIC, &timerSpec.it_value);
+    AddNanoseconds(&timerSpec.it_value, delayInMicroseconds > 0 ? delayInMicroseconds * 1000LL : 1);
+
+    if (timerfd_settime(tickGeneratorInfo->timerFd, TFD_TIMER_ABSTIME, &timerSpec, nullptr) != 0)
+        return TG_SCHEDULERESULT_CANTSETTIMERTIME;
+
+    return TG_SCHEDULERESULT_OK;
+}
+
+API_EXPORT TG_STOPRESULT StopHighPrecisionTickGenerator(TickGeneratorSessionHandle* sessionHandle, TickGeneratorInfo* tickGeneratorInfo)
+{
+    tickGeneratorInfo->active.store(0);
+
+    if (tickGeneratorInfo->stopFd >= 0)
+    {
+        uint64_t value = 1;
+        ssize_t written = write(tickGeneratorInfo->stopFd, &value, sizeof(value));
+        (void)written;
+    }
+
+    if (pthread_equal(pthread_self(), tickGeneratorInfo->thread))
+    {
+        // Stop requested from the tick callback, so thread can't be joined here;
+        // it will release the info on exit
+        tickGeneratorInfo->deleteOnExit.store(1);
+        pthread_detach(tickGeneratorInfo->thread);
+        return TG_STOPRESULT_OK;
+    }
+
+    pthread_join(tickGeneratorInfo->thread, nullptr);
+    DeleteTickGeneratorInfo(tickGeneratorInfo);
+
+    return TG_STOPRESULT_OK;
+}
+
+/* ================================
+   Packets
+================================ */
+
+// Layout of received data is modeled after CoreMIDI's MIDIPacketList: packets
+// of variable length follow each other, every packet starts on a boundary
+// suitable for its 64-bit timestamp so it can be read directly on strict-alignment
+// targets
+
+struct MidiPacket
+{
+    uint64_t timeStamp;
+    uint16_t length;
+    Byte data[PACKET_DATA_ALIGNMENT];
+};
+
+struct MidiPacketList
+{
+    uint32_t numPackets;
+    MidiPacket packet[1];
+};
+
+#define PACKET_ALIGNMENT alignof(MidiPacket)
+
+static size_t GetPacketSize(size_t dataLength)
+{
+    size_t size = offsetof(MidiPacket, data) + dataLength;
+    return (size + PACKET_ALIGNMENT - 1) & ~static_cast<size_t>(PACKET_ALIGNMENT - 1);
+}
+
+static MidiPacket* MidiPacketNext(MidiPacket* packet)
+{
+    return reinterpret_cast<MidiPacket*>(reinterpret_cast<Byte*>(packet) + GetPacketSize(packet->length));
+}
+
+static void InitPacketList(std::vector<Byte>& buffer)
+{
+    buffer.assign(offsetof(MidiPacketList, packet), 0);
+}
+
+static void AddPacketToPacketList(std::vector<Byte>& buffer, uint64_t timeStamp, const Byte* data, size_t length)
+{
+    size_t offset = buffer.size();
+    buffer.resize(offset + GetPacketSize(length), 0);
+
+    MidiPacket* packet = reinterpret_cast<MidiPacket*>(buffer.data() + offset);
+    packet->timeStamp = timeStamp;
+    packet->length = static_cast<uint16_t>(length);
+    memcpy(packet->data, data, length);
+
+    reinterpret_cast<MidiPacketList*>(buffer.data())->numPackets++;
+}
+
+// Packets are stamped with the monotonic clock when sent, a zero timestamp
+// means the time is unknown
+static uint64_t GetPacketTimestamp(const MidiPacket* packet)
+{
+    return packet->timeStamp != 0
+        ? packet->timeStamp
+        : GetMonotonicTimeInNanoseconds();
+}
+
+static size_t GetPacketListSize(const MidiPacketList* packetList)
+{
+    MidiPacket* packet = const_cast<MidiPacket*>(packetList->packet);
+
+    for (uint32_t i = 0; i < packetList->numPackets; i++)
+    {
+        packet = MidiPacketNext(packet);
+    }
+
+    return static_cast<size_t>(reinterpret_cast<const Byte*>(packet) - reinterpret_cast<const Byte*>(packetList));
+}
+
+/* ================================
+   Loopback transport
+================================ */
+
+// All endpoints live in the current process: a virtual device registers a source
+// and a destination, output devices send to destinations and input devices listen
+// to sources. Data is delivered on a dedicated thread, so callbacks are never
+// invoked on a sender's thread
+
+typedef void (*ReadProc)(const MidiPacketList* packetList, void* readProcRefCon, void* srcConnRefCon);
+
+typedef void (*InputDeviceCallback)(void* info, char operation);
+typedef void (*OutputDeviceCallback)(void* info, char operation);
+
+struct InputDeviceHandle;
+
+struct Endpoint
+{
+    int id;
+    char* name;
+    char isSource;
+    ReadProc readProc;
+    void* readProcRefCon;
+    std::vector<InputDeviceHandle*> connections;
+};
+
+struct SessionHandle;
+
+struct Notification
+{
+    InputDeviceCallback inputDeviceCallback;
+    OutputDeviceCallback outputDeviceCallback;
+    void* info;
+    char isSource;
+    char operation;
+};
+
+typedef int DELIVERY_KIND;
+#define DELIVERY_KIND_TODESTINATION 0
+#define DELIVERY_KIND_TOSOURCE 1
+#define DELIVERY_KIND_NOTIFICATION 2
+
+struct Delivery
+{
+    DELIVERY_KIND kind;
+    int endpointId;
+    std::vector<Byte> packetList;
+    Notification notification;
+};
+
+struct Transport
+{
+    std::recursive_mutex mutex;
+    std::condition_variable_any condition;
+    std::vector<Endpoint*> sources;
+    std::vector<Endpoint*> destinations;
+    std::vector<SessionHandle*> sessions;
+    std::deque<Delivery> deliveries;
+    int lastEndpointId;
+    pthread_t thread;
+    char threadStarted;
+    char stopRequested;
+    const void* deliveringTo;
+};
+
+static Transport* GetTransport()
+{
+    static Transport* transport = new Transport();
+    return transport;
+}
+
+static Endpoint* FindEndpoint(std::vector<Endpoint*>& endpoints, int id)
+{
+    for (size_t i = 0; i < endpoints.size(); i++)
+    {
+        if (endpoints[i]->id == id)
+            return endpoints[i];
+    }
+
+    return nullptr;
+}
+
+static void RemoveEndpoint(std::vector<Endpoint*>& endpoints, Endpoint* endpoint)
+{
+    for (size_t i = 0; i < endpoints.size(); i++)
+    {
+        if (endpoints[i] == endpoint)
+        {
+            endpoints.erase(endpoints.begin() + i);
+            return;
+        }
+    }
+}
+
+static char IsTransportThread(Transport* transport)
+{
+    return transport->threadStarted && pthread_equal(pthread_self(), transport->thread);
+}
+
+static void WaitForDeliveryCompleted(Transport* transport, std::unique_lock<std::recursive_mutex>& lock, const void* target)
+{
+    if (IsTransportThread(transport))
+        return;
+
+    while (transport->deliveringTo == target)
+    {
+        transport->condition.wait(lock);
+    }
+}
+
+static void EnqueueDelivery(DELIVERY_KIND kind, int endpointId, const Byte* packetList, size_t size)
+{
+    Transport* transport = GetTransport();
+
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    Delivery delivery;
+    delivery.kind = kind;
+    delivery.endpointId = endpointId;
+    delivery.packetList.assign(packetList, packetList + size);
+
+    transport->deliveries.push_back(std::move(delivery));
+    transport->condition.notify_all();
+}
+
+static void DeliverNotification(Transport* transport, std::unique_lock<std::recursive_mutex>& lock, Delivery& delivery)
+{
+    Notification& notification = delivery.notification;
+
+    lock.unlock();
+
+    if (notification.isSource)
+    {
+        if (notification.inputDeviceCallback != nullptr)
+            notification.inputDeviceCallback(notification.info, notification.operation);
+    }
+    else
+    {
+        if (notification.outputDeviceCallback != nullptr)
+            notification.outputDeviceCallback(notification.info, notification.operation);
+    }
+
+    lock.lock();
+}
+
+static void DeliverToDestination(Transport* transport, std::unique_lock<std::recursive_mutex>& lock, Delivery& delivery)
+{
+    Endpoint* endpoint = FindEndpoint(transport->destinations, delivery.endpointId);
+    if (endpoint == nullptr || endpoint->readProc == nullptr)
+        return;
+
+    ReadProc readProc = endpoint->readProc;
+    void* readProcRefCon = endpoint->readProcRefCon;
+
+    transport->deliveringTo = endpoint;
+    lock.unlock();
+
+    readProc(reinterpret_cast<MidiPacketList*>(delivery.packetList.data()), readProcRefCon, nullptr);
+
+    lock.lock();
+    transport->deliveringTo = nullptr;
+    transport->condition.notify_all();
+}
+
+static void DeliverToSource(Transport* transport, std::unique_lock<std::recursive_mutex>& lock, Delivery& delivery);
+
+static void* TransportThreadRoutine(void* data)
+{
+    Transport* transport = reinterpret_cast<Transport*>(data);
+
+    std::unique_lock<std::recursive_mutex> lock(transport->mutex);
+
+    while (!transport->stopRequested)
+    {
+        if (transport->deliveries.empty())
+        {
+            transport->condition.wait(lock);
+            continue;
+        }
+
+        Delivery delivery = std::move(transport->deliveries.front());
+        transport->deliveries.pop_front();
+
+        switch (delivery.kind)
+        {
+            case DELIVERY_KIND_TODESTINATION:
+                DeliverToDestination(transport, lock, delivery);
+                break;
+            case DELIVERY_KIND_TOSOURCE:
+                DeliverToSource(transport, lock, delivery);
+                break;
+            case DELIVERY_KIND_NOTIFICATION:
+                DeliverNotification(transport, lock, delivery);
+                break;
+        }
+    }
+
+    return nullptr;
+}
+
+/* ================================
+   Devices common
+================================ */
+
+struct InputDeviceInfo
+{
+    int endpointId;
+    char name[PROPERTY_VALUE_BUFFER_SIZE];
+};
+
+struct OutputDeviceInfo
+{
+    int endpointId;
+    char name[PROPERTY_VALUE_BUFFER_SIZE];
+};
+
+static char CopyEndpointName(std::vector<Endpoint*>& endpoints, int endpointId, char* buffer)
+{
+    Transport* transport = GetTransport();
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    Endpoint* endpoint = FindEndpoint(endpoints, endpointId);
+    if (endpoint == nullptr)
+        return 0;
+
+    strncpy(buffer, endpoint->name, PROPERTY_VALUE_BUFFER_SIZE - 1);
+    buffer[PROPERTY_VALUE_BUFFER_SIZE - 1] = '\0';
+    return 1;
+}
+
+/* ================================
+   Session
+================================ */
+
+struct SessionHandle
+{
+    char* name;
+    InputDeviceCallback inputDeviceCallback;
+    OutputDeviceCallback outputDeviceCallback;
+};
+
+static void NotifySessions(Endpoint* endpoint, char operation)
+{
+    Transport* transport = GetTransport();
+
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    for (size_t i = 0; i < transport->sessions.size(); i++)
+    {
+        SessionHandle* sessionHandle = transport->sessions[i];
+
+        Delivery delivery;
+        delivery.kind = DELIVERY_KIND_NOTIFICATION;
+        delivery.endpointId = endpoint->id;
+
+        Notification& notification = delivery.notification;
+        notification.inputDeviceCallback = sessionHandle->inputDeviceCallback;
+        notification.outputDeviceCallback = sessionHandle->outputDeviceCallback;
+        notification.isSource = endpoint->isSource;
+        notification.operation = operation;
+
+        if (endpoint->isSource)
+        {
+            InputDeviceInfo* inputDeviceInfo = new InputDeviceInfo();
+            inputDeviceInfo->endpointId = endpoint->id;
+            inputDeviceInfo->name[0] = '\0';
+            notification.info = inputDeviceInfo;
+        }
+        else
+        {
+            OutputDeviceInfo* outputDeviceInfo = new OutputDeviceInfo();
+            outputDeviceInfo->endpointId = endpoint->id;
+            outputDeviceInfo->name[0] = '\0';
+            notification.info = outputDeviceInfo;
+        }
+
+        transport->deliveries.push_back(std::move(delivery));
+    }
+
+    transport->condition.notify_all();
+}
+
+API_EXPORT SESSION_OPENRESULT OpenSession_Linux(char* name, InputDeviceCallback inputDeviceCallback, OutputDeviceCallback outputDeviceCallback, void** handle)
+{
+    Transport* transport = GetTransport();
+
+    SessionHandle* sessionHandle = new SessionHandle();
+
+    sessionHandle->name = strdup(name);
+    sessionHandle->inputDeviceCallback = inputDeviceCallback;
+    sessionHandle->outputDeviceCallback = outputDeviceCallback;
+
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    if (!transport->threadStarted)
+    {
+        transport->stopRequested = 0;
+        transport->deliveringTo = nullptr;
+
+        if (pthread_create(&transport->thread, nullptr, TransportThreadRoutine, transport) != 0)
+        {
+            free(sessionHandle->name);
+            delete sessionHandle;
+            return SESSION_OPENRESULT_THREADSTARTERROR;
+        }
+
+        transport->threadStarted = 1;
+    }
+
+    transport->sessions.push_back(sessionHandle);
+
+    *handle = sessionHandle;
+
+    return SESSION_OPENRESULT_OK;
+}
+
+API_EXPORT SESSION_CLOSERESULT CloseSession(void* handle)
+{
+    Transport* transport = GetTransport();
+    SessionHandle* sessionHandle = reinterpret_cast<SessionHandle*>(handle);
+
+    pthread_t thread;
+    char joinThread = 0;
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+        for (size_t i = 0; i < transport->sessions.size(); i++)
+        {
+            if (transport->sessions[i] == sessionHandle)
+            {
+                transport->sessions.erase(transport->sessions.begin() + i);
+                break;
+            }
+        }
+
+        if (transport->sessions.empty() && transport->threadStarted)
+        {
+            transport->stopRequested = 1;
+            transport->condition.notify_all();
+
+            thread = transport->thread;
+            joinThread = !IsTransportThread(transport);
+            transport->threadStarted = 0;
+
+            if (!joinThread)
+                pthread_detach(thread);
+        }
+    }
+
+    if (joinThread)
+        pthread_join(thread, nullptr);
+
+    free(sessionHandle->name);
+    delete sessionHandle;
+
+    return SESSION_CLOSERESULT_OK;
+}
+
+/* ================================
+   Input device
+================================ */
+
+struct InputDeviceHandle
+{
+    InputDeviceInfo* info;
+    ReadProc callback;
+    void* callbackRefCon;
+    char connected;
+    InputBuffer* inputBuffer;
+    int inputBufferEventFd;
+};
+
+API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int message);
+
+static void SendThruShortMessage(void* outputHandle, int message)
+{
+    SendShortEventToOutputDevice(outputHandle, message);
+}
+
+static void RouteThruPacketList(InputDeviceHandle* inputDeviceHandle, const MidiPacketList* packetList)
+{
+    if (!HasThruRoutes())
+        return;
+
+    MidiPacket* packetPtr = const_cast<MidiPacket*>(packetList->packet);
+
+    for (uint32_t i = 0; i < packetList->numPackets; i++)
+    {
+        RouteThruData(inputDeviceHandle, packetPtr->data, packetPtr->length, SendThruShortMessage);
+        packetPtr = MidiPacketNext(packetPtr);
+    }
+}
+
+static void DeliverToSource(Transport* transport, std::unique_lock<std::recursive_mutex>& lock, Delivery& delivery)
+{
+    Endpoint* endpoint = FindEndpoint(transport->sources, delivery.endpointId);
+    if (endpoint == nullptr)
+        return;
+
+    std::vector<InputDeviceHandle*> connections = endpoint->connections;
+
+    for (size_t i = 0; i < connections.size(); i++)
+    {
+        InputDeviceHandle* inputDeviceHandle = connections[i];
+
+        // Connection can be broken by a previous callback
+        Endpoint* currentEndpoint = FindEndpoint(transport->sources, delivery.endpointId);
+        if (currentEndpoint == nullptr)
+            return;
+
+        char stillConnected = 0;
+        for (size_t j = 0; j < currentEndpoint->connections.size(); j++)
+        {
+            if (currentEndpoint->connections[j] == inputDeviceHandle)
+                stillConnected = 1;
+        }
+
+        if (!stillConnected)
+            continue;
+
+        ReadProc callback = inputDeviceHandle->callback;
+        void* callbackRefCon = inputDeviceHandle->callbackRefCon;
+
+        transport->deliveringTo = inputDeviceHandle;
+        lock.unlock();
+
+        const MidiPacketList* packetList = reinterpret_cast<MidiPacketList*>(delivery.packetList.data());
+        RouteThruPacketList(inputDeviceHandle, packetList);
+
+        callback(packetList, callbackRefCon, nullptr);
+
+        lock.lock();
+        transport->deliveringTo = nullptr;
+        transport->condition.notify_all();
+    }
+}
+
+API_EXPORT int GetInputDevicesCount()
+{
+    Transport* transport = GetTransport();
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    return static_cast<int>(transport->sources.size());
+}
+
+API_EXPORT IN_GETINFORESULT GetInputDeviceInfo(int deviceIndex, void** info)
+{
+    Transport* transport = GetTransport();
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    if (deviceIndex < 0 || deviceIndex >= static_cast<int>(transport->sources.size()))
+        return IN_GETINFORESULT_BADDEVICEID;
+
+    InputDeviceInfo* inputDeviceInfo = new InputDeviceInfo();
+    inputDeviceInfo->endpointId = transport->sources[deviceIndex]->id;
+    inputDeviceInfo->name[0] = '\0';
+
+    *info = inputDeviceInfo;
+
+    return IN_GETINFORESULT_OK;
+}
+
+API_EXPORT int GetInputDeviceHashCode(void* info)
+{
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
+    return inputDeviceInfo->endpointId;
+}
+
+API_EXPORT char AreInputDevicesEqual(void* info1, void* info2)
+{
+    InputDeviceInfo* inputDeviceInfo1 = reinterpret_cast<InputDeviceInfo*>(info1);
+    InputDeviceInfo* inputDeviceInfo2 = reinterpret_cast<InputDeviceInfo*>(info2);
+
+    return static_cast<char>(inputDeviceInfo1->endpointId == inputDeviceInfo2->endpointId);
+}
+
+API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceName(void* info, char** value)
+{
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
+
+    if (!CopyEndpointName(GetTransport()->sources, inputDeviceInfo->endpointId, inputDeviceInfo->name))
+        return IN_GETPROPERTYRESULT_UNKNOWNENDPOINT;
+
+    *value = inputDeviceInfo->name;
+    return IN_GETPROPERTYRESULT_OK;
+}
+
+API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceManufacturer(void* info, char** value)
+{
+    return IN_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceProduct(void* info, char** value)
+{
+    return IN_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceDriverVersion(void* info, int* value)
+{
+    return IN_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceUniqueId(void* info, int* value)
+{
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
+    *value = inputDeviceInfo->endpointId;
+    return IN_GETPROPERTYRESULT_OK;
+}
+
+API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceDriverOwner(void* info, char** value)
+{
+    return IN_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT IN_OPENRESULT OpenInputDevice_Linux(void* info, void* sessionHandle, ReadProc callback, void** handle)
+{
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
+
+    InputDeviceHandle* inputDeviceHandle = new InputDeviceHandle();
+    inputDeviceHandle->info = inputDeviceInfo;
+    inputDeviceHandle->callback = callback;
+    inputDeviceHandle->callbackRefCon = nullptr;
+    inputDeviceHandle->connected = 0;
+    inputDeviceHandle->inputBuffer = nullptr;
+    inputDeviceHandle->inputBufferEventFd = -1;
+
+    *handle = inputDeviceHandle;
+
+    return IN_OPENRESULT_OK;
+}
+
+static void SignalInputBuffer(InputDeviceHandle* inputDeviceHandle)
+{
+    uint64_t value = 1;
+    ssize_t result = write(inputDeviceHandle->inputBufferEventFd, &value, sizeof(value));
+    (void)result;
+}
+
+static void OnMessageBuffered(const MidiPacketList* packetList, void* readProcRefCon, void* srcConnRefCon)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(readProcRefCon);
+    InputBuffer* inputBuffer = inputDeviceHandle->inputBuffer;
+
+    char signalRequired = 0;
+
+    MidiPacket* packetPtr = const_cast<MidiPacket*>(packetList->packet);
+
+    for (uint32_t i = 0; i < packetList->numPackets; i++)
+    {
+        if (PushToInputBuffer(inputBuffer, GetPacketTimestamp(packetPtr), 0, packetPtr->data, packetPtr->length))
+            signalRequired = 1;
+
+        packetPtr = MidiPacketNext(packetPtr);
+    }
+
+    if (signalRequired)
+        SignalInputBuffer(inputDeviceHandle);
+}
+
+API_EXPORT IN_OPENRESULT OpenInputDeviceBuffered_Linux(void* info, void* sessionHandle, int bufferSize, void** handle)
+{
+    InputBuffer* inputBuffer = CreateInputBuffer(bufferSize);
+    if (inputBuffer == nullptr)
+        return IN_OPENRESULT_NOMEMORY;
+
+    int eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (eventFd < 0)
+    {
+        DeleteInputBuffer(inputBuffer);
+        return IN_OPENRESULT_UNKNOWNERROR;
+    }
+
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
+
+    InputDeviceHandle* inputDeviceHandle = new InputDeviceHandle();
+    inputDeviceHandle->info = inputDeviceInfo;
+    inputDeviceHandle->callback = OnMessageBuffered;
+    inputDeviceHandle->callbackRefCon = inputDeviceHandle;
+    inputDeviceHandle->connected = 0;
+    inputDeviceHandle->inputBuffer = inputBuffer;
+    inputDeviceHandle->inputBufferEventFd = eventFd;
+
+    *handle = inputDeviceHandle;
+
+    return IN_OPENRESULT_OK;
+}
+
+API_EXPORT IN_READBUFFERRESULT ReadInputDeviceBuffer(void* handle, Byte* data, int size, int* bytesRead)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return IN_READBUFFERRESULT_NOBUFFER;
+
+    *bytesRead = ReadFromInputBuffer(inputDeviceHandle->inputBuffer, data, size);
+    return IN_READBUFFERRESULT_OK;
+}
+
+API_EXPORT IN_WAITBUFFERRESULT WaitForInputDeviceBuffer(void* handle, int timeout)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return IN_WAITBUFFERRESULT_NOBUFFER;
+
+    struct pollfd fd;
+    fd.fd = inputDeviceHandle->inputBufferEventFd;
+    fd.events = POLLIN;
+    fd.revents = 0;
+
+    int result = poll(&fd, 1, timeout);
+    if (result == 0)
+        return IN_WAITBUFFERRESULT_TIMEOUT;
+    if (result < 0)
+        return errno == EINTR ? IN_WAITBUFFERRESULT_TIMEOUT : IN_WAITBUFFERRESULT_UNKNOWNERROR;
+
+    uint64_t value;
+    ssize_t readResult = read(inputDeviceHandle->inputBufferEventFd, &value, sizeof(value));
+    (void)readResult;
+
+    return IN_WAITBUFFERRESULT_OK;
+}
+
+API_EXPORT void InterruptInputDeviceBufferWaiting(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return;
+
+    SignalInputBuffer(inputDeviceHandle);
+}
+
+API_EXPORT int64_t GetInputDeviceBufferOverflowsCount(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return 0;
+
+    return inputDeviceHandle->inputBuffer->overflowsCount.load(std::memory_order_relaxed);
+}
+
+API_EXPORT IN_DISCONNECTRESULT DisconnectFromInputDevice(void* handle)
+{
+    Transport* transport = GetTransport();
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+
+    std::unique_lock<std::recursive_mutex> lock(transport->mutex);
+
+    if (inputDeviceHandle->connected)
+    {
+        inputDeviceHandle->connected = 0;
+
+        Endpoint* endpoint = FindEndpoint(transport->sources, inputDeviceHandle->info->endpointId);
+        if (endpoint != nullptr)
+        {
+            std::vector<InputDeviceHandle*>& connections = endpoint->connections;
+            for (size_t i = 0; i < connections.size(); i++)
+            {
+                if (connections[i] == inputDeviceHandle)
+                {
+                    connections.erase(connections.begin() + i);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Connection can also be broken by closing of the virtual device, so delivery is
+    // waited for anyway to let the caller delete the handle
+    WaitForDeliveryCompleted(transport, lock, inputDeviceHandle);
+
+    return IN_DISCONNECTRESULT_OK;
+}
+
+API_EXPORT IN_ADDTHRUROUTERESULT AddInputDeviceThruRoute(void* handle, void* outputHandle, Byte* statusesMap, Byte* notesMap, int* routeId)
+{
+    *routeId = AddThruRoute(handle, outputHandle, statusesMap, notesMap);
+    return *routeId > 0 ? IN_ADDTHRUROUTERESULT_OK : IN_ADDTHRUROUTERESULT_NOMEMORY;
+}
+
+API_EXPORT void RemoveInputDeviceThruRoute(int routeId)
+{
+    RemoveThruRoute(routeId);
+}
+
+API_EXPORT IN_CLOSERESULT CloseInputDevice(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+
+    RemoveDeviceThruRoutes(inputDeviceHandle);
+
+    DisconnectFromInputDevice(handle);
+
+    if (inputDeviceHandle->inputBuffer != nullptr)
+    {
+        close(inputDeviceHandle->inputBufferEventFd);
+        DeleteInputBuffer(inputDeviceHandle->inputBuffer);
+    }
+
+    delete inputDeviceHandle->info;
+    delete inputDeviceHandle;
+
+    return IN_CLOSERESULT_OK;
+}
+
+API_EXPORT IN_CONNECTRESULT ConnectToInputDevice(void* handle)
+{
+    Transport* transport = GetTransport();
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    if (inputDeviceHandle->connected)
+        return IN_CONNECTRESULT_OK;
+
+    Endpoint* endpoint = FindEndpoint(transport->sources, inputDeviceHandle->info->endpointId);
+    if (endpoint == nullptr)
+        return IN_CONNECTRESULT_UNKNOWNENDPOINT;
+
+    endpoint->connections.push_back(inputDeviceHandle);
+    inputDeviceHandle->connected = 1;
+
+    return IN_CONNECTRESULT_OK;
+}
+
+API_EXPORT IN_GETEVENTDATARESULT GetEventsDataFromInputDevice(MidiPacketList* packetList, int maxPacketsCount, int* offsets, int* lengths, int64_t* timestamps, int* packetsCount, int* dataSize)
+{
+    *packetsCount = FlattenPacketList(
+        packetList,
+        packetList->packet,
+        packetList->numPackets,
+        maxPacketsCount,
+        offsets,
+        lengths,
+        timestamps,
+        dataSize,
+        [](const MidiPacket* packet) { return MidiPacketNext(const_cast<MidiPacket*>(packet)); },
+        GetPacketTimestamp);
+
+    return *packetsCount > maxPacketsCount
+        ? IN_GETEVENTDATARESULT_BUFFERTOOSMALL
+        : IN_GETEVENTDATARESULT_OK;
+}
+
+API_EXPORT char IsInputDevicePropertySupported(IN_PROPERTY property)
+{
+    switch (property)
+    {
+        case IN_PROPERTY_UNIQUEID:
+            return 1;
+    }
+
+    return 0;
+}
+
+/* ================================
+   Output device
+================================ */
+
+struct OutputDeviceHandle
+{
+    OutputDeviceInfo* info;
+    BufferPool* sysExBufferPool;
+};
+
+// Pooled SysEx buffers are laid out as a packet list with a single packet so
+// data written by the caller can be sent as is
+#define SYSEX_BUFFER_HEADER_SIZE (offsetof(MidiPacketList, packet) + offsetof(MidiPacket, data))
+
+API_EXPORT int GetOutputDevicesCount()
+{
+    Transport* transport = GetTransport();
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    return static_cast<int>(transport->destinations.size());
+}
+
+API_EXPORT OUT_GETINFORESULT GetOutputDeviceInfo(int deviceIndex, void** info)
+{
+    Transport* transport = GetTransport();
+    std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+    if (deviceIndex < 0 || deviceIndex >= static_cast<int>(transport->destinations.size()))
+        return OUT_GETINFORESULT_BADDEVICEID;
+
+    OutputDeviceInfo* outputDeviceInfo = new OutputDeviceInfo();
+    outputDeviceInfo->endpointId = transport->destinations[deviceIndex]->id;
+    outputDeviceInfo->name[0] = '\0';
+
+    *info = outputDeviceInfo;
+
+    return OUT_GETINFORESULT_OK;
+}
+
+API_EXPORT int GetOutputDeviceHashCode(void* info)
+{
+    OutputDeviceInfo* outputDeviceInfo = reinterpret_cast<OutputDeviceInfo*>(info);
+    return outputDeviceInfo->endpointId;
+}
+
+API_EXPORT char AreOutputDevicesEqual(void* info1, void* info2)
+{
+    OutputDeviceInfo* outputDeviceInfo1 = reinterpret_cast<OutputDeviceInfo*>(info1);
+    OutputDeviceInfo* outputDeviceInfo2 = reinterpret_cast<OutputDeviceInfo*>(info2);
+
+    return static_cast<char>(outputDeviceInfo1->endpointId == outputDeviceInfo2->endpointId);
+}
+
+API_EXPORT OUT_GETPROPERTYRESULT GetOutputDeviceName(void* info, char** value)
+{
+    OutputDeviceInfo* outputDeviceInfo = reinterpret_cast<OutputDeviceInfo*>(info);
+
+    if (!CopyEndpointName(GetTransport()->destinations, outputDeviceInfo->endpointId, outputDeviceInfo->name))
+        return OUT_GETPROPERTYRESULT_UNKNOWNENDPOINT;
+
+    *value = outputDeviceInfo->name;
+    return OUT_GETPROPERTYRESULT_OK;
+}
+
+API_EXPORT OUT_GETPROPERTYRESULT GetOutputDeviceManufacturer(void* info, char** value)
+{
+    return OUT_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT OUT_GETPROPERTYRESULT GetOutputDeviceProduct(void* info, char** value)
+{
+    return OUT_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT OUT_GETPROPERTYRESULT GetOutputDeviceDriverVersion(void* info, int* value)
+{
+    return OUT_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT OUT_GETPROPERTYRESULT GetOutputDeviceUniqueId(void* info, int* value)
+{
+    OutputDeviceInfo* outputDeviceInfo = reinterpret_cast<OutputDeviceInfo*>(info);
+    *value = outputDeviceInfo->endpointId;
+    return OUT_GETPROPERTYRESULT_OK;
+}
+
+API_EXPORT OUT_GETPROPERTYRESULT GetOutputDeviceDriverOwner(void* info, char** value)
+{
+    return OUT_GETPROPERTYRESULT_UNKNOWNPROPERTY;
+}
+
+API_EXPORT OUT_OPENRESULT OpenOutputDevice_Linux(void* info, void* sessionHandle, void** handle)
+{
+    OutputDeviceInfo* outputDeviceInfo = reinterpret_cast<OutputDeviceInfo*>(info);
+
+    BufferPool* sysExBufferPool = CreateBufferPool(BUFFERPOOL_DEFAULTSLABSIZE, BUFFERPOOL_DEFAULTSLABSCOUNT);
+    if (sysExBufferPool == nullptr)
+        return OUT_OPENRESULT_NOMEMORY;
+
+    OutputDeviceHandle* outputDeviceHandle = new OutputDeviceHandle();
+    outputDeviceHandle->info = outputDeviceInfo;
+    outputDeviceHandle->sysExBufferPool = sysExBufferPool;
+
+    *handle = outputDeviceHandle;
+
+    return OUT_OPENRESULT_OK;
+}
+
+static Scheduler* FindOutputScheduler();
+
+API_EXPORT OUT_CLOSERESULT CloseOutputDevice(void* handle)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+
+    RemoveDeviceThruRoutes(outputDeviceHandle);
+
+    Scheduler* scheduler = FindOutputScheduler();
+    if (scheduler != nullptr)
+        CancelScheduledMessages(scheduler, outputDeviceHandle);
+
+    DeleteBufferPool(outputDeviceHandle->sysExBufferPool);
+    delete outputDeviceHandle->info;
+    delete outputDeviceHandle;
+
+    return OUT_CLOSERESULT_OK;
+}
+
+static char SendPacketListToDestination(OutputDeviceHandle* outputDeviceHandle, const Byte* packetList, size_t size)
+{
+    Transport* transport = GetTransport();
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+        if (FindEndpoint(transport->destinations, outputDeviceHandle->info->endpointId) == nullptr)
+            return 0;
+    }
+
+    EnqueueDelivery(DELIVERY_KIND_TODESTINATION, outputDeviceHandle->info->endpointId, packetList, size);
+    return 1;
+}
+
+static char SendPacketListToDestination(OutputDeviceHandle* outputDeviceHandle, const std::vector<Byte>& packetList)
+{
+    return SendPacketListToDestination(outputDeviceHandle, packetList.data(), packetList.size());
+}
+
+static char SendToDestination(OutputDeviceHandle* outputDeviceHandle, const Byte* data, size_t dataSize)
+{
+    std::vector<Byte> packetList;
+    InitPacketList(packetList);
+    AddPacketToPacketList(packetList, GetMonotonicTimeInNanoseconds(), data, dataSize);
+
+    return SendPacketListToDestination(outputDeviceHandle, packetList);
+}
+
+static size_t GetShortEventData(int message, Byte* data)
+{
+    Byte statusByte = static_cast<Byte>(message & 0xFF);
+    data[0] = statusByte;
+    size_t dataSize = 1;
+
+    if (statusByte < 0xF8 && statusByte != 0xF6)
+    {
+        data[1] = static_cast<Byte>((message >> 8) & 0xFF);
+        dataSize++;
+
+        Byte channelStatus = static_cast<Byte>(statusByte >> 4);
+        if (channelStatus == 0x8 || channelStatus == 0x9 || channelStatus == 0xA || channelStatus == 0xB || channelStatus == 0xE || statusByte == 0xF2)
+        {
+            data[2] = static_cast<Byte>(message >> 16);
+            dataSize++;
+        }
+    }
+
+    return dataSize;
+}
+
+API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int message)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+
+    Byte data[3];
+    size_t dataSize = GetShortEventData(message, data);
+
+    if (!SendToDestination(outputDeviceHandle, data, dataSize))
+        return OUT_SENDSHORTRESULT_UNKNOWNENDPOINT;
+
+    return OUT_SENDSHORTRESULT_OK;
+}
+
+/* ================================
+   Scheduled output
+================================ */
+
+// The loopback transport delivers packets as soon as they are sent, so events
+// with future timestamps are held by the scheduler and sent at their time
+
+static void OnSchedulerThreadStarted()
+{
+    // Real-time priority requires CAP_SYS_NICE or RLIMIT_RTPRIO, so failure
+    // is ignored and the thread keeps default policy
+    struct sched_param schedParam;
+    schedParam.sched_priority = sched_get_priority_max(SCHED_FIFO) / TICK_GENERATOR_SCHED_PRIORITY_DIVIDER;
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &schedParam);
+}
+
+static void SendScheduledShortEvent(void* owner, int message)
+{
+    Byte data[3];
+    size_t dataSize = GetShortEventData(message, data);
+
+    SendToDestination(reinterpret_cast<OutputDeviceHandle*>(owner), data, dataSize);
+}
+
+// Scheduler (and its thread) is created by the first scheduled event only, so closing
+// devices or cancelling events which have never been scheduled doesn't create it
+
+static std::atomic<Scheduler*> OutputScheduler(nullptr);
+
+static Scheduler* GetOutputScheduler()
+{
+    static Scheduler* scheduler = CreateScheduler(GetMonotonicTimeInNanoseconds, SendScheduledShortEvent, OnSchedulerThreadStarted);
+    if (scheduler != nullptr)
+        OutputScheduler.store(scheduler, std::memory_order_release);
+
+    return scheduler;
+}
+
+static Scheduler* FindOutputScheduler()
+{
+    return OutputScheduler.load(std::memory_order_acquire);
+}
+
+static char FlushShortEventsPacketList(OutputDeviceHandle* outputDeviceHandle, std::vector<Byte>& packetList, int* sentCount)
+{
+    uint32_t packetsCount = reinterpret_cast<MidiPacketList*>(packetList.data())->numPackets;
+    if (packetsCount == 0)
+        return 1;
+
+    if (!SendPacketListToDestination(outputDeviceHandle, packetList))
+        return 0;
+
+    *sentCount += static_cast<int>(packetsCount);
+    InitPacketList(packetList);
+    return 1;
+}
+
+API_EXPORT OUT_SENDSHORTRESULT SendShortEventsToOutputDevice(void* handle, int* messages, int64_t* timestamps, int64_t token, int count, int* sentCount)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    *sentCount = 0;
+
+    if (count <= 0)
+        return OUT_SENDSHORTRESULT_OK;
+
+    uint64_t now = GetMonotonicTimeInNanoseconds();
+
+    std::vector<Byte> packetList;
+    packetList.reserve(offsetof(MidiPacketList, packet) + count * GetPacketSize(3));
+    InitPacketList(packetList);
+
+    for (int i = 0; i < count; i++)
+    {
+        uint64_t timestamp = timestamps != nullptr && timestamps[i] > 0
+            ? static_cast<uint64_t>(timestamps[i])
+            : now;
+
+        if (timestamp > now)
+        {
+            // Events collected so far are flushed first so sentCount always
+            // covers a prefix of the input if scheduling fails
+            if (!FlushShortEventsPacketList(outputDeviceHandle, packetList, sentCount))
+                return OUT_SENDSHORTRESULT_UNKNOWNENDPOINT;
+
+            Scheduler* scheduler = GetOutputScheduler();
+            if (scheduler == nullptr || !ScheduleMessage(scheduler, outputDeviceHandle, token, timestamp, messages[i]))
+                return OUT_SENDSHORTRESULT_NOMEMORY;
+
+            (*sentCount)++;
+            continue;
+        }
+
+        Byte data[3];
+        size_t dataSize = GetShortEventData(messages[i], data);
+
+        AddPacketToPacketList(packetList, timestamp, data, dataSize);
+    }
+
+    if (!FlushShortEventsPacketList(outputDeviceHandle, packetList, sentCount))
+        return OUT_SENDSHORTRESULT_UNKNOWNENDPOINT;
+
+    return OUT_SENDSHORTRESULT_OK;
+}
+
+API_EXPORT OUT_CANCELSCHEDULEDRESULT CancelScheduledOutputDeviceEvents(void* handle, int64_t token)
+{
+    Scheduler* scheduler = FindOutputScheduler();
+    if (scheduler != nullptr)
+        CancelScheduledMessages(scheduler, handle, token);
+
+    return OUT_CANCELSCHEDULEDRESULT_OK;
+}
+
+API_EXPORT OUT_ACQUIRESYSEXBUFFERRESULT AcquireOutputDeviceSysExBuffer(void* handle, int size, void** buffer, Byte** data)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+
+    BufferPoolBuffer* poolBuffer = AcquireBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, static_cast<uint32_t>(SYSEX_BUFFER_HEADER_SIZE + size));
+    if (poolBuffer == nullptr)
+        return OUT_ACQUIRESYSEXBUFFERRESULT_NOMEMORY;
+
+    *buffer = poolBuffer;
+    *data = poolBuffer->data + SYSEX_BUFFER_HEADER_SIZE;
+
+    return OUT_ACQUIRESYSEXBUFFERRESULT_OK;
+}
+
+API_EXPORT void ReleaseOutputDeviceSysExBuffer(void* handle, void* buffer)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, reinterpret_cast<BufferPoolBuffer*>(buffer));
+}
+
+API_EXPORT OUT_SENDSYSEXRESULT SendSysExBufferToOutputDevice(void* handle, void* buffer, int size)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    BufferPoolBuffer* poolBuffer = reinterpret_cast<BufferPoolBuffer*>(buffer);
+
+    Byte* data = poolBuffer->data + SYSEX_BUFFER_HEADER_SIZE;
+    uint64_t timeStamp = GetMonotonicTimeInNanoseconds();
+    char sent;
+
+    if (size <= PACKET_MAXLENGTH)
+    {
+        MidiPacketList* packetList = reinterpret_cast<MidiPacketList*>(poolBuffer->data);
+        packetList->numPackets = 1;
+        packetList->packet[0].timeStamp = timeStamp;
+        packetList->packet[0].length = static_cast<uint16_t>(size);
+
+        sent = SendPacketListToDestination(outputDeviceHandle, poolBuffer->data, SYSEX_BUFFER_HEADER_SIZE + size);
+    }
+    else
+    {
+        std::vector<Byte> packetList;
+        InitPacketList(packetList);
+
+        for (int offset = 0; offset < size; offset += PACKET_MAXLENGTH)
+        {
+            int length = size - offset < PACKET_MAXLENGTH ? size - offset : PACKET_MAXLENGTH;
+            AddPacketToPacketList(packetList, timeStamp, data + offset, static_cast<size_t>(length));
+        }
+
+        sent = SendPacketListToDestination(outputDeviceHandle, packetList);
+    }
+
+    ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, poolBuffer);
+
+    if (!sent)
+        return OUT_SENDSYSEXRESULT_UNKNOWNENDPOINT;
+
+    return OUT_SENDSYSEXRESULT_OK;
+}
+
+API_EXPORT void GetOutputDeviceSysExBufferPoolCounters(void* handle, int64_t* acquisitionsCount, int64_t* reusesCount, int64_t* exhaustionsCount)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    BufferPool* bufferPool = outputDeviceHandle->sysExBufferPool;
+
+    *acquisitionsCount = bufferPool->acquisitionsCount.load(std::memory_order_relaxed);
+    *reusesCount = bufferPool->reusesCount.load(std::memory_order_relaxed);
+    *exhaustionsCount = bufferPool->exhaustionsCount.load(std::memory_order_relaxed);
+}
+
+API_EXPORT char IsOutputDevicePropertySupported(OUT_PROPERTY property)
+{
+    switch (property)
+    {
+        case OUT_PROPERTY_UNIQUEID:
+            return 1;
+    }
+
+    return 0;
+}
+
+/* ================================
+   Virtual device
+================================ */
+
+struct VirtualDeviceInfo
+{
+    InputDeviceInfo* inputDeviceInfo;
+    OutputDeviceInfo* outputDeviceInfo;
+    Endpoint* source;
+    Endpoint* destination;
+};
+
+static Endpoint* CreateEndpoint(Transport* transport, const char* name, char isSource)
+{
+    Endpoint* endpoint = new Endpoint();
+    endpoint->id = ++transport->lastEndpointId;
+    endpoint->name = strdup(name);
+    endpoint->isSource = isSource;
+    endpoint->readProc = nullptr;
+    endpoint->readProcRefCon = nullptr;
+    return endpoint;
+}
+
+API_EXPORT VIRTUAL_OPENRESULT OpenVirtualDevice_Linux(char* name, void* sessionHandle, ReadProc callback, void** info)
+{
+    Transport* transport = GetTransport();
+
+    VirtualDeviceInfo* virtualDeviceInfo = new VirtualDeviceInfo();
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(transport->mutex);
+
+        virtualDeviceInfo->source = CreateEndpoint(transport, name, 1);
+        virtualDeviceInfo->destination = CreateEndpoint(transport, name, 0);
+
+        InputDeviceInfo* inputDeviceInfo = new InputDeviceInfo();
+        inputDeviceInfo->endpointId = virtualDeviceInfo->source->id;
+        inputDeviceInfo->name[0] = '\0';
+        virtualDeviceInfo->inputDeviceInfo = inputDeviceInfo;
+
+        OutputDeviceInfo* outputDeviceInfo = new OutputDeviceInfo();
+        outputDeviceInfo->endpointId = virtualDeviceInfo->destination->id;
+        outputDeviceInfo->name[0] = '\0';
+        virtualDeviceInfo->outputDeviceInfo = outputDeviceInfo;
+
+        virtualDeviceInfo->destination->readProc = callback;
+        virtualDeviceInfo->destination->readProcRefCon = inputDeviceInfo;
+
+        transport->sources.push_back(virtualDeviceInfo->source);
+        transport->destinations.push_back(virtualDeviceInfo->destination);
+    }
+
+    NotifySessions(virtualDeviceInfo->source, 1);
+    NotifySessions(virtualDeviceInfo->destination, 1);
+
+    *info = virtualDeviceInfo;
+
+    return VIRTUAL_OPENRESULT_OK;
+}
+
+API_EXPORT VIRTUAL_CLOSERESULT CloseVirtualDevice(void* info)
+{
+    Transport* transport = GetTransport();
+    VirtualDeviceInfo* virtualDeviceInfo = reinterpret_cast<VirtualDeviceInfo*>(info);
+
+    {
+        std::unique_lock<std::recursive_mutex> lock(transport->mutex);
+
+        // Deliveries to input devices connected to the source can still be in progress,
+        // they are waited for when the devices are disconnected
+        for (size_t i = 0; i < virtualDeviceInfo->source->connections.size(); i++)
+        {
+            virtualDeviceInfo->source->connections[i]->connected = 0;
+        }
+
+        RemoveEndpoint(transport->sources, virtualDeviceInfo->source);
+        RemoveEndpoint(transport->destinations, virtualDeviceInfo->destination);
+
+        WaitForDeliveryCompleted(transport, lock, virtualDeviceInfo->destination);
+    }
+
+    NotifySessions(virtualDeviceInfo->source, 0);
+    NotifySessions(virtualDeviceInfo->destination, 0);
+
+    free(virtualDeviceInfo->source->name);
+    free(virtualDeviceInfo->destination->name);
+    delete virtualDeviceInfo->source;
+    delete virtualDeviceInfo->destination;
+    delete virtualDeviceInfo->inputDeviceInfo;
+    delete virtualDeviceInfo->outputDeviceInfo;
+    delete virtualDeviceInfo;
+
+    return VIRTUAL_CLOSERESULT_OK;
+}
+
+API_EXPORT VIRTUAL_SENDBACKRESULT SendDataBackFromVirtualDevice(const MidiPacketList* pktlist, void* readProcRefCon)
+{
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(readProcRefCon);
+
+    EnqueueDelivery(DELIVERY_KIND_TOSOURCE, inputDeviceInfo->endpointId, reinterpret_cast<const Byte*>(pktlist), GetPacketListSize(pktlist));
+
+    return VIRTUAL_SENDBACKRESULT_OK;
+}
+
+// Subdevices of a virtual device own their infos (closing a device handle deletes
+// its info), so copies are returned rather than the virtual device's own infos
+
+API_EXPORT void* GetInputDeviceInfoFromVirtualDevice(void* info)
+{
+    VirtualDeviceInfo* virtualDeviceInfo = reinterpret_cast<VirtualDeviceInfo*>(info);
+    return new InputDeviceInfo(*virtualDeviceInfo->inputDeviceInfo);
+}
+
+API_EXPORT void* GetOutputDeviceInfoFromVirtualDevice(void* info)
+{
+    VirtualDeviceInfo* virtualDeviceInfo = reinterpret_cast<VirtualDeviceInfo*>(info);
+    return new OutputDeviceInfo(*virtualDeviceInfo->outputDeviceInfo);
+}
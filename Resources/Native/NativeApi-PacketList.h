@@ -0,0 +1,56 @@
+#ifndef NATIVEAPI_PACKETLIST_H
+#define NATIVEAPI_PACKETLIST_H
+
+#include <cstdint>
+
+/* ================================
+   Packet list flattening
+================================ */
+
+// Converts a list of variable-length packets into caller-provided arrays of
+// data offsets (relative to the start of the list), data lengths and
+// timestamps walking the list only once. Platforms pass functors returning
+// the packet following the given one and the timestamp of a packet in
+// nanoseconds. Returns the number of packets in the list; arrays are filled
+// only if it doesn't exceed maxPacketsCount. On success dataSize receives the
+// number of bytes from the start of the list to the end of the last packet's
+// data, so a caller can copy all the data at once.
+
+template<typename TPacket, typename TGetNextPacket, typename TGetPacketTimestamp>
+static inline int FlattenPacketList(
+    const void* packetList,
+    const TPacket* firstPacket,
+    uint32_t packetsCount,
+    int maxPacketsCount,
+    int* offsets,
+    int* lengths,
+    int64_t* timestamps,
+    int* dataSize,
+    TGetNextPacket getNextPacket,
+    TGetPacketTimestamp getPacketTimestamp)
+{
+    *dataSize = 0;
+
+    if (maxPacketsCount < 0 || packetsCount > static_cast<uint32_t>(maxPacketsCount))
+        return static_cast<int>(packetsCount);
+
+    const unsigned char* start = static_cast<const unsigned char*>(packetList);
+    const TPacket* packet = firstPacket;
+
+    for (uint32_t i = 0; i < packetsCount; i++)
+    {
+        if (i > 0)
+            packet = getNextPacket(packet);
+
+        int offset = static_cast<int>(reinterpret_cast<const unsigned char*>(packet->data) - start);
+        offsets[i] = offset;
+        lengths[i] = static_cast<int>(packet->length);
+        timestamps[i] = static_cast<int64_t>(getPacketTimestamp(packet));
+
+        *dataSize = offset + lengths[i];
+    }
+
+    return static_cast<int>(packetsCount);
+}
+
+#endif
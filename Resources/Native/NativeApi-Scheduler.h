@@ -0,0 +1,215 @@
+#ifndef NATIVEAPI_SCHEDULER_H
+#define NATIVEAPI_SCHEDULER_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+/* ================================
+   Scheduler
+================================ */
+
+// Sends short messages at absolute times for backends whose OS API can't
+// schedule output. Messages wait in a heap ordered by time (and by the order
+// of scheduling for equal times) and are sent by a dedicated thread. The
+// thread sleeps until the earliest message is close to its time and then
+// spins for the rest of the interval, so accuracy doesn't depend on the
+// sleep granularity of the OS. Times are nanoseconds of the clock returned by
+// the getTime function passed on creation. Every message has an owner (the
+// object it's sent for) and a token which identifies the party scheduled it,
+// so messages of one party can be cancelled without touching messages other
+// parties scheduled for the same owner. All functions are thread-safe.
+
+#define SCHEDULER_SPINTHRESHOLD_NS 2000000ULL
+
+typedef uint64_t (*SchedulerGetTimeCallback)(void);
+typedef void (*SchedulerSendCallback)(void* owner, int message);
+typedef void (*SchedulerThreadCallback)(void);
+
+struct ScheduledMessage
+{
+    uint64_t time;
+    uint64_t sequenceNumber;
+    void* owner;
+    int64_t token;
+    int message;
+};
+
+struct ScheduledMessageComparer
+{
+    bool operator()(const ScheduledMessage& x, const ScheduledMessage& y) const
+    {
+        // Heap keeps the greatest element on top, so comparison is reversed
+        return x.time != y.time
+            ? x.time > y.time
+            : x.sequenceNumber > y.sequenceNumber;
+    }
+};
+
+struct Scheduler
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<ScheduledMessage> messages;
+    uint64_t lastSequenceNumber;
+    const void* sendingFor;
+    SchedulerGetTimeCallback getTime;
+    SchedulerSendCallback send;
+    SchedulerThreadCallback threadStarted;
+    std::thread::id threadId;
+};
+
+static inline void SchedulerThreadRoutine(Scheduler* scheduler)
+{
+    if (scheduler->threadStarted != nullptr)
+        scheduler->threadStarted();
+
+    std::unique_lock<std::mutex> lock(scheduler->mutex);
+
+    while (true)
+    {
+        if (scheduler->messages.empty())
+        {
+            scheduler->condition.wait(lock);
+            continue;
+        }
+
+        uint64_t time = scheduler->messages.front().time;
+        uint64_t now = scheduler->getTime();
+
+        if (time > now)
+        {
+            uint64_t remaining = time - now;
+            if (remaining > SCHEDULER_SPINTHRESHOLD_NS)
+                scheduler->condition.wait_for(lock, std::chrono::nanoseconds(remaining - SCHEDULER_SPINTHRESHOLD_NS));
+            else
+            {
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+            }
+
+            continue;
+        }
+
+        std::pop_heap(scheduler->messages.begin(), scheduler->messages.end(), ScheduledMessageComparer());
+        ScheduledMessage message = scheduler->messages.back();
+        scheduler->messages.pop_back();
+
+        scheduler->sendingFor = message.owner;
+        lock.unlock();
+
+        scheduler->send(message.owner, message.message);
+
+        lock.lock();
+        scheduler->sendingFor = nullptr;
+        scheduler->condition.notify_all();
+    }
+}
+
+// Scheduler lives until the process exits, so it's never deleted
+static inline Scheduler* CreateScheduler(SchedulerGetTimeCallback getTime, SchedulerSendCallback send, SchedulerThreadCallback threadStarted)
+{
+    Scheduler* scheduler = new (std::nothrow) Scheduler();
+    if (scheduler == nullptr)
+        return nullptr;
+
+    scheduler->lastSequenceNumber = 0;
+    scheduler->sendingFor = nullptr;
+    scheduler->getTime = getTime;
+    scheduler->send = send;
+    scheduler->threadStarted = threadStarted;
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(scheduler->mutex);
+
+        std::thread thread(SchedulerThreadRoutine, scheduler);
+        scheduler->threadId = thread.get_id();
+        thread.detach();
+    }
+    catch (...)
+    {
+        delete scheduler;
+        return nullptr;
+    }
+
+    return scheduler;
+}
+
+static inline char ScheduleMessage(Scheduler* scheduler, void* owner, int64_t token, uint64_t time, int message)
+{
+    std::lock_guard<std::mutex> lock(scheduler->mutex);
+
+    ScheduledMessage scheduledMessage;
+    scheduledMessage.time = time;
+    scheduledMessage.sequenceNumber = ++scheduler->lastSequenceNumber;
+    scheduledMessage.owner = owner;
+    scheduledMessage.token = token;
+    scheduledMessage.message = message;
+
+    try
+    {
+        scheduler->messages.push_back(scheduledMessage);
+    }
+    catch (...)
+    {
+        return 0;
+    }
+
+    std::push_heap(scheduler->messages.begin(), scheduler->messages.end(), ScheduledMessageComparer());
+
+    // Sending thread must recalculate its waiting time only if the new message
+    // is the earliest one
+    if (scheduler->messages.front().sequenceNumber == scheduledMessage.sequenceNumber)
+        scheduler->condition.notify_all();
+
+    return 1;
+}
+
+template<typename TPredicate>
+static inline void CancelScheduledMessagesIf(Scheduler* scheduler, void* owner, TPredicate predicate)
+{
+    std::unique_lock<std::mutex> lock(scheduler->mutex);
+
+    std::vector<ScheduledMessage>& messages = scheduler->messages;
+    messages.erase(
+        std::remove_if(messages.begin(), messages.end(), predicate),
+        messages.end());
+    std::make_heap(messages.begin(), messages.end(), ScheduledMessageComparer());
+
+    if (std::this_thread::get_id() == scheduler->threadId)
+        return;
+
+    while (scheduler->sendingFor == owner)
+    {
+        scheduler->condition.wait(lock);
+    }
+}
+
+// Removes all pending messages of the owner and waits until a message of the
+// owner being sent right now (if any) is sent, so the owner can be deleted
+// after the call
+static inline void CancelScheduledMessages(Scheduler* scheduler, void* owner)
+{
+    CancelScheduledMessagesIf(
+        scheduler,
+        owner,
+        [owner](const ScheduledMessage& message) { return message.owner == owner; });
+}
+
+// Removes pending messages of the owner scheduled with the token
+static inline void CancelScheduledMessages(Scheduler* scheduler, void* owner, int64_t token)
+{
+    CancelScheduledMessagesIf(
+        scheduler,
+        owner,
+        [owner, token](const ScheduledMessage& message) { return message.owner == owner && message.token == token; });
+}
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef NATIVEAPI_THRU_H
+#define NATIVEAPI_THRU_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/* ================================
+   Thru routing
+================================ */
+
+// Forwards short messages received by input devices to output devices right
+// in the input callback of a backend, so no managed code is involved. Every
+// route connects an input handle to an output handle and carries two maps:
+// statusesMap holds the status byte to send for each received status byte
+// (zero means the message is dropped), so filtering by channel and message
+// type and remapping of channels are all expressed by it; notesMap holds the
+// note number to send for Note Off, Note On and Polyphonic Key Pressure
+// messages (THRU_DROPNOTE means the message is dropped). SysEx messages are
+// not routed. Routes are identified by positive numbers rather than pointers,
+// so removing a route that is already gone (a device closed first) is safe.
+// All functions are thread-safe.
+
+#define THRU_STATUSESMAPSIZE 256
+#define THRU_NOTESMAPSIZE 128
+#define THRU_DROPNOTE 0xFF
+
+struct ThruRoute
+{
+    int id;
+    const void* inputHandle;
+    void* outputHandle;
+    unsigned char statusesMap[THRU_STATUSESMAPSIZE];
+    unsigned char notesMap[THRU_NOTESMAPSIZE];
+};
+
+struct ThruRouter
+{
+    std::mutex mutex;
+    std::vector<ThruRoute*> routes;
+    std::atomic<int> routesCount;
+    int lastRouteId;
+};
+
+// Router lives until the process exits, so it's never deleted
+static inline ThruRouter* GetThruRouter()
+{
+    static ThruRouter* router = new ThruRouter();
+    return router;
+}
+
+static inline int AddThruRoute(const void* inputHandle, void* outputHandle, const unsigned char* statusesMap, const unsigned char* notesMap)
+{
+    ThruRoute* route = new (std::nothrow) ThruRoute();
+    if (route == nullptr)
+        return 0;
+
+    route->inputHandle = inputHandle;
+    route->outputHandle = outputHandle;
+    memcpy(route->statusesMap, statusesMap, THRU_STATUSESMAPSIZE);
+    memcpy(route->notesMap, notesMap, THRU_NOTESMAPSIZE);
+
+    ThruRouter* router = GetThruRouter();
+    std::lock_guard<std::mutex> lock(router->mutex);
+
+    try
+    {
+        router->routes.push_back(route);
+    }
+    catch (...)
+    {
+        delete route;
+        return 0;
+    }
+
+    route->id = ++router->lastRouteId;
+    router->routesCount.store(static_cast<int>(router->routes.size()));
+
+    return route->id;
+}
+
+// Removing takes the lock held while messages are routed, so after the call
+// returns no message is being sent via removed routes and their devices can
+// be closed
+static inline void RemoveThruRoutes(int routeId, const void* deviceHandle)
+{
+    ThruRouter* router = GetThruRouter();
+    std::lock_guard<std::mutex> lock(router->mutex);
+
+    std::vector<ThruRoute*>& routes = router->routes;
+
+    for (size_t i = 0; i < routes.size();)
+    {
+        ThruRoute* route = routes[i];
+        if (route->id == routeId || (deviceHandle != nullptr && (route->inputHandle == deviceHandle || route->outputHandle == deviceHandle)))
+        {
+            routes.erase(routes.begin() + i);
+            delete route;
+        }
+        else
+            i++;
+    }
+
+    router->routesCount.store(static_cast<int>(routes.size()));
+}
+
+static inline void RemoveThruRoute(int routeId)
+{
+    RemoveThruRoutes(routeId, nullptr);
+}
+
+static inline void RemoveDeviceThruRoutes(const void* deviceHandle)
+{
+    RemoveThruRoutes(0, deviceHandle);
+}
+
+static inline char HasThruRoutes()
+{
+    return GetThruRouter()->routesCount.load(std::memory_order_relaxed) > 0;
+}
+
+static inline int GetThruMessageDataLength(unsigned char statusByte)
+{
+    if (statusByte < 0xF0)
+        return (statusByte & 0xE0) == 0xC0 ? 1 : 2;
+
+    switch (statusByte)
+    {
+        case 0xF1:
+        case 0xF3:
+            return 1;
+        case 0xF2:
+            return 2;
+    }
+
+    return 0;
+}
+
+// Message is packed as by midiOutShortMsg: status byte in the lowest byte
+// followed by data bytes; must be called with the router lock held
+template<typename TSend>
+static inline void RouteThruMessage(ThruRouter* router, const void* inputHandle, int message, TSend send)
+{
+    unsigned char statusByte = static_cast<unsigned char>(message & 0xFF);
+    unsigned char channelStatus = static_cast<unsigned char>(statusByte >> 4);
+    char hasNoteNumber = channelStatus == 0x8 || channelStatus == 0x9 || channelStatus == 0xA;
+
+    std::vector<ThruRoute*>& routes = router->routes;
+
+    for (size_t i = 0; i < routes.size(); i++)
+    {
+        ThruRoute* route = routes[i];
+        if (route->inputHandle != inputHandle)
+            continue;
+
+        unsigned char outputStatusByte = route->statusesMap[statusByte];
+        if (outputStatusByte == 0)
+            continue;
+
+        int outputMessage = (message & 0xFFFF00) | outputStatusByte;
+
+        if (hasNoteNumber)
+        {
+            unsigned char noteNumber = route->notesMap[(message >> 8) & 0x7F];
+            if (noteNumber == THRU_DROPNOTE)
+                continue;
+
+            outputMessage = (outputMessage & 0xFF00FF) | (noteNumber << 8);
+        }
+
+        send(route->outputHandle, outputMessage);
+    }
+}
+
+template<typename TSend>
+static inline void RouteThruShortMessage(const void* inputHandle, int message, TSend send)
+{
+    if (!HasThruRoutes())
+        return;
+
+    ThruRouter* router = GetThruRouter();
+    std::lock_guard<std::mutex> lock(router->mutex);
+
+    RouteThruMessage(router, inputHandle, message, send);
+}
+
+// Splits raw data (a packet of a packet list) into short messages taking
+// running status into account; SysEx data is skipped
+template<typename TSend>
+static inline void RouteThruData(const void* inputHandle, const unsigned char* data, size_t length, TSend send)
+{
+    if (!HasThruRoutes())
+        return;
+
+    ThruRouter* router = GetThruRouter();
+    std::lock_guard<std::mutex> lock(router->mutex);
+
+    unsigned char runningStatus = 0;
+    size_t i = 0;
+
+    while (i < length)
+    {
+        unsigned char currentByte = data[i];
+
+        if (currentByte >= 0xF8)
+        {
+            RouteThruMessage(router, inputHandle, currentByte, send);
+            i++;
+            continue;
+        }
+
+        if (currentByte == 0xF0)
+        {
+            runningStatus = 0;
+            for (i++; i < length && data[i] != 0xF7; i++)
+            {
+            }
+
+            i++;
+            continue;
+        }
+
+        unsigned char statusByte;
+        if (currentByte & 0x80)
+        {
+            statusByte = currentByte;
+            runningStatus = statusByte < 0xF0 ? statusByte : 0;
+            i++;
+        }
+        else if (runningStatus != 0)
+            statusByte = runningStatus;
+        else
+        {
+            i++;
+            continue;
+        }
+
+        int dataLength = GetThruMessageDataLength(statusByte);
+        if (i + dataLength > length)
+            break;
+
+        int message = statusByte;
+        for (int j = 0; j < dataLength; j++)
+        {
+            message |= data[i + j] << (8 * (j + 1));
+        }
+
+        i += dataLength;
+
+        RouteThruMessage(router, inputHandle, message, send);
+    }
+}
+
+#endif
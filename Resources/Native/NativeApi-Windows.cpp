@@ -9,9 +9,14 @@
 #include <mmreg.h>
 
 #include <algorithm>
+#include <atomic>
 #include <new>
 
 #include "NativeApi-Constants.h"
+#include "NativeApi-InputBuffer.h"
+#include "NativeApi-BufferPool.h"
+#include "NativeApi-Scheduler.h"
+#include "NativeApi-Thru.h"
 
 #define API_EXPORT extern "C" __declspec(dllexport)
 #define API_CALL
@@ -30,6 +35,25 @@ API_EXPORT char API_CALL CanCompareDevices()
     return 0;
 }
 
+static uint64_t GetMonotonicTimeInNanoseconds()
+{
+    static LARGE_INTEGER frequency = { 0 };
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    uint64_t seconds = counter.QuadPart / frequency.QuadPart;
+    uint64_t remainder = counter.QuadPart % frequency.QuadPart;
+    return seconds * 1000000000ULL + remainder * 1000000000ULL / frequency.QuadPart;
+}
+
+API_EXPORT LONGLONG API_CALL GetMonotonicTimestamp()
+{
+    return (LONGLONG)GetMonotonicTimeInNanoseconds();
+}
+
 /* ================================
    High-precision tick generator
 ================================ */
@@ -39,10 +63,21 @@ typedef struct
     char dummy;
 } TickGeneratorSessionHandle;
 
+// One-shot tick generator sets a new one-shot multimedia timer event for every scheduled
+// tick since such events can't be rearmed. Event ID is stored and cleared by the event's
+// callback under the same lock, so the ID of a fired event (which can be reused by the
+// system) is never stored and never passed to timeKillEvent. timeKillEvent is called outside
+// of the lock since with TIME_KILL_SYNCHRONOUS it waits for a running callback
+
 typedef struct
 {
     UINT timerResolution;
     UINT timerId;
+    BOOL oneShot;
+    UINT maxDelay;
+    LPTIMECALLBACK callback;
+    CRITICAL_SECTION oneShotTimerLock;
+    UINT oneShotTimerId;
 } TickGeneratorInfo;
 
 API_EXPORT TGSESSION_OPENRESULT API_CALL OpenTickGeneratorSession(void** handle)
@@ -76,21 +111,135 @@ API_EXPORT TG_STARTRESULT API_CALL StartHighPrecisionTickGenerator_Win(int inter
     return TG_STARTRESULT_OK;
 }
 
+API_EXPORT TG_STARTRESULT API_CALL StartOneShotHighPrecisionTickGenerator_Win(void* sessionHandle, LPTIMECALLBACK callback, TickGeneratorInfo** info)
+{
+    TIMECAPS tc;
+    MMRESULT result = timeGetDevCaps(&tc, sizeof(TIMECAPS));
+    if (result != TIMERR_NOERROR)
+        return TG_STARTRESULT_CANTGETDEVICECAPABILITIES;
+
+    timeBeginPeriod(tc.wPeriodMin);
+
+    TickGeneratorInfo* tickGeneratorInfo = new TickGeneratorInfo();
+    tickGeneratorInfo->timerResolution = tc.wPeriodMin;
+    tickGeneratorInfo->oneShot = TRUE;
+    tickGeneratorInfo->maxDelay = tc.wPeriodMax;
+    tickGeneratorInfo->callback = callback;
+    tickGeneratorInfo->oneShotTimerId = 0;
+    InitializeCriticalSection(&tickGeneratorInfo->oneShotTimerLock);
+    *info = tickGeneratorInfo;
+
+    return TG_STARTRESULT_OK;
+}
+
+static void CALLBACK OneShotTimerCallback(UINT uTimerID, UINT uMsg, DWORD_PTR dwUser, DWORD_PTR dw1, DWORD_PTR dw2)
+{
+    TickGeneratorInfo* tickGeneratorInfo = reinterpret_cast<TickGeneratorInfo*>(dwUser);
+    LPTIMECALLBACK callback = tickGeneratorInfo->callback;
+
+    // Info can be deleted by the callback if the generator is stopped, so it must not
+    // be accessed after the callback is invoked
+    EnterCriticalSection(&tickGeneratorInfo->oneShotTimerLock);
+    if (tickGeneratorInfo->oneShotTimerId == uTimerID)
+        tickGeneratorInfo->oneShotTimerId = 0;
+    LeaveCriticalSection(&tickGeneratorInfo->oneShotTimerLock);
+
+    callback(uTimerID, uMsg, 0, dw1, dw2);
+}
+
+API_EXPORT TG_SCHEDULERESULT API_CALL ScheduleHighPrecisionTickGeneratorTick(TickGeneratorSessionHandle* sessionHandle, TickGeneratorInfo* info, LONGLONG delayInMicroseconds)
+{
+    if (!info->oneShot)
+        return TG_SCHEDULERESULT_CANTSETTIMERCALLBACK;
+
+    EnterCriticalSection(&info->oneShotTimerLock);
+    UINT previousTimerId = info->oneShotTimerId;
+    info->oneShotTimerId = 0;
+    LeaveCriticalSection(&info->oneShotTimerLock);
+
+    if (previousTimerId != 0)
+        timeKillEvent(previousTimerId);
+
+    // Too long delays are not supported by multimedia timers, so a tick is generated
+    // earlier and the caller schedules the next one from it
+    LONGLONG delayInMilliseconds = (delayInMicroseconds + 999) / 1000;
+    UINT delay = (UINT)std::min(std::max(delayInMilliseconds, (LONGLONG)1), (LONGLONG)info->maxDelay);
+
+    // Event can fire before timeSetEvent returns, so its ID is stored under the lock the
+    // callback waits for to clear it
+    EnterCriticalSection(&info->oneShotTimerLock);
+    MMRESULT timerId = timeSetEvent(
+        delay,
+        info->timerResolution,
+        OneShotTimerCallback,
+        reinterpret_cast<DWORD_PTR>(info),
+        TIME_ONESHOT | TIME_CALLBACK_FUNCTION | TIME_KILL_SYNCHRONOUS);
+    info->oneShotTimerId = timerId;
+    LeaveCriticalSection(&info->oneShotTimerLock);
+
+    if (timerId == 0)
+        return TG_SCHEDULERESULT_CANTSETTIMERCALLBACK;
+
+    return TG_SCHEDULERESULT_OK;
+}
+
 API_EXPORT TG_STOPRESULT API_CALL StopHighPrecisionTickGenerator(TickGeneratorSessionHandle* sessionHandle, TickGeneratorInfo* info)
 {
     MMRESULT result = timeEndPeriod(info->timerResolution);
     if (result != TIMERR_NOERROR)
         return TG_STOPRESULT_CANTENDPERIOD;
 
-    result = timeKillEvent(info->timerId);
-    if (result != TIMERR_NOERROR)
-        return TG_STOPRESULT_CANTKILLEVENT;
+    if (info->oneShot)
+    {
+        EnterCriticalSection(&info->oneShotTimerLock);
+        UINT timerId = info->oneShotTimerId;
+        info->oneShotTimerId = 0;
+        LeaveCriticalSection(&info->oneShotTimerLock);
+
+        // Event may be firing right now, so result of killing is not checked; the kill
+        // waits for its callback to leave, so the lock can be safely deleted after it
+        if (timerId != 0)
+            timeKillEvent(timerId);
+
+        DeleteCriticalSection(&info->oneShotTimerLock);
+    }
+    else
+    {
+        result = timeKillEvent(info->timerId);
+        if (result != TIMERR_NOERROR)
+            return TG_STOPRESULT_CANTKILLEVENT;
+    }
 
     delete info;
 
     return TG_STOPRESULT_OK;
 }
 
+// Raises resolution of system timers (and so of waits of all threads in the process)
+// for the callers which generate ticks by themselves
+
+API_EXPORT TG_STARTRESULT API_CALL BeginTimerPeriod_Win(UINT* period)
+{
+    TIMECAPS tc;
+    MMRESULT result = timeGetDevCaps(&tc, sizeof(TIMECAPS));
+    if (result != TIMERR_NOERROR)
+        return TG_STARTRESULT_CANTGETDEVICECAPABILITIES;
+
+    timeBeginPeriod(tc.wPeriodMin);
+    *period = tc.wPeriodMin;
+
+    return TG_STARTRESULT_OK;
+}
+
+API_EXPORT TG_STOPRESULT API_CALL EndTimerPeriod_Win(UINT period)
+{
+    MMRESULT result = timeEndPeriod(period);
+    if (result != TIMERR_NOERROR)
+        return TG_STOPRESULT_CANTENDPERIOD;
+
+    return TG_STOPRESULT_OK;
+}
+
 /* ================================
    Devices common
 ================================ */
@@ -266,11 +415,21 @@ API_EXPORT SESSION_CLOSERESULT API_CALL CloseSession(void* handle)
    Input device
 ================================ */
 
+// Several SysEx buffers are kept queued in the driver so incoming SysEx data
+// has somewhere to go while a filled buffer is being processed
+#define INPUT_SYSEXBUFFERSCOUNT 4
+
 typedef struct
 {
     InputDeviceInfo* info;
     HMIDIIN handle;
-    LPMIDIHDR sysExHeader;
+    LPMIDIHDR sysExHeaders[INPUT_SYSEXBUFFERSCOUNT];
+    int sysExHeadersCount;
+    InputBuffer* inputBuffer;
+    HANDLE inputBufferEvent;
+    std::atomic<char> closing;
+    uint64_t startTimestamp;
+    LPMIDICALLBACK callback;
 } InputDeviceHandle;
 
 API_EXPORT int API_CALL GetInputDevicesCount()
@@ -345,11 +504,13 @@ API_EXPORT IN_PREPARESYSEXBUFFERRESULT API_CALL PrepareInputDeviceSysExBuffer(vo
 {
     InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
 
+    if (inputDeviceHandle->sysExHeadersCount >= INPUT_SYSEXBUFFERSCOUNT)
+        return IN_PREPARESYSEXBUFFERRESULT_OK;
+
     LPMIDIHDR header = new MIDIHDR();
     header->lpData = new char[size];
     header->dwBufferLength = size;
     header->dwFlags = 0;
-    inputDeviceHandle->sysExHeader = header;
 
     MMRESULT result = midiInPrepareHeader(inputDeviceHandle->handle, header, sizeof(MIDIHDR));
     if (result != MMSYSERR_NOERROR)
@@ -375,7 +536,6 @@ API_EXPORT IN_PREPARESYSEXBUFFERRESULT API_CALL PrepareInputDeviceSysExBuffer(vo
         midiInUnprepareHeader(inputDeviceHandle->handle, header, sizeof(MIDIHDR));
         delete [] reinterpret_cast<char*>(header->lpData);
         delete header;
-        inputDeviceHandle->sysExHeader = nullptr;
 
         switch (result)
         {
@@ -389,6 +549,20 @@ API_EXPORT IN_PREPARESYSEXBUFFERRESULT API_CALL PrepareInputDeviceSysExBuffer(vo
         return IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_UNKNOWNERROR;
     }
 
+    inputDeviceHandle->sysExHeaders[inputDeviceHandle->sysExHeadersCount++] = header;
+
+    return IN_PREPARESYSEXBUFFERRESULT_OK;
+}
+
+static IN_PREPARESYSEXBUFFERRESULT PrepareInputDeviceSysExBuffers(InputDeviceHandle* inputDeviceHandle, int size)
+{
+    for (int i = 0; i < INPUT_SYSEXBUFFERSCOUNT; i++)
+    {
+        IN_PREPARESYSEXBUFFERRESULT result = PrepareInputDeviceSysExBuffer(inputDeviceHandle, size);
+        if (result != IN_PREPARESYSEXBUFFERRESULT_OK)
+            return result;
+    }
+
     return IN_PREPARESYSEXBUFFERRESULT_OK;
 }
 
@@ -396,76 +570,246 @@ API_EXPORT IN_UNPREPARESYSEXBUFFERRESULT API_CALL UnprepareInputDeviceSysExBuffe
 {
     InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
 
-    if (inputDeviceHandle->sysExHeader == nullptr)
-        return IN_UNPREPARESYSEXBUFFERRESULT_OK;
+    while (inputDeviceHandle->sysExHeadersCount > 0)
+    {
+        LPMIDIHDR header = inputDeviceHandle->sysExHeaders[inputDeviceHandle->sysExHeadersCount - 1];
+
+        MMRESULT result = midiInUnprepareHeader(inputDeviceHandle->handle, header, sizeof(MIDIHDR));
+        if (result != MMSYSERR_NOERROR)
+        {
+            switch (result)
+            {
+                case MIDIERR_STILLPLAYING: return IN_UNPREPARESYSEXBUFFERRESULT_STILLPLAYING;
+                case MMSYSERR_INVALPARAM: return IN_UNPREPARESYSEXBUFFERRESULT_INVALIDSTRUCTURE;
+                case MMSYSERR_INVALHANDLE: return IN_UNPREPARESYSEXBUFFERRESULT_INVALIDHANDLE;
+            }
+            
+            return IN_UNPREPARESYSEXBUFFERRESULT_UNKNOWNERROR;
+        }
+
+        delete [] reinterpret_cast<char*>(header->lpData);
+        delete header;
+        inputDeviceHandle->sysExHeadersCount--;
+    }
+
+    return IN_UNPREPARESYSEXBUFFERRESULT_OK;
+}
+
+// Hands a filled buffer back to the driver. The buffer stays prepared so no
+// memory is allocated or freed per SysEx message
+API_EXPORT IN_RENEWSYSEXBUFFERRESULT API_CALL RenewInputDeviceSysExBuffer(void* handle, LPMIDIHDR header)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
+
+    if (inputDeviceHandle->closing.load())
+        return IN_RENEWSYSEXBUFFERRESULT_OK;
+
+    header->dwBytesRecorded = 0;
 
-    MMRESULT result = midiInUnprepareHeader(inputDeviceHandle->handle, inputDeviceHandle->sysExHeader, sizeof(MIDIHDR));
+    MMRESULT result = midiInAddBuffer(inputDeviceHandle->handle, header, sizeof(MIDIHDR));
     if (result != MMSYSERR_NOERROR)
     {
         switch (result)
         {
-            case MIDIERR_STILLPLAYING: return IN_UNPREPARESYSEXBUFFERRESULT_STILLPLAYING;
-            case MMSYSERR_INVALPARAM: return IN_UNPREPARESYSEXBUFFERRESULT_INVALIDSTRUCTURE;
-            case MMSYSERR_INVALHANDLE: return IN_UNPREPARESYSEXBUFFERRESULT_INVALIDHANDLE;
+            case MIDIERR_STILLPLAYING: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_STILLPLAYING;
+            case MIDIERR_UNPREPARED: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_UNPREPARED;
+            case MMSYSERR_INVALHANDLE: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_INVALIDHANDLE;
+            case MMSYSERR_INVALPARAM: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_INVALIDSTRUCTURE;
+            case MMSYSERR_NOMEM: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_NOMEMORY;
         }
         
-        return IN_UNPREPARESYSEXBUFFERRESULT_UNKNOWNERROR;
+        return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_UNKNOWNERROR;
     }
 
-    delete [] reinterpret_cast<char*>(inputDeviceHandle->sysExHeader->lpData);
-    delete inputDeviceHandle->sysExHeader;
-    inputDeviceHandle->sysExHeader = nullptr;
+    return IN_RENEWSYSEXBUFFERRESULT_OK;
+}
 
-    return IN_UNPREPARESYSEXBUFFERRESULT_OK;
+API_EXPORT OUT_SENDSHORTRESULT API_CALL SendShortEventToOutputDevice(void* handle, int message);
+
+static void SendThruShortMessage(void* outputHandle, int message)
+{
+    SendShortEventToOutputDevice(outputHandle, message);
+}
+
+// Messages are routed by the thru router first and then passed to the
+// callback provided on opening as is
+static void CALLBACK OnMessage(HMIDIIN hMidiIn, UINT wMsg, DWORD_PTR dwInstance, DWORD_PTR dwParam1, DWORD_PTR dwParam2)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)dwInstance;
+
+    if (wMsg == MIM_DATA)
+        RouteThruShortMessage(inputDeviceHandle, (int)dwParam1, SendThruShortMessage);
+
+    inputDeviceHandle->callback((HDRVR)hMidiIn, wMsg, 0, dwParam1, dwParam2);
 }
 
-API_EXPORT IN_RENEWSYSEXBUFFERRESULT API_CALL RenewInputDeviceSysExBuffer(void* handle, int size)
+API_EXPORT IN_OPENRESULT API_CALL OpenInputDevice_Win(void* info, void* sessionHandle, DWORD_PTR callback, int sysExBufferSize, void** handle)
 {
-    IN_UNPREPARESYSEXBUFFERRESULT unprepareResult = UnprepareInputDeviceSysExBuffer(handle);
-    if (unprepareResult != IN_UNPREPARESYSEXBUFFERRESULT_OK)
+    InputDeviceInfo* inputDeviceInfo = (InputDeviceInfo*)info;
+
+    InputDeviceHandle* inputDeviceHandle = new InputDeviceHandle();
+    inputDeviceHandle->info = inputDeviceInfo;
+    inputDeviceHandle->sysExHeadersCount = 0;
+    inputDeviceHandle->inputBuffer = nullptr;
+    inputDeviceHandle->inputBufferEvent = nullptr;
+    inputDeviceHandle->closing = 0;
+    inputDeviceHandle->startTimestamp = 0;
+    inputDeviceHandle->callback = (LPMIDICALLBACK)callback;
+
+    HMIDIIN inHandle;
+    MMRESULT result = midiInOpen(&inHandle, inputDeviceInfo->deviceIndex, (DWORD_PTR)OnMessage, (DWORD_PTR)inputDeviceHandle, CALLBACK_FUNCTION);
+    if (result != MMSYSERR_NOERROR)
     {
-        switch (unprepareResult)
+        delete inputDeviceHandle;
+
+        switch (result)
         {
-            case IN_UNPREPARESYSEXBUFFERRESULT_STILLPLAYING: return IN_RENEWSYSEXBUFFERRESULT_UNPREPAREBUFFER_STILLPLAYING;
-            case IN_UNPREPARESYSEXBUFFERRESULT_INVALIDSTRUCTURE: return IN_RENEWSYSEXBUFFERRESULT_UNPREPAREBUFFER_INVALIDSTRUCTURE;
-            case IN_UNPREPARESYSEXBUFFERRESULT_INVALIDHANDLE: return IN_RENEWSYSEXBUFFERRESULT_UNPREPAREBUFFER_INVALIDHANDLE;
-            case IN_UNPREPARESYSEXBUFFERRESULT_UNKNOWNERROR: return IN_RENEWSYSEXBUFFERRESULT_UNPREPAREBUFFER_UNKNOWNERROR;
+            case MMSYSERR_ALLOCATED: return IN_OPENRESULT_ALLOCATED;
+            case MMSYSERR_BADDEVICEID: return IN_OPENRESULT_BADDEVICEID;
+            case MMSYSERR_INVALFLAG: return IN_OPENRESULT_INVALIDFLAG;
+            case MMSYSERR_INVALPARAM: return IN_OPENRESULT_INVALIDSTRUCTURE;
+            case MMSYSERR_NOMEM: return IN_OPENRESULT_NOMEMORY;
         }
+        
+        return IN_OPENRESULT_UNKNOWNERROR;
     }
 
-    IN_PREPARESYSEXBUFFERRESULT prepareResult = PrepareInputDeviceSysExBuffer(handle, size);
-    if (prepareResult != IN_PREPARESYSEXBUFFERRESULT_OK)
+    inputDeviceHandle->handle = inHandle;
+
+    IN_PREPARESYSEXBUFFERRESULT prepareBufferResult = PrepareInputDeviceSysExBuffers(inputDeviceHandle, sysExBufferSize);
+    if (prepareBufferResult != IN_PREPARESYSEXBUFFERRESULT_OK)
     {
-        switch (prepareResult)
+        // on failure, close handle
+        midiInClose(inputDeviceHandle->handle);
+        delete inputDeviceHandle;
+
+        switch (prepareBufferResult)
         {
-            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_NOMEMORY: return IN_RENEWSYSEXBUFFERRESULT_PREPAREBUFFER_NOMEMORY;
-            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_INVALIDHANDLE: return IN_RENEWSYSEXBUFFERRESULT_PREPAREBUFFER_INVALIDHANDLE;
-            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_INVALIDADDRESS: return IN_RENEWSYSEXBUFFERRESULT_PREPAREBUFFER_INVALIDADDRESS;
-            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_UNKNOWNERROR: return IN_RENEWSYSEXBUFFERRESULT_PREPAREBUFFER_UNKNOWNERROR;
-            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_NOMEMORY: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_NOMEMORY;
-            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_STILLPLAYING: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_STILLPLAYING;
-            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_UNPREPARED: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_UNPREPARED;
-            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_INVALIDHANDLE: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_INVALIDHANDLE;
-            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_INVALIDSTRUCTURE: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_INVALIDSTRUCTURE;
-            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_UNKNOWNERROR: return IN_RENEWSYSEXBUFFERRESULT_ADDBUFFER_UNKNOWNERROR;
+            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_NOMEMORY: return IN_OPENRESULT_PREPAREBUFFER_NOMEMORY;
+            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_INVALIDHANDLE: return IN_OPENRESULT_PREPAREBUFFER_INVALIDHANDLE;
+            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_INVALIDADDRESS: return IN_OPENRESULT_PREPAREBUFFER_INVALIDADDRESS;
+            case IN_PREPARESYSEXBUFFERRESULT_PREPAREBUFFER_UNKNOWNERROR: return IN_OPENRESULT_PREPAREBUFFER_UNKNOWNERROR;
+            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_NOMEMORY: return IN_OPENRESULT_ADDBUFFER_NOMEMORY;
+            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_STILLPLAYING: return IN_OPENRESULT_ADDBUFFER_STILLPLAYING;
+            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_UNPREPARED: return IN_OPENRESULT_ADDBUFFER_UNPREPARED;
+            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_INVALIDHANDLE: return IN_OPENRESULT_ADDBUFFER_INVALIDHANDLE;
+            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_INVALIDSTRUCTURE: return IN_OPENRESULT_ADDBUFFER_INVALIDSTRUCTURE;
+            case IN_PREPARESYSEXBUFFERRESULT_ADDBUFFER_UNKNOWNERROR: return IN_OPENRESULT_ADDBUFFER_UNKNOWNERROR;
         }
     }
 
-    return IN_RENEWSYSEXBUFFERRESULT_OK;
+    *handle = inputDeviceHandle;
+    return IN_OPENRESULT_OK;
 }
 
-API_EXPORT IN_OPENRESULT API_CALL OpenInputDevice_Win(void* info, void* sessionHandle, DWORD_PTR callback, int sysExBufferSize, void** handle)
+static DWORD GetShortMessageLength(BYTE statusByte)
+{
+    if (statusByte < 0xF0)
+        return (statusByte & 0xE0) == 0xC0 ? 2 : 3;
+
+    switch (statusByte)
+    {
+        case 0xF1:
+        case 0xF3:
+            return 2;
+        case 0xF2:
+            return 3;
+    }
+
+    return 1;
+}
+
+// Driver reports message time in milliseconds since midiInStart, so it's
+// shifted by the start time to get the same timebase on all platforms
+static uint64_t GetMessageTimestamp(InputDeviceHandle* inputDeviceHandle, DWORD_PTR time)
+{
+    return inputDeviceHandle->startTimestamp + (uint64_t)time * 1000000ULL;
+}
+
+API_EXPORT LONGLONG API_CALL GetInputDeviceMessageTimestamp_Win(void* handle, DWORD_PTR time)
+{
+    return (LONGLONG)GetMessageTimestamp((InputDeviceHandle*)handle, time);
+}
+
+static void PushSysExToInputBuffer(InputDeviceHandle* inputDeviceHandle, LPMIDIHDR header, uint64_t timestamp, uint32_t flags, char* signalRequired)
+{
+    if (header->dwBytesRecorded > 0 &&
+        PushToInputBuffer(inputDeviceHandle->inputBuffer, timestamp, flags, header->lpData, header->dwBytesRecorded))
+        *signalRequired = 1;
+
+    // Buffer is returned to the driver right here so SysEx data keeps flowing
+    // without a round trip to managed code
+    if (!inputDeviceHandle->closing.load())
+        midiInAddBuffer(inputDeviceHandle->handle, header, sizeof(MIDIHDR));
+}
+
+static void CALLBACK OnMessageBuffered(HMIDIIN hMidiIn, UINT wMsg, DWORD_PTR dwInstance, DWORD_PTR dwParam1, DWORD_PTR dwParam2)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)dwInstance;
+    if (inputDeviceHandle == nullptr || inputDeviceHandle->inputBuffer == nullptr)
+        return;
+
+    uint64_t timestamp = GetMessageTimestamp(inputDeviceHandle, dwParam2);
+    char signalRequired = 0;
+
+    switch (wMsg)
+    {
+        case MIM_DATA:
+        case MIM_ERROR:
+        {
+            DWORD message = (DWORD)dwParam1;
+            BYTE data[4] = { (BYTE)(message & 0xFF), (BYTE)((message >> 8) & 0xFF), (BYTE)((message >> 16) & 0xFF), (BYTE)((message >> 24) & 0xFF) };
+            uint32_t flags = wMsg == MIM_ERROR ? INPUTBUFFER_RECORDFLAG_INVALIDSHORTEVENT : 0;
+            DWORD length = wMsg == MIM_ERROR ? 4 : GetShortMessageLength(data[0]);
+
+            if (wMsg == MIM_DATA)
+                RouteThruShortMessage(inputDeviceHandle, (int)message, SendThruShortMessage);
+
+            signalRequired = PushToInputBuffer(inputDeviceHandle->inputBuffer, timestamp, flags, data, length);
+            break;
+        }
+        case MIM_LONGDATA:
+            PushSysExToInputBuffer(inputDeviceHandle, (LPMIDIHDR)dwParam1, timestamp, 0, &signalRequired);
+            break;
+        case MIM_LONGERROR:
+            PushSysExToInputBuffer(inputDeviceHandle, (LPMIDIHDR)dwParam1, timestamp, INPUTBUFFER_RECORDFLAG_INVALIDSYSEXEVENT, &signalRequired);
+            break;
+    }
+
+    if (signalRequired)
+        SetEvent(inputDeviceHandle->inputBufferEvent);
+}
+
+API_EXPORT IN_OPENRESULT API_CALL OpenInputDeviceBuffered_Win(void* info, void* sessionHandle, int sysExBufferSize, int bufferSize, void** handle)
 {
     InputDeviceInfo* inputDeviceInfo = (InputDeviceInfo*)info;
 
+    InputBuffer* inputBuffer = CreateInputBuffer(bufferSize);
+    if (inputBuffer == nullptr)
+        return IN_OPENRESULT_NOMEMORY;
+
+    HANDLE inputBufferEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (inputBufferEvent == nullptr)
+    {
+        DeleteInputBuffer(inputBuffer);
+        return IN_OPENRESULT_UNKNOWNERROR;
+    }
+
     InputDeviceHandle* inputDeviceHandle = new InputDeviceHandle();
     inputDeviceHandle->info = inputDeviceInfo;
-    inputDeviceHandle->sysExHeader = nullptr;
+    inputDeviceHandle->sysExHeadersCount = 0;
+    inputDeviceHandle->inputBuffer = inputBuffer;
+    inputDeviceHandle->inputBufferEvent = inputBufferEvent;
+    inputDeviceHandle->closing = 0;
+    inputDeviceHandle->startTimestamp = 0;
+    inputDeviceHandle->callback = nullptr;
 
     HMIDIIN inHandle;
-    MMRESULT result = midiInOpen(&inHandle, inputDeviceInfo->deviceIndex, callback, 0, CALLBACK_FUNCTION);
+    MMRESULT result = midiInOpen(&inHandle, inputDeviceInfo->deviceIndex, (DWORD_PTR)OnMessageBuffered, (DWORD_PTR)inputDeviceHandle, CALLBACK_FUNCTION);
     if (result != MMSYSERR_NOERROR)
     {
+        CloseHandle(inputBufferEvent);
+        DeleteInputBuffer(inputBuffer);
         delete inputDeviceHandle;
 
         switch (result)
@@ -482,11 +826,14 @@ API_EXPORT IN_OPENRESULT API_CALL OpenInputDevice_Win(void* info, void* sessionH
 
     inputDeviceHandle->handle = inHandle;
 
-    IN_PREPARESYSEXBUFFERRESULT prepareBufferResult = PrepareInputDeviceSysExBuffer(inputDeviceHandle, sysExBufferSize);
+    IN_PREPARESYSEXBUFFERRESULT prepareBufferResult = PrepareInputDeviceSysExBuffers(inputDeviceHandle, sysExBufferSize);
     if (prepareBufferResult != IN_PREPARESYSEXBUFFERRESULT_OK)
     {
         // on failure, close handle
+        inputDeviceHandle->closing = 1;
         midiInClose(inputDeviceHandle->handle);
+        CloseHandle(inputBufferEvent);
+        DeleteInputBuffer(inputBuffer);
         delete inputDeviceHandle;
 
         switch (prepareBufferResult)
@@ -508,10 +855,69 @@ API_EXPORT IN_OPENRESULT API_CALL OpenInputDevice_Win(void* info, void* sessionH
     return IN_OPENRESULT_OK;
 }
 
+API_EXPORT IN_READBUFFERRESULT API_CALL ReadInputDeviceBuffer(void* handle, BYTE* data, int size, int* bytesRead)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return IN_READBUFFERRESULT_NOBUFFER;
+
+    *bytesRead = ReadFromInputBuffer(inputDeviceHandle->inputBuffer, data, size);
+    return IN_READBUFFERRESULT_OK;
+}
+
+API_EXPORT IN_WAITBUFFERRESULT API_CALL WaitForInputDeviceBuffer(void* handle, int timeout)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return IN_WAITBUFFERRESULT_NOBUFFER;
+
+    DWORD result = WaitForSingleObject(inputDeviceHandle->inputBufferEvent, timeout < 0 ? INFINITE : (DWORD)timeout);
+    switch (result)
+    {
+        case WAIT_OBJECT_0: return IN_WAITBUFFERRESULT_OK;
+        case WAIT_TIMEOUT: return IN_WAITBUFFERRESULT_TIMEOUT;
+    }
+
+    return IN_WAITBUFFERRESULT_UNKNOWNERROR;
+}
+
+API_EXPORT void API_CALL InterruptInputDeviceBufferWaiting(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return;
+
+    SetEvent(inputDeviceHandle->inputBufferEvent);
+}
+
+API_EXPORT LONGLONG API_CALL GetInputDeviceBufferOverflowsCount(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return 0;
+
+    return inputDeviceHandle->inputBuffer->overflowsCount.load(std::memory_order_relaxed);
+}
+
+API_EXPORT IN_ADDTHRUROUTERESULT API_CALL AddInputDeviceThruRoute(void* handle, void* outputHandle, unsigned char* statusesMap, unsigned char* notesMap, int* routeId)
+{
+    *routeId = AddThruRoute(handle, outputHandle, statusesMap, notesMap);
+    return *routeId > 0 ? IN_ADDTHRUROUTERESULT_OK : IN_ADDTHRUROUTERESULT_NOMEMORY;
+}
+
+API_EXPORT void API_CALL RemoveInputDeviceThruRoute(int routeId)
+{
+    RemoveThruRoute(routeId);
+}
+
 API_EXPORT IN_CLOSERESULT API_CALL CloseInputDevice(void* handle)
 {
     InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
 
+    RemoveDeviceThruRoutes(inputDeviceHandle);
+
+    inputDeviceHandle->closing = 1;
+
     MMRESULT result = midiInReset(inputDeviceHandle->handle);
     if (result != MMSYSERR_NOERROR)
     {
@@ -546,6 +952,12 @@ API_EXPORT IN_CLOSERESULT API_CALL CloseInputDevice(void* handle)
         return IN_CLOSERESULT_CLOSE_UNKNOWNERROR;
     }
 
+    if (inputDeviceHandle->inputBuffer != nullptr)
+    {
+        CloseHandle(inputDeviceHandle->inputBufferEvent);
+        DeleteInputBuffer(inputDeviceHandle->inputBuffer);
+    }
+
     // free allocated info
     if (inputDeviceHandle->info)
     {
@@ -561,6 +973,8 @@ API_EXPORT IN_CONNECTRESULT API_CALL ConnectToInputDevice(void* handle)
 {
     InputDeviceHandle* inputDeviceHandle = (InputDeviceHandle*)handle;
 
+    inputDeviceHandle->startTimestamp = GetMonotonicTimeInNanoseconds();
+
     MMRESULT result = midiInStart(inputDeviceHandle->handle);
     if (result != MMSYSERR_NOERROR)
     {
@@ -622,8 +1036,13 @@ typedef struct
 {
     OutputDeviceInfo* info;
     HMIDIOUT handle;
+    BufferPool* sysExBufferPool;
 } OutputDeviceHandle;
 
+// Pooled SysEx buffers start with the MIDIHDR describing the data so no
+// header has to be allocated per event
+#define SYSEX_BUFFER_HEADER_SIZE ((sizeof(MIDIHDR) + 7) & ~static_cast<size_t>(7))
+
 API_EXPORT int API_CALL GetOutputDevicesCount()
 {
     return midiOutGetNumDevs();
@@ -771,13 +1190,19 @@ API_EXPORT OUT_OPENRESULT API_CALL OpenOutputDevice_Win(void* info, void* sessio
 {
     OutputDeviceInfo* outputDeviceInfo = (OutputDeviceInfo*)info;
 
+    BufferPool* sysExBufferPool = CreateBufferPool(BUFFERPOOL_DEFAULTSLABSIZE, BUFFERPOOL_DEFAULTSLABSCOUNT);
+    if (sysExBufferPool == NULL)
+        return OUT_OPENRESULT_NOMEMORY;
+
     OutputDeviceHandle* outputDeviceHandle = new OutputDeviceHandle();
     outputDeviceHandle->info = outputDeviceInfo;
+    outputDeviceHandle->sysExBufferPool = sysExBufferPool;
 
     HMIDIOUT outHandle;
     MMRESULT result = midiOutOpen(&outHandle, outputDeviceInfo->deviceIndex, callback, 0, CALLBACK_FUNCTION);
     if (result != MMSYSERR_NOERROR)
     {
+        DeleteBufferPool(sysExBufferPool);
         delete outputDeviceHandle;
 
         switch (result)
@@ -799,10 +1224,18 @@ API_EXPORT OUT_OPENRESULT API_CALL OpenOutputDevice_Win(void* info, void* sessio
     return OUT_OPENRESULT_OK;
 }
 
+static Scheduler* FindOutputScheduler();
+
 API_EXPORT OUT_CLOSERESULT API_CALL CloseOutputDevice(void* handle)
 {
     OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)handle;
 
+    RemoveDeviceThruRoutes(outputDeviceHandle);
+
+    Scheduler* scheduler = FindOutputScheduler();
+    if (scheduler != NULL)
+        CancelScheduledMessages(scheduler, outputDeviceHandle);
+
     MMRESULT result = midiOutReset(outputDeviceHandle->handle);
     if (result != MMSYSERR_NOERROR)
     {
@@ -832,6 +1265,7 @@ API_EXPORT OUT_CLOSERESULT API_CALL CloseOutputDevice(void* handle)
         delete outputDeviceHandle->info->caps;
         delete outputDeviceHandle->info;
     }
+    DeleteBufferPool(outputDeviceHandle->sysExBufferPool);
     delete outputDeviceHandle;
 
     return OUT_CLOSERESULT_OK;
@@ -857,20 +1291,120 @@ API_EXPORT OUT_SENDSHORTRESULT API_CALL SendShortEventToOutputDevice(void* handl
     return OUT_SENDSHORTRESULT_OK;
 }
 
-API_EXPORT OUT_SENDSYSEXRESULT API_CALL SendSysExEventToOutputDevice_Win(void* handle, LPSTR data, int size)
+/* ================================
+   Scheduled output
+================================ */
+
+// midiOut API has no timestamped sending, so events with future timestamps
+// are held by the scheduler and sent at their time
+
+static void OnSchedulerThreadStarted()
+{
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+
+    // Scheduler thread lives until the process exits, so the period is never ended
+    timeBeginPeriod(1);
+}
+
+static void SendScheduledShortEvent(void* owner, int message)
+{
+    OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)owner;
+    midiOutShortMsg(outputDeviceHandle->handle, (DWORD)message);
+}
+
+// Scheduler (and its thread) is created by the first scheduled event only, so closing
+// devices or cancelling events which have never been scheduled doesn't create it
+
+static std::atomic<Scheduler*> OutputScheduler(NULL);
+
+static Scheduler* GetOutputScheduler()
+{
+    static Scheduler* scheduler = CreateScheduler(GetMonotonicTimeInNanoseconds, SendScheduledShortEvent, OnSchedulerThreadStarted);
+    if (scheduler != NULL)
+        OutputScheduler.store(scheduler, std::memory_order_release);
+
+    return scheduler;
+}
+
+static Scheduler* FindOutputScheduler()
+{
+    return OutputScheduler.load(std::memory_order_acquire);
+}
+
+API_EXPORT OUT_SENDSHORTRESULT API_CALL SendShortEventsToOutputDevice(void* handle, int* messages, LONGLONG* timestamps, LONGLONG token, int count, int* sentCount)
+{
+    *sentCount = 0;
+
+    uint64_t now = GetMonotonicTimeInNanoseconds();
+
+    for (int i = 0; i < count; i++)
+    {
+        if (timestamps != NULL && timestamps[i] > 0 && (uint64_t)timestamps[i] > now)
+        {
+            Scheduler* scheduler = GetOutputScheduler();
+            if (scheduler == NULL || !ScheduleMessage(scheduler, handle, token, (uint64_t)timestamps[i], messages[i]))
+                return OUT_SENDSHORTRESULT_NOMEMORY;
+        }
+        else
+        {
+            OUT_SENDSHORTRESULT result = SendShortEventToOutputDevice(handle, messages[i]);
+            if (result != OUT_SENDSHORTRESULT_OK)
+                return result;
+        }
+
+        (*sentCount)++;
+    }
+
+    return OUT_SENDSHORTRESULT_OK;
+}
+
+API_EXPORT OUT_CANCELSCHEDULEDRESULT API_CALL CancelScheduledOutputDeviceEvents(void* handle, LONGLONG token)
+{
+    Scheduler* scheduler = FindOutputScheduler();
+    if (scheduler != NULL)
+        CancelScheduledMessages(scheduler, handle, token);
+
+    return OUT_CANCELSCHEDULEDRESULT_OK;
+}
+
+API_EXPORT OUT_ACQUIRESYSEXBUFFERRESULT API_CALL AcquireOutputDeviceSysExBuffer(void* handle, int size, void** buffer, LPSTR* data)
 {
     OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)handle;
 
-    LPMIDIHDR header = new MIDIHDR();
-    header->lpData = data;
+    BufferPoolBuffer* poolBuffer = AcquireBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, (uint32_t)(SYSEX_BUFFER_HEADER_SIZE + size));
+    if (poolBuffer == NULL)
+        return OUT_ACQUIRESYSEXBUFFERRESULT_NOMEMORY;
+
+    *buffer = poolBuffer;
+    *data = (LPSTR)(poolBuffer->data + SYSEX_BUFFER_HEADER_SIZE);
+
+    return OUT_ACQUIRESYSEXBUFFERRESULT_OK;
+}
+
+API_EXPORT void API_CALL ReleaseOutputDeviceSysExBuffer(void* handle, void* buffer)
+{
+    OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)handle;
+    ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, (BufferPoolBuffer*)buffer);
+}
+
+API_EXPORT OUT_SENDSYSEXRESULT API_CALL SendSysExBufferToOutputDevice(void* handle, void* buffer, int size)
+{
+    OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)handle;
+    BufferPoolBuffer* poolBuffer = (BufferPoolBuffer*)buffer;
+
+    // Buffer is returned to the pool when MOM_DONE is handled
+    LPMIDIHDR header = (LPMIDIHDR)poolBuffer->data;
+    ZeroMemory(header, sizeof(MIDIHDR));
+    header->lpData = (LPSTR)(poolBuffer->data + SYSEX_BUFFER_HEADER_SIZE);
     header->dwBufferLength = size;
     header->dwBytesRecorded = size;
+    header->dwUser = (DWORD_PTR)poolBuffer;
     header->dwFlags = 0;
 
     MMRESULT result = midiOutPrepareHeader(outputDeviceHandle->handle, header, sizeof(MIDIHDR));
     if (result != MMSYSERR_NOERROR)
     {
-        delete header;
+        ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, poolBuffer);
 
         switch (result)
         {
@@ -887,7 +1421,7 @@ API_EXPORT OUT_SENDSYSEXRESULT API_CALL SendSysExEventToOutputDevice_Win(void* h
     {
         // attempt to unprepare if needed
         midiOutUnprepareHeader(outputDeviceHandle->handle, header, sizeof(MIDIHDR));
-        delete header;
+        ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, poolBuffer);
 
         switch (result)
         {
@@ -903,7 +1437,8 @@ API_EXPORT OUT_SENDSYSEXRESULT API_CALL SendSysExEventToOutputDevice_Win(void* h
     return OUT_SENDSYSEXRESULT_OK;
 }
 
-API_EXPORT OUT_GETSYSEXDATARESULT API_CALL GetOutputDeviceSysExBufferData(void* handle, LPMIDIHDR header, LPSTR* data, int* size)
+// Data remains valid until the buffer is released via ReleaseOutputDeviceSysExBuffer
+API_EXPORT OUT_GETSYSEXDATARESULT API_CALL GetOutputDeviceSysExBufferData(void* handle, LPMIDIHDR header, LPSTR* data, int* size, void** buffer)
 {
     OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)handle;
 
@@ -922,11 +1457,21 @@ API_EXPORT OUT_GETSYSEXDATARESULT API_CALL GetOutputDeviceSysExBufferData(void*
 
     *data = header->lpData;
     *size = header->dwBytesRecorded;
+    *buffer = (void*)header->dwUser;
 
-    delete header;
     return OUT_GETSYSEXDATARESULT_OK;
 }
 
+API_EXPORT void API_CALL GetOutputDeviceSysExBufferPoolCounters(void* handle, LONGLONG* acquisitionsCount, LONGLONG* reusesCount, LONGLONG* exhaustionsCount)
+{
+    OutputDeviceHandle* outputDeviceHandle = (OutputDeviceHandle*)handle;
+    BufferPool* bufferPool = outputDeviceHandle->sysExBufferPool;
+
+    *acquisitionsCount = bufferPool->acquisitionsCount.load(std::memory_order_relaxed);
+    *reusesCount = bufferPool->reusesCount.load(std::memory_order_relaxed);
+    *exhaustionsCount = bufferPool->exhaustionsCount.load(std::memory_order_relaxed);
+}
+
 API_EXPORT char API_CALL IsOutputDevicePropertySupported(OUT_PROPERTY property)
 {
     switch (property)
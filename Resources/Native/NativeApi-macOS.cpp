@@ -3,6 +3,8 @@
 #include <pthread.h>
 #include <mach/mach_time.h>
 #include <mach/mach.h>
+#include <dispatch/dispatch.h>
+#include <time.h>
 
 #include <atomic>
 #include <vector>
@@ -11,6 +13,11 @@
 #include <cstring>
 
 #include "NativeApi-Constants.h"
+#include "NativeApi-InputBuffer.h"
+#include "NativeApi-BufferPool.h"
+#include "NativeApi-Scheduler.h"
+#include "NativeApi-PacketList.h"
+#include "NativeApi-Thru.h"
 
 #define PROPERTY_VALUE_BUFFER_SIZE 256
 #define SMALL_BUFFER_ERROR 10000
@@ -33,6 +40,30 @@ API_EXPORT char CanCompareDevices()
     return 1;
 }
 
+// CLOCK_UPTIME_RAW is the clock behind host time, so timestamps of packets
+// can be converted to it without any offset
+static uint64_t GetMonotonicTimeInNanoseconds()
+{
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+}
+
+API_EXPORT int64_t GetMonotonicTimestamp()
+{
+    return static_cast<int64_t>(GetMonotonicTimeInNanoseconds());
+}
+
+static uint64_t GetPacketTimestamp(const MIDIPacket* packet)
+{
+    if (packet->timeStamp == 0)
+        return GetMonotonicTimeInNanoseconds();
+
+    static mach_timebase_info_data_t timebase = { 0, 0 };
+    if (timebase.denom == 0)
+        mach_timebase_info(&timebase);
+
+    return static_cast<uint64_t>(static_cast<__uint128_t>(packet->timeStamp) * timebase.numer / timebase.denom);
+}
+
 /* ================================
    High-precision tick generator
  ================================ */
@@ -172,6 +203,46 @@ API_EXPORT TG_STARTRESULT StartHighPrecisionTickGenerator_Mac(int interval, void
     return TG_STARTRESULT_OK;
 }
 
+// Non-repeating timer is invalidated after firing and can't be rearmed, so one-shot
+// tick generator uses repeating timer with huge interval moving its next fire date
+
+#define ONE_SHOT_TIMER_INTERVAL_SECONDS 1.0e9
+
+API_EXPORT TG_STARTRESULT StartOneShotHighPrecisionTickGenerator_Mac(void* sessionHandle, void (*callback)(void), TickGeneratorInfo** info)
+{
+    TickGeneratorSessionHandle* pSessionHandle = reinterpret_cast<TickGeneratorSessionHandle*>(sessionHandle);
+    TickGeneratorInfo* tickGeneratorInfo = new TickGeneratorInfo();
+
+    tickGeneratorInfo->callback = callback;
+
+    CFRunLoopTimerContext context = { 0, tickGeneratorInfo, nullptr, nullptr, nullptr };
+    CFRunLoopTimerRef timerRef = CFRunLoopTimerCreate(
+        nullptr,
+        CFAbsoluteTimeGetCurrent() + ONE_SHOT_TIMER_INTERVAL_SECONDS,
+        ONE_SHOT_TIMER_INTERVAL_SECONDS,
+        0,
+        0,
+        TimerCallback,
+        &context);
+
+    tickGeneratorInfo->timerRef = timerRef;
+    CFRunLoopAddTimer(pSessionHandle->runLoopRef, timerRef, kCFRunLoopDefaultMode);
+
+    *info = tickGeneratorInfo;
+
+    return TG_STARTRESULT_OK;
+}
+
+API_EXPORT TG_SCHEDULERESULT ScheduleHighPrecisionTickGeneratorTick(TickGeneratorSessionHandle* sessionHandle, TickGeneratorInfo* tickGeneratorInfo, int64_t delayInMicroseconds)
+{
+    double seconds = static_cast<double>(delayInMicroseconds) / 1000000.0;
+
+    CFRunLoopTimerSetNextFireDate(tickGeneratorInfo->timerRef, CFAbsoluteTimeGetCurrent() + seconds);
+    CFRunLoopWakeUp(sessionHandle->runLoopRef);
+
+    return TG_SCHEDULERESULT_OK;
+}
+
 API_EXPORT TG_STOPRESULT StopHighPrecisionTickGenerator(TickGeneratorSessionHandle* sessionHandle, TickGeneratorInfo* tickGeneratorInfo)
 {
     CFRunLoopRemoveTimer(sessionHandle->runLoopRef, tickGeneratorInfo->timerRef, kCFRunLoopDefaultMode);
@@ -444,6 +515,9 @@ struct InputDeviceHandle
 {
     InputDeviceInfo* info;
     MIDIPortRef portRef;
+    InputBuffer* inputBuffer;
+    dispatch_semaphore_t inputBufferSemaphore;
+    MIDIReadProc callback;
 };
 
 API_EXPORT int GetInputDevicesCount()
@@ -548,6 +622,37 @@ API_EXPORT IN_GETPROPERTYRESULT GetInputDeviceDriverOwner(void* info, char** val
     return GetInputDeviceStringPropertyValue(inputDeviceInfo, kMIDIPropertyDriverOwner, value);
 }
 
+API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int message);
+
+static void SendThruShortMessage(void* outputHandle, int message)
+{
+    SendShortEventToOutputDevice(outputHandle, message);
+}
+
+static void RouteThruPacketList(InputDeviceHandle* inputDeviceHandle, const MIDIPacketList* packetList)
+{
+    if (!HasThruRoutes())
+        return;
+
+    const MIDIPacket* packetPtr = packetList->packet;
+
+    for (UInt32 i = 0; i < packetList->numPackets; i++)
+    {
+        RouteThruData(inputDeviceHandle, packetPtr->data, packetPtr->length, SendThruShortMessage);
+        packetPtr = MIDIPacketNext(packetPtr);
+    }
+}
+
+// Packets are routed by the thru router first and then passed to the
+// callback provided on opening as is
+static void OnMessage(const MIDIPacketList* packetList, void* readProcRefCon, void* srcConnRefCon)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(readProcRefCon);
+
+    RouteThruPacketList(inputDeviceHandle, packetList);
+    inputDeviceHandle->callback(packetList, nullptr, srcConnRefCon);
+}
+
 API_EXPORT IN_OPENRESULT OpenInputDevice_Mac(void* info, void* sessionHandle, MIDIReadProc callback, void** handle)
 {
     InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
@@ -555,14 +660,78 @@ API_EXPORT IN_OPENRESULT OpenInputDevice_Mac(void* info, void* sessionHandle, MI
 
     InputDeviceHandle* inputDeviceHandle = new InputDeviceHandle();
     inputDeviceHandle->info = inputDeviceInfo;
+    inputDeviceHandle->inputBuffer = nullptr;
+    inputDeviceHandle->inputBufferSemaphore = nullptr;
+    inputDeviceHandle->callback = callback;
+
+    *handle = inputDeviceHandle;
+
+    CFStringRef portNameRef = CFSTR("IN");
+    OSStatus status = MIDIInputPortCreate(pSessionHandle->clientRef, portNameRef, OnMessage, inputDeviceHandle, &inputDeviceHandle->portRef);
+    if (status != noErr)
+    {
+        delete inputDeviceHandle;
+        switch (status)
+        {
+            case kMIDIInvalidClient: return IN_OPENRESULT_INVALIDCLIENT;
+            case kMIDIWrongThread: return IN_OPENRESULT_WRONGTHREAD;
+            case kMIDINotPermitted: return IN_OPENRESULT_NOTPERMITTED;
+        }
+        
+        return IN_OPENRESULT_UNKNOWNERROR;
+    }
+
+    return IN_OPENRESULT_OK;
+}
+
+static void OnMessageBuffered(const MIDIPacketList* packetList, void* readProcRefCon, void* srcConnRefCon)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(readProcRefCon);
+    InputBuffer* inputBuffer = inputDeviceHandle->inputBuffer;
+
+    RouteThruPacketList(inputDeviceHandle, packetList);
+
+    char signalRequired = 0;
+
+    const MIDIPacket* packetPtr = packetList->packet;
+
+    for (UInt32 i = 0; i < packetList->numPackets; i++)
+    {
+        if (PushToInputBuffer(inputBuffer, GetPacketTimestamp(packetPtr), 0, packetPtr->data, packetPtr->length))
+            signalRequired = 1;
+
+        packetPtr = MIDIPacketNext(packetPtr);
+    }
+
+    if (signalRequired)
+        dispatch_semaphore_signal(inputDeviceHandle->inputBufferSemaphore);
+}
+
+API_EXPORT IN_OPENRESULT OpenInputDeviceBuffered_Mac(void* info, void* sessionHandle, int bufferSize, void** handle)
+{
+    InputDeviceInfo* inputDeviceInfo = reinterpret_cast<InputDeviceInfo*>(info);
+    SessionHandle* pSessionHandle = reinterpret_cast<SessionHandle*>(sessionHandle);
+
+    InputBuffer* inputBuffer = CreateInputBuffer(bufferSize);
+    if (inputBuffer == nullptr)
+        return IN_OPENRESULT_NOMEMORY;
+
+    InputDeviceHandle* inputDeviceHandle = new InputDeviceHandle();
+    inputDeviceHandle->info = inputDeviceInfo;
+    inputDeviceHandle->inputBuffer = inputBuffer;
+    inputDeviceHandle->inputBufferSemaphore = dispatch_semaphore_create(0);
+    inputDeviceHandle->callback = nullptr;
 
     *handle = inputDeviceHandle;
 
     CFStringRef portNameRef = CFSTR("IN");
-    OSStatus status = MIDIInputPortCreate(pSessionHandle->clientRef, portNameRef, callback, nullptr, &inputDeviceHandle->portRef);
+    OSStatus status = MIDIInputPortCreate(pSessionHandle->clientRef, portNameRef, OnMessageBuffered, inputDeviceHandle, &inputDeviceHandle->portRef);
     if (status != noErr)
     {
+        dispatch_release(inputDeviceHandle->inputBufferSemaphore);
+        DeleteInputBuffer(inputBuffer);
         delete inputDeviceHandle;
+
         switch (status)
         {
             case kMIDIInvalidClient: return IN_OPENRESULT_INVALIDCLIENT;
@@ -576,10 +745,76 @@ API_EXPORT IN_OPENRESULT OpenInputDevice_Mac(void* info, void* sessionHandle, MI
     return IN_OPENRESULT_OK;
 }
 
+API_EXPORT IN_READBUFFERRESULT ReadInputDeviceBuffer(void* handle, Byte* data, int size, int* bytesRead)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return IN_READBUFFERRESULT_NOBUFFER;
+
+    *bytesRead = ReadFromInputBuffer(inputDeviceHandle->inputBuffer, data, size);
+    return IN_READBUFFERRESULT_OK;
+}
+
+API_EXPORT IN_WAITBUFFERRESULT WaitForInputDeviceBuffer(void* handle, int timeout)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return IN_WAITBUFFERRESULT_NOBUFFER;
+
+    dispatch_time_t time = timeout < 0
+        ? DISPATCH_TIME_FOREVER
+        : dispatch_time(DISPATCH_TIME_NOW, static_cast<int64_t>(timeout) * NSEC_PER_MSEC);
+
+    if (dispatch_semaphore_wait(inputDeviceHandle->inputBufferSemaphore, time) != 0)
+        return IN_WAITBUFFERRESULT_TIMEOUT;
+
+    return IN_WAITBUFFERRESULT_OK;
+}
+
+API_EXPORT void InterruptInputDeviceBufferWaiting(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return;
+
+    dispatch_semaphore_signal(inputDeviceHandle->inputBufferSemaphore);
+}
+
+API_EXPORT int64_t GetInputDeviceBufferOverflowsCount(void* handle)
+{
+    InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
+    if (inputDeviceHandle->inputBuffer == nullptr)
+        return 0;
+
+    return inputDeviceHandle->inputBuffer->overflowsCount.load(std::memory_order_relaxed);
+}
+
+API_EXPORT IN_ADDTHRUROUTERESULT AddInputDeviceThruRoute(void* handle, void* outputHandle, Byte* statusesMap, Byte* notesMap, int* routeId)
+{
+    *routeId = AddThruRoute(handle, outputHandle, statusesMap, notesMap);
+    return *routeId > 0 ? IN_ADDTHRUROUTERESULT_OK : IN_ADDTHRUROUTERESULT_NOMEMORY;
+}
+
+API_EXPORT void RemoveInputDeviceThruRoute(int routeId)
+{
+    RemoveThruRoute(routeId);
+}
+
 API_EXPORT IN_CLOSERESULT CloseInputDevice(void* handle)
 {
     InputDeviceHandle* inputDeviceHandle = reinterpret_cast<InputDeviceHandle*>(handle);
 
+    RemoveDeviceThruRoutes(inputDeviceHandle);
+
+    // Port is disposed synchronously so no read proc can touch the handle afterwards
+    MIDIPortDispose(inputDeviceHandle->portRef);
+
+    if (inputDeviceHandle->inputBuffer != nullptr)
+    {
+        dispatch_release(inputDeviceHandle->inputBufferSemaphore);
+        DeleteInputBuffer(inputDeviceHandle->inputBuffer);
+    }
+
     delete inputDeviceHandle->info;
     delete inputDeviceHandle;
 
@@ -631,28 +866,23 @@ API_EXPORT IN_DISCONNECTRESULT DisconnectFromInputDevice(void* handle)
     return IN_DISCONNECTRESULT_OK;
 }
 
-API_EXPORT IN_GETEVENTDATARESULT GetEventDataFromInputDevice(MIDIPacketList* packetList, int packetIndex, Byte** data, int* length, int* packetsCount)
-{
-    *packetsCount = packetList->numPackets;
-    
-    if (packetIndex == 0)
-    {
-        *data = packetList->packet[0].data;
-        *length = packetList->packet[0].length;
-        return IN_GETEVENTDATARESULT_OK;
-    }
-
-    MIDIPacket* packetPtr = packetList->packet;
-
-    for (int i = 0; i < packetIndex; i++)
-    {
-        packetPtr = MIDIPacketNext(packetPtr);
-    }
-
-    *data = packetPtr->data;
-    *length = packetPtr->length;
-
-    return IN_GETEVENTDATARESULT_OK;
+API_EXPORT IN_GETEVENTDATARESULT GetEventsDataFromInputDevice(MIDIPacketList* packetList, int maxPacketsCount, int* offsets, int* lengths, int64_t* timestamps, int* packetsCount, int* dataSize)
+{
+    *packetsCount = FlattenPacketList(
+        packetList,
+        packetList->packet,
+        packetList->numPackets,
+        maxPacketsCount,
+        offsets,
+        lengths,
+        timestamps,
+        dataSize,
+        [](const MIDIPacket* packet) { return const_cast<const MIDIPacket*>(MIDIPacketNext(packet)); },
+        GetPacketTimestamp);
+
+    return *packetsCount > maxPacketsCount
+        ? IN_GETEVENTDATARESULT_BUFFERTOOSMALL
+        : IN_GETEVENTDATARESULT_OK;
 }
 
 API_EXPORT char IsInputDevicePropertySupported(IN_PROPERTY property)
@@ -678,8 +908,14 @@ struct OutputDeviceHandle
 {
     OutputDeviceInfo* info;
     MIDIPortRef portRef;
+    BufferPool* sysExBufferPool;
 };
 
+// Pooled SysEx buffers are laid out as a packet list with a single packet so
+// data written by the caller can be sent as is
+#define SYSEX_BUFFER_HEADER_SIZE (offsetof(MIDIPacketList, packet) + offsetof(MIDIPacket, data))
+#define SYSEX_PACKET_MAXLENGTH 0xFFFF
+
 API_EXPORT int GetOutputDevicesCount()
 {
     return static_cast<int>(MIDIGetNumberOfDestinations());
@@ -787,8 +1023,13 @@ API_EXPORT OUT_OPENRESULT OpenOutputDevice_Mac(void* info, void* sessionHandle,
     OutputDeviceInfo* outputDeviceInfo = reinterpret_cast<OutputDeviceInfo*>(info);
     SessionHandle* pSessionHandle = reinterpret_cast<SessionHandle*>(sessionHandle);
 
+    BufferPool* sysExBufferPool = CreateBufferPool(BUFFERPOOL_DEFAULTSLABSIZE, BUFFERPOOL_DEFAULTSLABSCOUNT);
+    if (sysExBufferPool == nullptr)
+        return OUT_OPENRESULT_NOMEMORY;
+
     OutputDeviceHandle* outputDeviceHandle = new OutputDeviceHandle();
     outputDeviceHandle->info = outputDeviceInfo;
+    outputDeviceHandle->sysExBufferPool = sysExBufferPool;
 
     *handle = outputDeviceHandle;
 
@@ -796,6 +1037,7 @@ API_EXPORT OUT_OPENRESULT OpenOutputDevice_Mac(void* info, void* sessionHandle,
     OSStatus result = MIDIOutputPortCreate(pSessionHandle->clientRef, portNameRef, &outputDeviceHandle->portRef);
     if (result != noErr)
     {
+        DeleteBufferPool(sysExBufferPool);
         delete outputDeviceHandle;
         switch (result)
         {
@@ -810,21 +1052,27 @@ API_EXPORT OUT_OPENRESULT OpenOutputDevice_Mac(void* info, void* sessionHandle,
     return OUT_OPENRESULT_OK;
 }
 
+static Scheduler* FindOutputScheduler();
+
 API_EXPORT OUT_CLOSERESULT CloseOutputDevice(void* handle)
 {
     OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
 
+    RemoveDeviceThruRoutes(outputDeviceHandle);
+
+    Scheduler* scheduler = FindOutputScheduler();
+    if (scheduler != nullptr)
+        CancelScheduledMessages(scheduler, outputDeviceHandle);
+
+    DeleteBufferPool(outputDeviceHandle->sysExBufferPool);
     delete outputDeviceHandle->info;
     delete outputDeviceHandle;
 
     return OUT_CLOSERESULT_OK;
 }
 
-API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int message)
+static ByteCount GetShortEventData(int message, Byte* data)
 {
-    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
-
-    Byte data[3];
     Byte statusByte = static_cast<Byte>(message & 0xFF);
     data[0] = statusByte;
     ByteCount dataSize = 1;
@@ -842,11 +1090,11 @@ API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int me
         }
     }
 
-    std::vector<Byte> bufferVec(static_cast<size_t>(dataSize) + sizeof(MIDIPacketList));
-    MIDIPacketList* packetList = reinterpret_cast<MIDIPacketList*>(bufferVec.data());
-    MIDIPacket* packet = MIDIPacketListInit(packetList);
-    MIDIPacketListAdd(packetList, static_cast<ByteCount>(bufferVec.size()), packet, 0, dataSize, &data[0]);
+    return dataSize;
+}
 
+static OUT_SENDSHORTRESULT SendShortEventsPacketList(OutputDeviceHandle* outputDeviceHandle, MIDIPacketList* packetList)
+{
     OSStatus result = MIDISend(outputDeviceHandle->portRef, outputDeviceHandle->info->endpointRef, packetList);
     if (result != noErr)
     {
@@ -868,15 +1116,133 @@ API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int me
     return OUT_SENDSHORTRESULT_OK;
 }
 
-API_EXPORT OUT_SENDSYSEXRESULT SendSysExEventToOutputDevice_Mac(void* handle, Byte* data, ByteCount dataSize)
+API_EXPORT OUT_SENDSHORTRESULT SendShortEventToOutputDevice(void* handle, int message)
 {
     OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
 
+    Byte data[3];
+    ByteCount dataSize = GetShortEventData(message, data);
+
     std::vector<Byte> bufferVec(static_cast<size_t>(dataSize) + sizeof(MIDIPacketList));
     MIDIPacketList* packetList = reinterpret_cast<MIDIPacketList*>(bufferVec.data());
     MIDIPacket* packet = MIDIPacketListInit(packetList);
     MIDIPacketListAdd(packetList, static_cast<ByteCount>(bufferVec.size()), packet, 0, dataSize, &data[0]);
 
+    return SendShortEventsPacketList(outputDeviceHandle, packetList);
+}
+
+/* ================================
+   Scheduled output
+ ================================ */
+
+// CoreMIDI can schedule packets with future timestamps by itself, but it can
+// only unschedule all packets sent to a destination. So events with future
+// timestamps are held by the scheduler to cancel them per token
+
+static void OnSchedulerThreadStarted()
+{
+    // Failure to set realtime priority is ignored and the thread keeps default one
+    mach_timebase_info_data_t timebase;
+    if (mach_timebase_info(&timebase) != KERN_SUCCESS)
+        return;
+
+    struct thread_time_constraint_policy constraintPolicy;
+
+    constraintPolicy.period = 0;
+    constraintPolicy.computation = 1000 * 1000 * timebase.denom / timebase.numer;
+    constraintPolicy.constraint = 2000 * 1000 * timebase.denom / timebase.numer;
+    constraintPolicy.preemptible = FALSE;
+
+    thread_port_t threadId = pthread_mach_thread_np(pthread_self());
+    thread_policy_set(threadId, THREAD_TIME_CONSTRAINT_POLICY, (thread_policy_t)&constraintPolicy, THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+}
+
+static void SendScheduledShortEvent(void* owner, int message)
+{
+    SendShortEventToOutputDevice(owner, message);
+}
+
+// Scheduler (and its thread) is created by the first scheduled event only, so closing
+// devices or cancelling events which have never been scheduled doesn't create it
+
+static std::atomic<Scheduler*> OutputScheduler(nullptr);
+
+static Scheduler* GetOutputScheduler()
+{
+    static Scheduler* scheduler = CreateScheduler(GetMonotonicTimeInNanoseconds, SendScheduledShortEvent, OnSchedulerThreadStarted);
+    if (scheduler != nullptr)
+        OutputScheduler.store(scheduler, std::memory_order_release);
+
+    return scheduler;
+}
+
+static Scheduler* FindOutputScheduler()
+{
+    return OutputScheduler.load(std::memory_order_acquire);
+}
+
+static OUT_SENDSHORTRESULT FlushShortEventsPacketList(OutputDeviceHandle* outputDeviceHandle, MIDIPacketList* packetList, MIDIPacket** packet, int* sentCount)
+{
+    UInt32 packetsCount = packetList->numPackets;
+    if (packetsCount == 0)
+        return OUT_SENDSHORTRESULT_OK;
+
+    OUT_SENDSHORTRESULT result = SendShortEventsPacketList(outputDeviceHandle, packetList);
+    if (result != OUT_SENDSHORTRESULT_OK)
+        return result;
+
+    *sentCount += static_cast<int>(packetsCount);
+    *packet = MIDIPacketListInit(packetList);
+    return OUT_SENDSHORTRESULT_OK;
+}
+
+API_EXPORT OUT_SENDSHORTRESULT SendShortEventsToOutputDevice(void* handle, int* messages, int64_t* timestamps, int64_t token, int count, int* sentCount)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    *sentCount = 0;
+
+    if (count <= 0)
+        return OUT_SENDSHORTRESULT_OK;
+
+    uint64_t now = GetMonotonicTimeInNanoseconds();
+
+    // Every packet takes its header and at most 3 data bytes plus alignment padding
+    size_t packetSize = offsetof(MIDIPacket, data) + 8;
+    std::vector<Byte> bufferVec(sizeof(MIDIPacketList) + static_cast<size_t>(count) * packetSize);
+    MIDIPacketList* packetList = reinterpret_cast<MIDIPacketList*>(bufferVec.data());
+    MIDIPacket* packet = MIDIPacketListInit(packetList);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (timestamps != nullptr && timestamps[i] > 0 && static_cast<uint64_t>(timestamps[i]) > now)
+        {
+            // Events collected so far are flushed first so sentCount always
+            // covers a prefix of the input if scheduling fails
+            OUT_SENDSHORTRESULT result = FlushShortEventsPacketList(outputDeviceHandle, packetList, &packet, sentCount);
+            if (result != OUT_SENDSHORTRESULT_OK)
+                return result;
+
+            Scheduler* scheduler = GetOutputScheduler();
+            if (scheduler == nullptr || !ScheduleMessage(scheduler, outputDeviceHandle, token, static_cast<uint64_t>(timestamps[i]), messages[i]))
+                return OUT_SENDSHORTRESULT_NOMEMORY;
+
+            (*sentCount)++;
+            continue;
+        }
+
+        Byte data[3];
+        ByteCount dataSize = GetShortEventData(messages[i], data);
+
+        packet = MIDIPacketListAdd(packetList, static_cast<ByteCount>(bufferVec.size()), packet, 0, dataSize, &data[0]);
+        if (packet == nullptr)
+            return OUT_SENDSHORTRESULT_UNKNOWNERROR;
+    }
+
+    return FlushShortEventsPacketList(outputDeviceHandle, packetList, &packet, sentCount);
+}
+
+static OUT_SENDSYSEXRESULT SendSysExPacketList(OutputDeviceHandle* outputDeviceHandle, MIDIPacketList* packetList)
+{
     OSStatus result = MIDISend(outputDeviceHandle->portRef, outputDeviceHandle->info->endpointRef, packetList);
     if (result != noErr)
     {
@@ -898,6 +1264,86 @@ API_EXPORT OUT_SENDSYSEXRESULT SendSysExEventToOutputDevice_Mac(void* handle, By
     return OUT_SENDSYSEXRESULT_OK;
 }
 
+API_EXPORT OUT_CANCELSCHEDULEDRESULT CancelScheduledOutputDeviceEvents(void* handle, int64_t token)
+{
+    Scheduler* scheduler = FindOutputScheduler();
+    if (scheduler != nullptr)
+        CancelScheduledMessages(scheduler, handle, token);
+
+    return OUT_CANCELSCHEDULEDRESULT_OK;
+}
+
+API_EXPORT OUT_ACQUIRESYSEXBUFFERRESULT AcquireOutputDeviceSysExBuffer(void* handle, int size, void** buffer, Byte** data)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+
+    BufferPoolBuffer* poolBuffer = AcquireBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, static_cast<uint32_t>(SYSEX_BUFFER_HEADER_SIZE + size));
+    if (poolBuffer == nullptr)
+        return OUT_ACQUIRESYSEXBUFFERRESULT_NOMEMORY;
+
+    *buffer = poolBuffer;
+    *data = poolBuffer->data + SYSEX_BUFFER_HEADER_SIZE;
+
+    return OUT_ACQUIRESYSEXBUFFERRESULT_OK;
+}
+
+API_EXPORT void ReleaseOutputDeviceSysExBuffer(void* handle, void* buffer)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, reinterpret_cast<BufferPoolBuffer*>(buffer));
+}
+
+API_EXPORT OUT_SENDSYSEXRESULT SendSysExBufferToOutputDevice(void* handle, void* buffer, int size)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    BufferPoolBuffer* poolBuffer = reinterpret_cast<BufferPoolBuffer*>(buffer);
+
+    Byte* data = poolBuffer->data + SYSEX_BUFFER_HEADER_SIZE;
+    OUT_SENDSYSEXRESULT result;
+
+    if (size <= SYSEX_PACKET_MAXLENGTH)
+    {
+        MIDIPacketList* packetList = reinterpret_cast<MIDIPacketList*>(poolBuffer->data);
+        packetList->numPackets = 1;
+        packetList->packet[0].timeStamp = 0;
+        packetList->packet[0].length = static_cast<UInt16>(size);
+
+        result = SendSysExPacketList(outputDeviceHandle, packetList);
+    }
+    else
+    {
+        // MIDIPacket can't hold more than 65535 bytes so huge SysEx is split
+        // into several packets of the same packet list
+        size_t packetsCount = (static_cast<size_t>(size) + SYSEX_PACKET_MAXLENGTH - 1) / SYSEX_PACKET_MAXLENGTH;
+        std::vector<Byte> bufferVec(sizeof(MIDIPacketList) + packetsCount * sizeof(MIDIPacket) + static_cast<size_t>(size));
+        MIDIPacketList* packetList = reinterpret_cast<MIDIPacketList*>(bufferVec.data());
+        MIDIPacket* packet = MIDIPacketListInit(packetList);
+
+        for (int offset = 0; offset < size && packet != nullptr; offset += SYSEX_PACKET_MAXLENGTH)
+        {
+            int length = size - offset < SYSEX_PACKET_MAXLENGTH ? size - offset : SYSEX_PACKET_MAXLENGTH;
+            packet = MIDIPacketListAdd(packetList, static_cast<ByteCount>(bufferVec.size()), packet, 0, static_cast<ByteCount>(length), data + offset);
+        }
+
+        result = packet != nullptr
+            ? SendSysExPacketList(outputDeviceHandle, packetList)
+            : OUT_SENDSYSEXRESULT_UNKNOWNERROR;
+    }
+
+    ReleaseBufferPoolBuffer(outputDeviceHandle->sysExBufferPool, poolBuffer);
+    return result;
+}
+
+API_EXPORT void GetOutputDeviceSysExBufferPoolCounters(void* handle, int64_t* acquisitionsCount, int64_t* reusesCount, int64_t* exhaustionsCount)
+{
+    OutputDeviceHandle* outputDeviceHandle = reinterpret_cast<OutputDeviceHandle*>(handle);
+    BufferPool* bufferPool = outputDeviceHandle->sysExBufferPool;
+
+    *acquisitionsCount = bufferPool->acquisitionsCount.load(std::memory_order_relaxed);
+    *reusesCount = bufferPool->reusesCount.load(std::memory_order_relaxed);
+    *exhaustionsCount = bufferPool->exhaustionsCount.load(std::memory_order_relaxed);
+}
+
 API_EXPORT char IsOutputDevicePropertySupported(OUT_PROPERTY property)
 {
     switch (property)